@@ -144,9 +144,13 @@ class Vector;
  *         << " is " << result << std::endl;
  * @endcode
  *
- * This class overloads the virtual methods value() and vector_value() of the
- * Function base class with the byte compiled versions of the expressions
- * given to the initialize() methods. Note that the class will not work unless
+ * This class overloads the virtual methods value(), vector_value(),
+ * value_list(), and vector_value_list() of the Function base class with the
+ * byte compiled versions of the expressions given to the initialize()
+ * methods. The list versions evaluate batches of points at once using the
+ * bulk evaluation mode of muparser and should be preferred over repeated calls
+ * to value() when many points, e.g., all quadrature points of a cell, need to
+ * be evaluated. Note that the class will not work unless
  * you first call the initialize() method that accepts the text description of
  * the function as an argument (among other things).
  *
@@ -351,6 +355,33 @@ public:
   virtual double
   value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+  /**
+   * Return all components of the function at the given point. In contrast to
+   * the default implementation in the Function base class, the variables of
+   * the expressions are only set once for all components.
+   */
+  virtual void
+  vector_value(const Point<dim> &p, Vector<double> &values) const override;
+
+  /**
+   * Return the value of the given component of the function at all of the
+   * given points. The points are evaluated in batches using the bulk
+   * evaluation mode of the underlying parser, which is significantly faster
+   * than evaluating the function point by point via value().
+   */
+  virtual void
+  value_list(const std::vector<Point<dim>> &points,
+             std::vector<double>           &values,
+             const unsigned int             component = 0) const override;
+
+  /**
+   * Return all components of the function at all of the given points. Like
+   * value_list(), this function evaluates the points in batches.
+   */
+  virtual void
+  vector_value_list(const std::vector<Point<dim>> &points,
+                    std::vector<Vector<double>>   &values) const override;
+
   /**
    * Return an array of function expressions (one per component), used to
    * initialize this function.
@@ -29,6 +29,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 
@@ -340,6 +341,24 @@ public:
   void
   compress() const;
 
+  /**
+   * Let compress() set up lookup tables that accelerate is_element(),
+   * index_within_set(), and nth_index_in_set() for sets that consist of many
+   * small ranges, as is common for sets of ghost indices. Without these
+   * tables, these functions use a binary search over all ranges whenever
+   * the index in question is not in the largest range.
+   *
+   * The tables are only set up for sets with at least 16 ranges. They are
+   * built lazily by the first call to compress() after this function has
+   * been called or the set has been modified, and take up to 8 bytes per
+   * range, in addition to the 12 bytes (or 24 bytes with 64-bit indices)
+   * per range the set itself needs. Copies
+   * of the set keep this setting, whereas sets created by operations such as
+   * operator&() or get_view() do not use lookup tables unless requested.
+   */
+  void
+  enable_range_lookup();
+
   /**
    * Comparison for equality of index sets.
    *
@@ -1122,6 +1141,12 @@ private:
    */
   mutable bool is_compressed;
 
+  /**
+   * Whether compress() sets up the lookup tables in #range_lookup, see
+   * enable_range_lookup().
+   */
+  bool use_range_lookup;
+
   /**
    * The overall size of the index range. Elements of this index set have to
    * have a smaller number than this value.
@@ -1139,6 +1164,84 @@ private:
    */
   mutable size_type largest_range;
 
+  /**
+   * A lookup table that accelerates finding the range that contains a given
+   * index in index sets consisting of many small ranges, as is common for
+   * sets of ghost indices. The keys (either global indices or positions
+   * within the set) between #offset and the end of the last range are split
+   * into buckets of size <tt>2^shift</tt>, and entry <tt>b</tt> of
+   * #first_range contains the number of the first range that ends after the
+   * beginning of bucket <tt>b</tt>. The range containing a key in bucket
+   * <tt>b</tt>, if any, therefore has a number between
+   * <tt>first_range[b]</tt> and <tt>first_range[b+1]</tt>, inclusive. The
+   * bucket size is chosen such that there are about as many buckets as
+   * ranges, which makes a search take constant time on average instead of
+   * the logarithmic time of a binary search over all ranges.
+   */
+  struct RangeLookup
+  {
+    /**
+     * The first key covered by the table.
+     */
+    size_type offset = 0;
+
+    /**
+     * One past the last key covered by the table.
+     */
+    size_type end = 0;
+
+    /**
+     * The base-two logarithm of the bucket size.
+     */
+    unsigned int shift = 0;
+
+    /**
+     * The first range ending after the beginning of each bucket, followed
+     * by the number of the last range. Empty if the table is not in use.
+     */
+    std::vector<unsigned int> first_range;
+
+    /**
+     * Set up the table for keys in the interval <tt>[first_key,
+     * end_key)</tt> and @p n_ranges ranges sorted by their keys, given a
+     * function that returns for each range the key one past its last key.
+     */
+    template <typename RangeEndFunction>
+    void
+    reinit(const size_type         first_key,
+           const size_type         end_key,
+           const unsigned int      n_ranges,
+           const RangeEndFunction &range_end);
+
+    /**
+     * Return the first and one past the last number of the ranges that may
+     * contain the given key. If the key is outside the keys covered by the
+     * table, return an empty interval.
+     */
+    std::pair<unsigned int, unsigned int>
+    candidate_ranges(const size_type key) const;
+  };
+
+  /**
+   * The lookup tables for global indices, used by is_element() and
+   * index_within_set(), and for positions within the set, used by
+   * nth_index_in_set().
+   */
+  struct RangeLookupTables
+  {
+    RangeLookup global_indices;
+    RangeLookup local_indices;
+  };
+
+  /**
+   * The lookup tables, or a null pointer if they are not in use. They are
+   * built by compress() if enable_range_lookup() has been called and the set
+   * consists of sufficiently many ranges. Since the tables are not modified
+   * once they have been built, copies of the set can share them, and sets
+   * that do not use them only pay for the pointer.
+   */
+  mutable std::shared_ptr<const RangeLookupTables> range_lookup;
+
   /**
    * A mutex that is used to synchronize operations of the do_compress()
    * function that is called from many 'const' functions via compress().
@@ -1671,6 +1774,7 @@ inline IndexSet::Range::Range(const size_type i1, const size_type i2)
 
 inline IndexSet::IndexSet()
   : is_compressed(true)
+  , use_range_lookup(false)
   , index_space_size(0)
   , largest_range(numbers::invalid_unsigned_int)
 {}
@@ -1679,6 +1783,7 @@ inline IndexSet::IndexSet()
 
 inline IndexSet::IndexSet(const size_type size)
   : is_compressed(true)
+  , use_range_lookup(false)
   , index_space_size(size)
   , largest_range(numbers::invalid_unsigned_int)
 {}
@@ -1688,11 +1793,14 @@ inline IndexSet::IndexSet(const size_type size)
 inline IndexSet::IndexSet(IndexSet &&is) noexcept
   : ranges(std::move(is.ranges))
   , is_compressed(is.is_compressed)
+  , use_range_lookup(is.use_range_lookup)
   , index_space_size(is.index_space_size)
   , largest_range(is.largest_range)
+  , range_lookup(std::move(is.range_lookup))
 {
   is.ranges.clear();
   is.is_compressed    = true;
+  is.use_range_lookup = false;
   is.index_space_size = 0;
   is.largest_range    = numbers::invalid_unsigned_int;
 
@@ -1706,11 +1814,14 @@ IndexSet::operator=(IndexSet &&is) noexcept
 {
   ranges           = std::move(is.ranges);
   is_compressed    = is.is_compressed;
+  use_range_lookup = is.use_range_lookup;
   index_space_size = is.index_space_size;
   largest_range    = is.largest_range;
+  range_lookup     = std::move(is.range_lookup);
 
   is.ranges.clear();
   is.is_compressed    = true;
+  is.use_range_lookup = false;
   is.index_space_size = 0;
   is.largest_range    = numbers::invalid_unsigned_int;
 
@@ -1771,6 +1882,7 @@ IndexSet::clear()
   ranges.clear();
   is_compressed = true;
   largest_range = numbers::invalid_unsigned_int;
+  range_lookup.reset();
 }
 
 
@@ -1806,6 +1918,20 @@ IndexSet::compress() const
 
 
 
+inline void
+IndexSet::enable_range_lookup()
+{
+  if (use_range_lookup == false)
+    {
+      use_range_lookup = true;
+
+      // let the next call to compress() build the tables
+      is_compressed = false;
+    }
+}
+
+
+
 inline void
 IndexSet::add_index(const size_type index)
 {
@@ -2136,6 +2262,10 @@ inline void
 IndexSet::serialize(Archive &ar, const unsigned int)
 {
   ar &ranges &is_compressed &index_space_size &largest_range;
+
+  // the lookup tables are not stored, but need to be rebuilt when loading
+  if constexpr (Archive::is_loading::value)
+    do_compress();
 }
 
 DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,303 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_memory_tracker_h
+#define dealii_memory_tracker_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mutex.h>
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * This class collects information about the memory used by the different
+ * parts (in the following called "subsystems") of a program, for example
+ * the Triangulation, the DoFHandler, the AffineConstraints object, the
+ * SparsityPattern, or the MatrixFree object of a simulation, and prints a
+ * summary of it in a format similar to the one used by TimerOutput.
+ *
+ * For each subsystem, identified by a string, the class keeps track of the
+ * number of bytes currently attributed to it and of the largest number of
+ * bytes ever attributed to it (its "high water mark"). There are two ways to
+ * attribute memory to a subsystem:
+ * - By calling record() or record_memory_consumption(), typically after a
+ *   data structure has been set up. This sets the current memory of the
+ *   subsystem to the given value or to the value returned by
+ *   MemoryConsumption::memory_consumption() for the given object.
+ * - By enclosing the code that sets up a data structure in a pair of calls
+ *   to enter_subsection() and leave_subsection(), or, more conveniently, in
+ *   the lifetime of a MemoryTracker::Scope object. In this case, the class
+ *   queries the resident set size and the peak resident set size of the
+ *   process via Utilities::System::get_memory_stats() when entering and
+ *   leaving the section. The growth of the resident set size is added to the
+ *   current memory of the subsystem, and if the peak resident set size of
+ *   the process increased during the section, the temporary memory used
+ *   within the section is taken into account for the high water mark of the
+ *   subsystem. This allows to identify the subsystem that determines the
+ *   peak memory consumption of a program even if the memory is only needed
+ *   temporarily.
+ *
+ * A typical use looks as follows:
+ * @code
+ *   MemoryTracker memory_tracker(pcout);
+ *
+ *   {
+ *     MemoryTracker::Scope scope(memory_tracker, "DoFHandler");
+ *     dof_handler.distribute_dofs(fe);
+ *   }
+ *   memory_tracker.record_memory_consumption("Triangulation", triangulation);
+ *   memory_tracker.record_memory_consumption("Sparsity pattern",
+ *                                            sparsity_pattern);
+ *
+ *   memory_tracker.print_summary(MPI_COMM_WORLD);
+ * @endcode
+ *
+ * @note Measurements based on the resident set size are only available on
+ * Linux systems (see Utilities::System::get_memory_stats()) and can only
+ * ever be approximate: they include all memory allocated by the process
+ * during a section, including memory allocated by other threads, and they do
+ * not see memory that the memory allocator reuses without requesting it
+ * from the operating system. They are therefore not equivalent to tracking
+ * the individual allocations of a subsystem (as a replacement memory
+ * allocator could do): the numbers of a section can be too small if the
+ * section reuses memory freed before, and too large if it touches memory
+ * that belongs to other parts of the program. Only the high water mark of
+ * the whole process in the last row of print_summary() is exact.
+ */
+class MemoryTracker
+{
+public:
+  /**
+   * Helper class to enter and leave a section of a MemoryTracker by
+   * constructing and destroying a scope-based object, in the same way as
+   * TimerOutput::Scope.
+   */
+  class Scope
+  {
+  public:
+    /**
+     * Enter the given section of the tracker. The section is left
+     * automatically when calling stop() or when the destructor runs.
+     */
+    Scope(MemoryTracker &tracker, const std::string &section_name);
+
+    /**
+     * Destructor. Calls stop().
+     */
+    ~Scope();
+
+    /**
+     * Leave the section before the destructor is executed.
+     */
+    void
+    stop();
+
+  private:
+    /**
+     * Reference to the MemoryTracker object.
+     */
+    MemoryTracker &tracker;
+
+    /**
+     * Name of the section we need to leave.
+     */
+    const std::string section_name;
+
+    /**
+     * Do we still need to leave the section we are in?
+     */
+    bool in;
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param stream The stream to which print_summary() writes its output.
+   */
+  explicit MemoryTracker(std::ostream &stream);
+
+  /**
+   * Constructor.
+   *
+   * @param stream The stream to which print_summary() writes its output.
+   */
+  explicit MemoryTracker(const ConditionalOStream &stream);
+
+  /**
+   * Enter the section (subsystem) with the given name and remember the
+   * current memory statistics of the process. A section can not be entered
+   * again while it is active.
+   */
+  void
+  enter_subsection(const std::string &section_name);
+
+  /**
+   * Leave the section with the given name and attribute the change of the
+   * memory statistics of the process since entering the section to it.
+   */
+  void
+  leave_subsection(const std::string &section_name);
+
+  /**
+   * Set the memory currently attributed to the subsystem with the given
+   * name to @p n_bytes, and update its high water mark.
+   */
+  void
+  record(const std::string &section_name, const std::size_t n_bytes);
+
+  /**
+   * Set the memory currently attributed to the subsystem with the given
+   * name to the memory consumption of @p object as reported by
+   * MemoryConsumption::memory_consumption(), and update the high water mark
+   * of the subsystem.
+   */
+  template <typename T>
+  void
+  record_memory_consumption(const std::string &section_name, const T &object);
+
+  /**
+   * Return the number of bytes currently attributed to the subsystem with
+   * the given name, or zero if nothing has been recorded for it.
+   */
+  std::size_t
+  get_current_memory(const std::string &section_name) const;
+
+  /**
+   * Return the largest number of bytes attributed to the subsystem with the
+   * given name so far, or zero if nothing has been recorded for it.
+   */
+  std::size_t
+  get_peak_memory(const std::string &section_name) const;
+
+  /**
+   * Print a formatted table that lists, for each subsystem, the minimum,
+   * average, and maximum over all processes in @p mpi_comm of the memory
+   * currently attributed to the subsystem, as well as the maximal high water
+   * mark and the rank where it is attained. The last row shows the same
+   * information for the resident set size of the whole process, with its
+   * high water mark in the last column.
+   *
+   * This function needs to be called on all processes of @p mpi_comm. The
+   * table contains all subsystems recorded on any of the processes, and a
+   * subsystem that has not been recorded on some process counts with zero
+   * bytes there.
+   */
+  void
+  print_summary(const MPI_Comm mpi_comm = MPI_COMM_SELF) const;
+
+  /**
+   * Reset all recorded information.
+   */
+  void
+  reset();
+
+private:
+  /**
+   * A structure that groups all information collected about a subsystem.
+   */
+  struct Section
+  {
+    /**
+     * The number of bytes currently attributed to the subsystem.
+     */
+    std::size_t current_memory = 0;
+
+    /**
+     * The largest number of bytes attributed to the subsystem so far.
+     */
+    std::size_t peak_memory = 0;
+
+    /**
+     * Whether the section has been entered but not yet left.
+     */
+    bool active = false;
+
+    /**
+     * The resident set size of the process, in kB, when entering the
+     * section.
+     */
+    unsigned long int rss_at_entry = 0;
+
+    /**
+     * The peak resident set size of the process, in kB, when entering the
+     * section.
+     */
+    unsigned long int peak_rss_at_entry = 0;
+  };
+
+  /**
+   * A list of all subsystems and their information.
+   */
+  std::map<std::string, Section> sections;
+
+  /**
+   * The stream object to which we are to output.
+   */
+  ConditionalOStream out_stream;
+
+  /**
+   * A lock that makes sure that this class gives reasonable results even when
+   * used with several threads.
+   */
+  mutable Threads::Mutex mutex;
+};
+
+
+
+/* ---------------- inline functions ----------------- */
+
+
+template <typename T>
+inline void
+MemoryTracker::record_memory_consumption(const std::string &section_name,
+                                         const T           &object)
+{
+  record(section_name, MemoryConsumption::memory_consumption(object));
+}
+
+
+
+inline MemoryTracker::Scope::Scope(MemoryTracker     &tracker,
+                                   const std::string &section_name)
+  : tracker(tracker)
+  , section_name(section_name)
+  , in(true)
+{
+  tracker.enter_subsection(section_name);
+}
+
+
+
+inline void
+MemoryTracker::Scope::stop()
+{
+  if (!in)
+    return;
+  in = false;
+
+  tracker.leave_subsection(section_name);
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
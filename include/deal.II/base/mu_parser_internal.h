@@ -117,6 +117,15 @@ namespace internal
       virtual ~muParserBase() = default;
     };
 
+    /**
+     * The number of points whose independent variables are stored
+     * simultaneously in ParserData::vars. muParser can evaluate an expression
+     * for all of these points with a single call to its bulk evaluation mode,
+     * which avoids the per-call overhead of setting up the evaluation of
+     * the byte code for every individual point.
+     */
+    constexpr unsigned int bulk_size = 32;
+
     /**
      * Class containing the mutable state required by muParser.
      *
@@ -144,10 +153,20 @@ namespace internal
 
       /**
        * Scratch array used to set independent variables (i.e., x, y, and t)
-       * before each muParser call.
+       * before each muParser call. The array stores bulk_size values for each
+       * variable, i.e., the value of the variable with index <code>iv</code>
+       * at the point with index <code>q</code> of the current batch is stored
+       * in <code>vars[iv * bulk_size + q]</code>. Single-point evaluation
+       * only uses the entries with <code>q == 0</code>.
        */
       std::vector<double> vars;
 
+      /**
+       * Scratch array into which muParser writes the results of a bulk
+       * evaluation.
+       */
+      std::vector<double> bulk_values;
+
       /**
        * The actual muParser parser objects (hidden with PIMPL).
        */
@@ -196,6 +215,29 @@ namespace internal
                     const double       time,
                     ArrayView<Number> &values) const;
 
+      /**
+       * Compute the values of a single component at all of the given points.
+       * The points are evaluated in batches of size bulk_size using the bulk
+       * evaluation mode of muParser, which is considerably cheaper than
+       * calling do_value() for each point individually.
+       */
+      void
+      do_value_list(const ArrayView<const Point<dim>> &points,
+                    const double                       time,
+                    const unsigned int                 component,
+                    const ArrayView<Number>           &values) const;
+
+      /**
+       * Compute the values of all components at all of the given points in
+       * the same way as do_value_list(). The value of component
+       * <code>c</code> at point <code>q</code> is stored in
+       * <code>values[c * points.size() + q]</code>.
+       */
+      void
+      do_all_values_list(const ArrayView<const Point<dim>> &points,
+                         const double                       time,
+                         const ArrayView<Number>           &values) const;
+
       /**
        * An array of function expressions (one per component), required to
        * initialize tfp in each thread.
@@ -203,6 +245,18 @@ namespace internal
       std::vector<std::string> expressions;
 
     private:
+      /**
+       * Copy the coordinates of (at most bulk_size) points starting at
+       * @p first_point as well as the given @p time into the variables
+       * of the thread-local parser data @p data.
+       */
+      void
+      set_bulk_variables(const ArrayView<const Point<dim>> &points,
+                         const unsigned int                 first_point,
+                         const unsigned int                 n_points,
+                         const double                       time,
+                         ParserData                        &data) const;
+
       /**
        * The muParser objects (hidden with the PIMPL idiom) for each thread (and
        * one for each component).
@@ -25,6 +25,8 @@
 #include <list>
 #include <map>
 #include <string>
+#include <thread>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -797,6 +799,59 @@ public:
   print_wall_time_statistics(const MPI_Comm mpi_comm,
                              const double   print_quantile = 0.) const;
 
+  /**
+   * Print a formatted table that summarizes the wall time consumed in the
+   * various sections, taking into account how sections were nested. Every
+   * time a section is entered while other sections are active on the same
+   * thread, its time is attributed to the path of these sections (in the
+   * order in which they were entered) rather than only to the section
+   * itself. Sections active on other threads are not taken into account,
+   * so that sections entered concurrently from different tasks are not
+   * nested in each other. The table lists each such path as an indented
+   * tree, with the number of calls, the accumulated wall time, and the
+   * fraction of the time of the enclosing section (or of the total run time
+   * for top-level sections).
+   *
+   * If @p mpi_comm contains more than one process, the table contains the
+   * paths encountered on any of the processes, and lists the minimum,
+   * average, and maximum wall time over all processes along with the ranks
+   * where the minimum and maximum are attained, in the same way as
+   * print_wall_time_statistics(). The number of calls is the maximum over
+   * all processes, and the fraction of the enclosing section is computed
+   * from the average times. As for print_wall_time_statistics(), this is
+   * only useful if the TimerOutput object is constructed without an MPI_Comm
+   * argument. This function needs to be called on all processes of
+   * @p mpi_comm.
+   */
+  void
+  print_nested_summary(const MPI_Comm mpi_comm = MPI_COMM_SELF) const;
+
+  /**
+   * Enable or disable the recording of trace events. While recording is
+   * enabled, every pair of calls to enter_subsection() and
+   * leave_subsection() stores the start time, the duration, and the
+   * thread of the call. The recorded events can be written with
+   * write_trace(). Recording is disabled by default.
+   */
+  void
+  enable_trace_recording(const bool record = true);
+
+  /**
+   * Write all trace events recorded so far in the Chrome trace event format
+   * (a JSON file that can be loaded by chrome://tracing or Perfetto) to the
+   * given stream. The events of all processes in @p mpi_comm are collected
+   * on the process with rank zero, which is the only process writing to
+   * @p out; each MPI process appears as a separate process in the timeline,
+   * and each thread that entered a section as a separate thread of that
+   * process. Start times are measured relative to the construction of this
+   * object (or the last call to reset()) on each process.
+   *
+   * This function needs to be called on all processes of @p mpi_comm.
+   */
+  void
+  write_trace(std::ostream  &out,
+              const MPI_Comm mpi_comm = MPI_COMM_SELF) const;
+
   /**
    * By calling this function, all output can be disabled. This function
    * together with enable_output() can be useful if one wants to control the
@@ -849,6 +904,24 @@ private:
     double       total_cpu_time;
     double       total_wall_time;
     unsigned int n_calls;
+
+    /**
+     * The list of sections active on the same thread, including this one,
+     * at the time this section was last entered.
+     */
+    std::vector<std::string> path;
+
+    /**
+     * The thread on which this section was last entered.
+     */
+    std::thread::id thread;
+
+    /**
+     * The time, relative to the start of #timer_all, at which this section
+     * was last entered. Only used when recording trace events, and NaN if
+     * no trace was recorded when the section was entered.
+     */
+    double trace_start_time;
   };
 
   /**
@@ -856,6 +929,52 @@ private:
    */
   std::map<std::string, Section> sections;
 
+  /**
+   * A structure that groups the information collected for a section when
+   * entered within a specific list of enclosing sections.
+   */
+  struct NestedSection
+  {
+    double       total_wall_time;
+    unsigned int n_calls;
+  };
+
+  /**
+   * The accumulated information for every path of nested sections
+   * encountered so far, used by print_nested_summary(). Since a path sorts
+   * directly before all paths it is a prefix of, iterating over this map
+   * visits the tree of nested sections in depth-first order.
+   */
+  std::map<std::vector<std::string>, NestedSection> nested_sections;
+
+  /**
+   * A structure describing a single pair of calls to enter_subsection() and
+   * leave_subsection() when recording trace events.
+   */
+  struct TraceEvent
+  {
+    std::string  name;
+    double       start_time;
+    double       duration;
+    unsigned int thread_index;
+  };
+
+  /**
+   * Whether trace events are to be recorded.
+   */
+  bool record_trace;
+
+  /**
+   * The trace events recorded so far.
+   */
+  std::vector<TraceEvent> trace_events;
+
+  /**
+   * A map from the threads that have entered a section to consecutive
+   * integers, used to identify threads in the recorded trace events.
+   */
+  std::map<std::thread::id, unsigned int> thread_indices;
+
   /**
    * The stream object to which we are to output.
    */
@@ -875,6 +994,13 @@ private:
    */
   std::list<std::string> active_sections;
 
+  /**
+   * The sections that have been entered and not exited, for each thread
+   * separately and in the order in which they have been entered. These are
+   * used to determine how sections are nested.
+   */
+  std::map<std::thread::id, std::vector<std::string>> active_sections_of_thread;
+
   /**
    * mpi communicator
    */
@@ -882,9 +1008,10 @@ private:
 
   /**
    * A lock that makes sure that this class gives reasonable results even when
-   * used with several threads.
+   * used with several threads. It is mutable so that functions that only read
+   * the collected information, like write_trace(), can acquire it as well.
    */
-  Threads::Mutex mutex;
+  mutable Threads::Mutex mutex;
 };
 
 
@@ -18,6 +18,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
 #include <deal.II/base/types.h>
 
 #include <boost/archive/binary_iarchive.hpp>
@@ -31,6 +32,8 @@
 #include <boost/serialization/vector.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <string>
 #include <tuple>
@@ -45,11 +48,17 @@
 
 DEAL_II_NAMESPACE_OPEN
 
-// forward declare Point
+// forward declare Point, Vector, and ArrayView
 #ifndef DOXYGEN
 template <int dim, typename Number>
 DEAL_II_CXX20_REQUIRES(dim >= 0)
 class Point;
+
+template <typename Number>
+class Vector;
+
+template <typename ElementType, typename MemorySpaceType>
+class ArrayView;
 #endif
 
 /**
@@ -537,15 +546,22 @@ namespace Utilities
    *
    * This function considers a number of special cases for which packing (and
    * unpacking) can be simplified. These are:
-   * - If the object of type `T` is relatively small (less than 256 bytes) and
-   *   if `T` satisfies `std::is_trivially_copyable`, then it is copied bit
-   *   by bit into the output buffer.
+   * - If the object of type `T` satisfies `std::is_trivially_copyable`, and
+   *   if it is either relatively small (less than 256 bytes) or no
+   *   compression is requested, then it is copied bit by bit into the output
+   *   buffer. This includes, for example, objects of type Point and Tensor.
+   *   Objects of 256 bytes or more are preceded by a tag that identifies
+   *   this layout, see below.
    * - If no compression is requested, and if the object is a vector of objects
    *   whose type `T` satisfies `std::is_trivially_copyable`, then packing
    *   implies copying the length of the vector into the destination buffer
    *   followed by a bit-by-bit copy of the contents of the vector. A
    *   similar process is used for vectors of vectors of objects whose type
-   *   `T` satisfies `std::is_trivially_copyable`.
+   *   `T` satisfies `std::is_trivially_copyable`, and for objects of type
+   *   Vector whose elements satisfy this property, where the length is
+   *   preceded by a tag that identifies this layout. The contents of
+   *   the buffer created for a vector can also be accessed without copying
+   *   them via the unpack_to_array_view() function.
    * - Finally, if the type `T` of the object to be packed is std::tuple<>
    *   (i.e., a tuple without any elements as indicated by the empty argument
    *   list) and if no compression is requested, then this
@@ -560,6 +576,14 @@ namespace Utilities
    *   empty output buffer, given that many deal.II functions send objects
    *   only after calling pack() to serialize them.
    *
+   * Previous versions of the library serialized trivially copyable objects
+   * of 256 bytes or more, as well as objects of type Vector, via
+   * boost::serialization also when no compression was requested. Since such
+   * buffers may have been stored in files, for example by
+   * Triangulation::save() for data attached to cells, unpack() recognizes
+   * buffers without the tag mentioned above and reads them in the old
+   * format.
+   *
    * In several of the special cases above, the `std::is_trivially_copyable`
    * property is important, see
    * https://en.cppreference.com/w/cpp/types/is_trivially_copyable .
@@ -694,6 +718,32 @@ namespace Utilities
          T (&unpacked_object)[N],
          const bool allow_compression = true);
 
+  /**
+   * Given a range of characters that has been created by calling
+   * Utilities::pack() without compression on an object of type
+   * `std::vector<T>` or `Vector<T>`, where `T` satisfies
+   * `std::is_trivially_copyable`, return a view to the elements stored in
+   * the buffer. In contrast to unpack(), this function does not copy the
+   * elements, which makes it possible to read the data directly from, for
+   * example, the buffer into which an MPI message has been received. The
+   * view is only valid as long as the buffer is alive and not modified.
+   * Buffers that earlier versions of the library created for objects of
+   * type Vector via boost::serialization can not be accessed in this way.
+   *
+   * Since the elements are accessed in place, they need to be properly
+   * aligned in memory. This is the case if @p cbegin points to the beginning
+   * of a std::vector<char> (whose memory is aligned for all fundamental
+   * types), and the elements are not over-aligned. An exception is thrown if
+   * the elements are not aligned; in this case, use unpack() instead.
+   *
+   * @note To use this function, you need to include the header
+   * `deal.II/base/array_view.h`.
+   */
+  template <typename T>
+  ArrayView<const T, MemorySpace::Host>
+  unpack_to_array_view(const std::vector<char>::const_iterator &cbegin,
+                       const std::vector<char>::const_iterator &cend);
+
   /**
    * Check if the bit at position @p n in @p number is set.
    */
@@ -1168,6 +1218,179 @@ namespace Utilities
 
 
 
+    template <typename Number>
+    struct IsVectorOfTriviallyCopyable<Vector<Number>>
+    {
+      static constexpr bool value = std::is_trivially_copyable_v<Number>;
+    };
+
+
+
+    /**
+     * A tag that pack() writes in front of the bit-by-bit copies of those
+     * objects that earlier versions of the library serialized via
+     * boost::serialization even if no compression was requested, i.e.,
+     * trivially copyable objects of 256 bytes or more and objects of type
+     * Vector. It allows unpack() to distinguish these buffers from the ones
+     * created by earlier versions, which may still be around in checkpoint
+     * files: a binary boost archive starts with the length of its signature
+     * string, i.e., a small number. The tag has its highest bit set, so it
+     * can also not be confused with the length of a std::vector that starts
+     * the buffer of such a vector. The lowest bits of the tag hold the
+     * version of the layout.
+     */
+    inline constexpr std::uint64_t flat_buffer_format_tag =
+      0xdea1'f1a7'0000'0001;
+
+
+
+    /**
+     * Append flat_buffer_format_tag to a character array.
+     */
+    inline void
+    append_flat_buffer_format_tag(std::vector<char> &dest_buffer)
+    {
+      dest_buffer.insert(dest_buffer.end(),
+                         reinterpret_cast<const char *>(
+                           &flat_buffer_format_tag),
+                         reinterpret_cast<const char *>(
+                           &flat_buffer_format_tag + 1));
+    }
+
+
+
+    /**
+     * Return whether the given range of characters starts with
+     * flat_buffer_format_tag.
+     */
+    inline bool
+    has_flat_buffer_format_tag(const std::vector<char>::const_iterator &cbegin,
+                               const std::vector<char>::const_iterator &cend)
+    {
+      if (static_cast<std::size_t>(std::distance(cbegin, cend)) <
+          sizeof(flat_buffer_format_tag))
+        return false;
+
+      std::uint64_t tag;
+      std::memcpy(&tag, &*cbegin, sizeof(tag));
+      return (tag == flat_buffer_format_tag);
+    }
+
+
+
+    /**
+     * Deserialize an object from a range of characters that contains a
+     * binary boost archive, decompressing it first if @p allow_compression
+     * is set.
+     */
+    template <typename T>
+    inline void
+    unpack_from_archive(const std::vector<char>::const_iterator &cbegin,
+                        const std::vector<char>::const_iterator &cend,
+                        T                                       &object,
+                        const bool allow_compression)
+    {
+      // decompress the buffer section into the object
+      boost::iostreams::filtering_istreambuf fisb;
+#ifdef DEAL_II_WITH_ZLIB
+      if (allow_compression)
+        fisb.push(boost::iostreams::gzip_decompressor());
+#else
+      (void)allow_compression;
+#endif
+      fisb.push(boost::iostreams::array_source(&*cbegin, cend - cbegin));
+
+      boost::archive::binary_iarchive bia(fisb);
+      bia >> object;
+    }
+
+
+
+    /**
+     * A function that is used to append an object of type T that satisfies
+     * std::is_trivially_copyable_v<T> == true bit for bit to a character
+     * array. The empty type std::tuple<> is appended as a zero byte sequence.
+     *
+     * If the type is not trivially copyable, then the function throws an
+     * exception.
+     */
+    template <typename T>
+    inline void
+    append_trivially_copyable_to_buffer(const T           &object,
+                                        std::vector<char> &dest_buffer)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+        {
+          // Determine the size. There are places where we would like to use
+          // a truly empty type, for which we use std::tuple<> (i.e., a tuple
+          // of zero elements). For this class, the compiler reports a nonzero
+          // sizeof(...) because that is the minimum possible for objects --
+          // objects need to have distinct addresses, so they need to have a
+          // size of at least one. But we can special case this situation.
+          const std::size_t size =
+            (std::is_same_v<T, std::tuple<>> ? 0 : sizeof(T));
+
+          const std::size_t previous_size = dest_buffer.size();
+          dest_buffer.resize(previous_size + size);
+
+          if (size > 0)
+            std::memcpy(dest_buffer.data() + previous_size, &object, size);
+        }
+      else
+        {
+          (void)object;
+          (void)dest_buffer;
+
+          // We shouldn't get here:
+          DEAL_II_ASSERT_UNREACHABLE();
+        }
+    }
+
+
+
+    /**
+     * The inverse of the previous function: Copy the contents of the given
+     * range of characters bit for bit into an object of type T that satisfies
+     * std::is_trivially_copyable_v<T> == true.
+     *
+     * If the type is not trivially copyable, then the function throws an
+     * exception.
+     */
+    template <typename T>
+    inline void
+    copy_trivially_copyable_from_buffer(
+      const std::vector<char>::const_iterator &cbegin,
+      const std::vector<char>::const_iterator &cend,
+      T                                       &object)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+        {
+          const std::size_t size =
+            (std::is_same_v<T, std::tuple<>> ? 0 : sizeof(T));
+
+          // Make sure that we do not read past the end of the buffer, which
+          // happens if the buffer has been created with a different value of
+          // the 'allow_compression' flag than used for unpacking.
+          AssertThrow(static_cast<std::size_t>(std::distance(cbegin, cend)) ==
+                        size,
+                      ExcMessage("The given buffer has the wrong size."));
+
+          if (size > 0)
+            std::memcpy(&object, &*cbegin, size);
+        }
+      else
+        {
+          (void)cbegin;
+          (void)cend;
+          (void)object;
+
+          // We shouldn't get here:
+          DEAL_II_ASSERT_UNREACHABLE();
+        }
+    }
+
+
+
     /**
      * A function that is used to append the contents of a std::vector<T>
      * (where T is a type that satisfies std::is_trivially_copyable_v<T>
@@ -1264,6 +1487,35 @@ namespace Utilities
 
 
 
+    template <typename Number,
+              typename = std::enable_if_t<std::is_trivially_copyable_v<Number>>>
+    inline void
+    append_vector_of_trivially_copyable_to_buffer(
+      const Vector<Number> &object,
+      std::vector<char>    &dest_buffer)
+    {
+      // Use the same layout as for std::vector<Number>, preceded by the tag
+      // that distinguishes the buffer from a boost archive
+      const typename std::vector<Number>::size_type vector_size =
+        object.size();
+
+      dest_buffer.reserve(dest_buffer.size() + sizeof(flat_buffer_format_tag) +
+                          sizeof(vector_size) + vector_size * sizeof(Number));
+
+      append_flat_buffer_format_tag(dest_buffer);
+
+      dest_buffer.insert(dest_buffer.end(),
+                         reinterpret_cast<const char *>(&vector_size),
+                         reinterpret_cast<const char *>(&vector_size + 1));
+
+      if (vector_size > 0)
+        dest_buffer.insert(dest_buffer.end(),
+                           reinterpret_cast<const char *>(object.begin()),
+                           reinterpret_cast<const char *>(object.end()));
+    }
+
+
+
     template <typename T>
     inline void
     create_vector_of_trivially_copyable_from_buffer(
@@ -1373,6 +1625,45 @@ namespace Utilities
              ExcMessage("The given buffer has the wrong size."));
     }
 
+
+
+    template <typename Number,
+              typename = std::enable_if_t<std::is_trivially_copyable_v<Number>>>
+    inline void
+    create_vector_of_trivially_copyable_from_buffer(
+      const std::vector<char>::const_iterator &cbegin,
+      const std::vector<char>::const_iterator &cend,
+      Vector<Number>                          &object)
+    {
+      // Buffers without the tag have been created by earlier versions of
+      // the library via boost::serialization
+      if (has_flat_buffer_format_tag(cbegin, cend) == false)
+        {
+          unpack_from_archive(cbegin, cend, object, false);
+          return;
+        }
+
+      const auto vector_begin = cbegin + sizeof(flat_buffer_format_tag);
+
+      typename std::vector<Number>::size_type vector_size;
+      AssertThrow(static_cast<std::size_t>(cend - vector_begin) >=
+                    sizeof(vector_size),
+                  ExcMessage("The given buffer has the wrong size."));
+      std::memcpy(&vector_size, &*vector_begin, sizeof(vector_size));
+
+      AssertThrow(static_cast<std::size_t>(cend - vector_begin) ==
+                    sizeof(vector_size) + vector_size * sizeof(Number),
+                  ExcMessage("The given buffer has the wrong size."));
+
+      // Unlike std::vector, we can avoid initializing the elements before
+      // overwriting them
+      object.reinit(vector_size, /*omit_zeroing_entries=*/true);
+      if (vector_size > 0)
+        std::memcpy(object.begin(),
+                    &*vector_begin + sizeof(vector_size),
+                    vector_size * sizeof(Number));
+    }
+
   } // namespace internal
 
 
@@ -1391,20 +1682,24 @@ namespace Utilities
     // serialization machinery
     if constexpr (std::is_trivially_copyable<T>() && sizeof(T) < 256)
       {
-        // Determine the size. There are places where we would like to use a
-        // truly empty type, for which we use std::tuple<> (i.e., a tuple
-        // of zero elements). For this class, the compiler reports a nonzero
-        // sizeof(...) because that is the minimum possible for objects --
-        // objects need to have distinct addresses, so they need to have a size
-        // of at least one. But we can special case this situation.
-        size = (std::is_same_v<T, std::tuple<>> ? 0 : sizeof(T));
-
         (void)allow_compression;
         const std::size_t previous_size = dest_buffer.size();
-        dest_buffer.resize(previous_size + size);
-
-        if (size > 0)
-          std::memcpy(dest_buffer.data() + previous_size, &object, size);
+        internal::append_trivially_copyable_to_buffer(object, dest_buffer);
+        size = dest_buffer.size() - previous_size;
+      }
+    // Larger trivially copyable objects are also copied bit for bit,
+    // unless we are asked to compress them. Earlier versions of the
+    // library used the BOOST serialization machinery for them, so we
+    // need to precede the data by a tag that identifies the layout.
+    else if (std::is_trivially_copyable<T>() && (allow_compression == false))
+      {
+        const std::size_t previous_size = dest_buffer.size();
+        dest_buffer.reserve(previous_size +
+                            sizeof(internal::flat_buffer_format_tag) +
+                            sizeof(T));
+        internal::append_flat_buffer_format_tag(dest_buffer);
+        internal::append_trivially_copyable_to_buffer(object, dest_buffer);
+        size = dest_buffer.size() - previous_size;
       }
     // Next try if we have a vector of trivially copyable objects.
     // If that is the case, we can shortcut the whole BOOST serialization
@@ -1474,25 +1769,26 @@ namespace Utilities
     // serialization machinery
     if constexpr (std::is_trivially_copyable<T>() && sizeof(T) < 256)
       {
-        // Determine the size. There are places where we would like to use a
-        // truly empty type, for which we use std::tuple<> (i.e., a tuple
-        // of zero elements). For this class, the compiler reports a nonzero
-        // sizeof(...) because that is the minimum possible for objects --
-        // objects need to have distinct addresses, so they need to have a size
-        // of at least one. But we can special case this situation.
-        const std::size_t size =
-          (std::is_same_v<T, std::tuple<>> ? 0 : sizeof(T));
-
         T object;
 
         (void)allow_compression;
-        Assert(std::distance(cbegin, cend) == size, ExcInternalError());
-
-        if (size > 0)
-          std::memcpy(&object, &*cbegin, size);
+        internal::copy_trivially_copyable_from_buffer(cbegin, cend, object);
 
         return object;
       }
+    // Larger trivially copyable objects have been copied bit for bit,
+    // unless compression was requested or the buffer has been created by
+    // an earlier version of the library that did not write the tag.
+    else if (std::is_trivially_copyable<T>() && (allow_compression == false))
+      {
+        T object;
+        if (internal::has_flat_buffer_format_tag(cbegin, cend))
+          internal::copy_trivially_copyable_from_buffer(
+            cbegin + sizeof(internal::flat_buffer_format_tag), cend, object);
+        else
+          internal::unpack_from_archive(cbegin, cend, object, false);
+        return object;
+      }
     // Next try if we have a vector of trivially copyable objects.
     // If that is the case, we can shortcut the whole BOOST serialization
     // machinery and just copy the content of the buffer bit for bit
@@ -1513,20 +1809,8 @@ namespace Utilities
       }
     else
       {
-        // decompress the buffer section into the object
-        boost::iostreams::filtering_istreambuf fisb;
-#ifdef DEAL_II_WITH_ZLIB
-        if (allow_compression)
-          fisb.push(boost::iostreams::gzip_decompressor());
-#else
-        (void)allow_compression;
-#endif
-        fisb.push(boost::iostreams::array_source(&*cbegin, cend - cbegin));
-
-        boost::archive::binary_iarchive bia(fisb);
-
         T object;
-        bia >> object;
+        internal::unpack_from_archive(cbegin, cend, object, allow_compression);
         return object;
       }
 
@@ -1554,24 +1838,25 @@ namespace Utilities
     // serialization machinery
     if constexpr (std::is_trivially_copyable<T>() && sizeof(T) * N < 256)
       {
-        Assert(std::distance(cbegin, cend) == sizeof(T) * N,
-               ExcInternalError());
-        std::memcpy(unpacked_object, &*cbegin, sizeof(T) * N);
+        (void)allow_compression;
+        internal::copy_trivially_copyable_from_buffer(cbegin,
+                                                      cend,
+                                                      unpacked_object);
+      }
+    else if (std::is_trivially_copyable<T>() && (allow_compression == false) &&
+             internal::has_flat_buffer_format_tag(cbegin, cend))
+      {
+        internal::copy_trivially_copyable_from_buffer(
+          cbegin + sizeof(internal::flat_buffer_format_tag),
+          cend,
+          unpacked_object);
       }
     else
       {
-        // decompress the buffer section into the object
-        boost::iostreams::filtering_istreambuf fisb;
-#ifdef DEAL_II_WITH_ZLIB
-        if (allow_compression)
-          fisb.push(boost::iostreams::gzip_decompressor());
-#else
-        (void)allow_compression;
-#endif
-        fisb.push(boost::iostreams::array_source(&*cbegin, cend - cbegin));
-
-        boost::archive::binary_iarchive bia(fisb);
-        bia >> unpacked_object;
+        internal::unpack_from_archive(cbegin,
+                                      cend,
+                                      unpacked_object,
+                                      allow_compression);
       }
   }
 
@@ -1590,6 +1875,49 @@ namespace Utilities
 
 
 
+  template <typename T>
+  ArrayView<const T, MemorySpace::Host>
+  unpack_to_array_view(const std::vector<char>::const_iterator &cbegin,
+                       const std::vector<char>::const_iterator &cend)
+  {
+    static_assert(std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>,
+                  "This function can only be used for vectors of trivially "
+                  "copyable types.");
+
+    // Buffers created for objects of type Vector start with a tag, which
+    // can not be confused with the length of a std::vector
+    const auto vector_begin =
+      (internal::has_flat_buffer_format_tag(cbegin, cend) ?
+         cbegin + sizeof(internal::flat_buffer_format_tag) :
+         cbegin);
+
+    // Get the size of the vector, and then check that the buffer indeed
+    // has the layout created by pack()
+    typename std::vector<T>::size_type vector_size;
+    AssertThrow(static_cast<std::size_t>(std::distance(vector_begin, cend)) >=
+                  sizeof(vector_size),
+                ExcMessage("The given buffer has the wrong size."));
+    std::memcpy(&vector_size, &*vector_begin, sizeof(vector_size));
+
+    AssertThrow(static_cast<std::size_t>(std::distance(vector_begin, cend)) ==
+                  sizeof(vector_size) + vector_size * sizeof(T),
+                ExcMessage("The given buffer has the wrong size."));
+
+    if (vector_size == 0)
+      return ArrayView<const T, MemorySpace::Host>();
+
+    const char *data = &*vector_begin + sizeof(vector_size);
+    AssertThrow(reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0,
+                ExcMessage("The elements stored in the given buffer are not "
+                           "properly aligned to be accessed in place. Use "
+                           "Utilities::unpack() instead."));
+
+    return ArrayView<const T, MemorySpace::Host>(
+      reinterpret_cast<const T *>(data), vector_size);
+  }
+
+
+
   inline bool
   get_bit(const unsigned char number, const unsigned int n)
   {
@@ -17,12 +17,18 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/observer_pointer.h>
+
 #include <deal.II/distributed/tria_base.h>
 
 #include <deal.II/dofs/dof_handler.h>
 
 #include <boost/signals2/connection.hpp>
 
+#include <chrono>
+#include <functional>
+#include <vector>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -229,6 +235,305 @@ namespace parallel
       const parallel::TriangulationBase<dim, spacedim> &triangulation,
       const WeightingFunction                          &weighting_function);
   };
+
+
+
+  /**
+   * A class that determines the weights of cells for load balancing from
+   * measured computational costs, rather than from a model of the cost as
+   * done by CellWeights.
+   *
+   * In hp-adaptive or multiphysics computations, the cost of the work done on
+   * a cell is often difficult to predict and may change over time. This class
+   * collects the cost of each locally owned cell (typically the compute time
+   * spent on it) as measured by the user code during a time step or nonlinear
+   * iteration, and smooths the measurements over several steps with an
+   * exponential moving average: Upon finish_step(), the estimate $c_K$ of the
+   * cost of cell $K$ is updated as
+   * @f[
+   *   c_K \leftarrow (1-\alpha) c_K + \alpha m_K,
+   * @f]
+   * where $m_K$ is the cost measured on $K$ during the last step and
+   * $\alpha$ is the smoothing factor given in AdditionalData. Cells on which
+   * no cost was recorded during a step keep their previous estimate.
+   *
+   * For a parallel::distributed::Triangulation, the object connects itself
+   * to the Triangulation::Signals::weight signal, so that the smoothed
+   * estimates are used whenever the triangulation is repartitioned. For
+   * other triangulations, the function returned by make_weighting_callback()
+   * can be connected to that signal manually (e.g., for a
+   * parallel::shared::Triangulation partitioned with METIS) or be passed to
+   * RepartitioningPolicyTools::CellWeightPolicy. The estimates are converted
+   * to integer weights relative to the global average cost of a cell, which
+   * is given the weight AdditionalData::weight_scale. Cells for which no
+   * estimate is available yet are given the average weight.
+   *
+   * Since repartitioning has a cost of its own, finish_step() also computes
+   * the load imbalance, i.e., the ratio between the largest and the average
+   * estimated cost of the locally owned cells of a process, and
+   * needs_repartitioning() only returns true if it exceeds the threshold set
+   * in AdditionalData. A typical use in a time loop with a
+   * parallel::distributed::Triangulation looks as follows:
+   * @code
+   * parallel::MeasuredCellWeights<dim> cell_weights(triangulation);
+   *
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     for (const auto &cell : dof_handler.active_cell_iterators())
+   *       if (cell->is_locally_owned())
+   *         {
+   *           typename parallel::MeasuredCellWeights<dim>::ScopedCellTimer
+   *             timer(cell_weights, cell);
+   *           ... // assemble on this cell
+   *         }
+   *
+   *     cell_weights.finish_step();
+   *     if (cell_weights.repartition_if_imbalanced())
+   *       ... // redistribute DoFs and transfer the solution
+   *   }
+   * @endcode
+   * Instead of ScopedCellTimer, costs can also be recorded with add_cost(),
+   * e.g., in WorkStream workers (where concurrent calls for different cells
+   * are safe) or for the cells of a cell batch of MatrixFree, whose cost is
+   * then distributed evenly over the cells:
+   * @code
+   * std::vector<typename Triangulation<dim>::cell_iterator> cells;
+   * for (unsigned int v = 0;
+   *      v < matrix_free.n_active_entries_per_cell_batch(batch);
+   *      ++v)
+   *   cells.push_back(matrix_free.get_cell_iterator(batch, v));
+   * cell_weights.add_cost(cells, seconds_spent_on_batch);
+   * @endcode
+   *
+   * Whenever the mesh changes, the estimates of all cells are discarded,
+   * with the exception of repartition_if_imbalanced(), which moves the
+   * estimates along with the cells to their new owners.
+   *
+   * @ingroup distributed
+   */
+  template <int dim, int spacedim = dim>
+  class MeasuredCellWeights
+  {
+  public:
+    /**
+     * Parameters controlling the smoothing of the measurements and the
+     * decision whether to repartition.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor.
+       */
+      AdditionalData(const double       smoothing_factor    = 0.3,
+                     const double       imbalance_threshold = 1.1,
+                     const unsigned int weight_scale        = 1000);
+
+      /**
+       * The weight $\alpha\in(0,1]$ of the latest measurement in the
+       * exponential moving average. A value of one only uses the latest
+       * measurement.
+       */
+      double smoothing_factor;
+
+      /**
+       * needs_repartitioning() returns true if the ratio between the largest
+       * and the average cost of the processes exceeds this value.
+       */
+      double imbalance_threshold;
+
+      /**
+       * The weight given to a cell with the average cost.
+       */
+      unsigned int weight_scale;
+    };
+
+    /**
+     * A class that measures the wall time between its construction and
+     * destruction and adds it to the cost of the given cell(s) via
+     * add_cost().
+     */
+    class ScopedCellTimer
+    {
+    public:
+      /**
+       * Constructor. Start measuring the time spent on @p cell.
+       */
+      ScopedCellTimer(
+        MeasuredCellWeights<dim, spacedim>                        &weights,
+        const typename Triangulation<dim, spacedim>::cell_iterator &cell);
+
+      /**
+       * Constructor. Start measuring the time spent on all the @p cells,
+       * e.g., the cells of a cell batch of MatrixFree.
+       */
+      ScopedCellTimer(
+        MeasuredCellWeights<dim, spacedim> &weights,
+        const std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+          &cells);
+
+      /**
+       * Destructor. Add the elapsed time to the cost of the cell(s).
+       */
+      ~ScopedCellTimer();
+
+    private:
+      MeasuredCellWeights<dim, spacedim> &weights;
+
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator> cells;
+
+      const std::chrono::steady_clock::time_point start;
+    };
+
+    /**
+     * Constructor. If @p triangulation is a
+     * parallel::distributed::Triangulation, connect to its weight signal.
+     */
+    MeasuredCellWeights(
+      parallel::TriangulationBase<dim, spacedim> &triangulation,
+      const AdditionalData                       &additional_data = {});
+
+    /**
+     * Destructor. Disconnect from the signals of the triangulation.
+     */
+    ~MeasuredCellWeights();
+
+    /**
+     * Add @p cost to the cost measured on the active, locally owned @p cell
+     * during the current step. This function may be called concurrently
+     * from several threads as long as the cells are different.
+     */
+    void
+    add_cost(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+             const double                                                cost);
+
+    /**
+     * Distribute @p cost evenly over the given active, locally owned
+     * @p cells, e.g., the cells of a cell batch of MatrixFree.
+     */
+    void
+    add_cost(
+      const std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+                  &cells,
+      const double cost);
+
+    /**
+     * Conclude the current step: fold the costs measured since the last call
+     * into the smoothed estimates and update the global average cost and the
+     * load imbalance.
+     *
+     * This is a collective operation that must be called on all processes.
+     */
+    void
+    finish_step();
+
+    /**
+     * Return the smoothed estimate of the cost of the active, locally owned
+     * @p cell, or a negative number if no cost has been recorded for it yet.
+     */
+    double
+    get_cost_estimate(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
+
+    /**
+     * Return the load imbalance computed in the last call of finish_step(),
+     * i.e., the largest estimated cost of the locally owned cells of a
+     * process divided by the average over all processes.
+     */
+    double
+    get_imbalance() const;
+
+    /**
+     * Return whether the load imbalance exceeds
+     * AdditionalData::imbalance_threshold. Since the imbalance is a global
+     * quantity, the result is the same on all processes.
+     */
+    bool
+    needs_repartitioning() const;
+
+    /**
+     * If needs_repartitioning() returns true, repartition the triangulation
+     * with the measured weights and return true, otherwise return false. The
+     * estimates are moved with the cells to their new owners.
+     *
+     * This is a collective operation. It is only implemented for
+     * parallel::distributed::Triangulation; for other triangulations, use
+     * make_weighting_callback() with
+     * RepartitioningPolicyTools::CellWeightPolicy.
+     */
+    bool
+    repartition_if_imbalanced();
+
+    /**
+     * Return the weight of @p cell as determined from the smoothed
+     * estimates. The arguments are those of Triangulation::Signals::weight.
+     */
+    unsigned int
+    weight(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+           const CellStatus status) const;
+
+    /**
+     * Return a function that calls weight(), e.g., to be passed to
+     * RepartitioningPolicyTools::CellWeightPolicy. This object must outlive
+     * the returned function.
+     */
+    std::function<unsigned int(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+      const CellStatus status)>
+    make_weighting_callback() const;
+
+  private:
+    /**
+     * Discard all measurements and estimates, and adjust the size of the
+     * vectors to the current number of active cells.
+     */
+    void
+    reset();
+
+    /**
+     * Return the estimate of an active cell, or the average cost if none is
+     * available.
+     */
+    double
+    estimate_or_average(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
+
+    /**
+     * The triangulation whose cells are weighted.
+     */
+    ObserverPointer<parallel::TriangulationBase<dim, spacedim>> triangulation;
+
+    /**
+     * Parameters.
+     */
+    const AdditionalData additional_data;
+
+    /**
+     * The costs measured during the current step, indexed by the active cell
+     * index.
+     */
+    std::vector<double> measured_costs;
+
+    /**
+     * The smoothed estimates of the costs, indexed by the active cell index,
+     * with negative values for cells without an estimate.
+     */
+    std::vector<double> estimated_costs;
+
+    /**
+     * The global average of the estimated cost of a cell.
+     */
+    double average_cost;
+
+    /**
+     * The load imbalance computed in finish_step().
+     */
+    double imbalance;
+
+    /**
+     * Connections to the signals of the triangulation.
+     */
+    std::vector<boost::signals2::connection> connections;
+  };
 } // namespace parallel
 
 
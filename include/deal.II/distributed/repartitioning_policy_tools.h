@@ -177,6 +177,92 @@ namespace RepartitioningPolicyTools
       weighting_function;
   };
 
+  /**
+   * A policy that takes the topology of the machine into account by
+   * partitioning the mesh hierarchically: the active cells are first split
+   * among the compute nodes, and the cells of each node are then split evenly
+   * among the processes of that node.
+   *
+   * Both splits are done into contiguous ranges of the global active cell
+   * index, which follows a space-filling curve for
+   * parallel::distributed::Triangulation and for
+   * parallel::fullydistributed::Triangulation objects created from one. Each
+   * node initially gets a share of the cells proportional to the number of
+   * processes running on it. The boundaries between the ranges of the nodes
+   * are then moved, by at most the fraction `max_node_imbalance` of the
+   * cells of the adjacent nodes, to the positions where the fewest faces
+   * between cells are cut. This reduces the ghost exchange between nodes
+   * also if consecutive ranks already run on the same node, whereas the
+   * boundaries between the processes of a node are left at the balanced
+   * positions, since the ghost exchange among them can go through shared
+   * memory.
+   *
+   * If the processes are not placed in blocks of consecutive ranks on the
+   * nodes, e.g., round-robin, the grouping by node in addition ensures that
+   * the ranges of the processes of a node are adjacent, whereas the other
+   * policies and the default partitioning assign consecutive ranges to
+   * consecutive ranks, irrespective of the nodes these ranks run on. The
+   * effect of a partitioning can be measured by count_ghost_cells().
+   *
+   * To find the positions with the fewest cut faces, each process stores an
+   * integer for each candidate position, i.e., about
+   * `2 * max_node_imbalance` times the number of global active cells in
+   * total, and these are summed over all processes.
+   */
+  template <int dim, int spacedim = dim>
+  class NodeAwarePolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor. The processes running on the same node are determined by
+     * splitting the communicator of the triangulation with
+     * `MPI_Comm_split_type(..., MPI_COMM_TYPE_SHARED, ...)`.
+     *
+     * @param max_node_imbalance The fraction of the cells of a node by which
+     *   the boundaries between nodes may be moved to cut fewer faces. It has
+     *   to be in the range [0, 0.5); zero gives a balanced split.
+     */
+    NodeAwarePolicy(const double max_node_imbalance = 0.05);
+
+    /**
+     * Constructor taking the index of the node of each process of the
+     * communicator of the triangulations to be partitioned. This allows to
+     * group processes differently than by shared-memory nodes, e.g., by
+     * sockets or racks. See the other constructor for @p max_node_imbalance.
+     */
+    NodeAwarePolicy(const std::vector<unsigned int> &node_of_process,
+                    const double                     max_node_imbalance = 0.05);
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+    /**
+     * Return the number of ghost cells of @p tria whose owner runs on the
+     * same node as the process itself (first entry) and on a different node
+     * (second entry), summed over all processes.
+     */
+    std::pair<types::global_cell_index, types::global_cell_index>
+    count_ghost_cells(const Triangulation<dim, spacedim> &tria) const;
+
+  private:
+    /**
+     * Return the index of the node of each process of @p communicator.
+     */
+    std::vector<unsigned int>
+    get_node_of_process(const MPI_Comm communicator) const;
+
+    /**
+     * The node indices given to the constructor, if any.
+     */
+    const std::vector<unsigned int> node_of_process;
+
+    /**
+     * The fraction of the cells of a node by which the boundaries between
+     * nodes may be moved.
+     */
+    const double max_node_imbalance;
+  };
+
 } // namespace RepartitioningPolicyTools
 
 DEAL_II_NAMESPACE_CLOSE
@@ -284,6 +284,15 @@ namespace parallel
       virtual void
       execute_coarsening_and_refinement() override;
 
+      /**
+       * Renumber the cells along a space-filling curve, see
+       * dealii::Triangulation::renumber_cells_along_space_filling_curve().
+       *
+       * This function also re-partitions the triangulation afterwards.
+       */
+      virtual void
+      renumber_cells_along_space_filling_curve() override;
+
       /**
        * Create a triangulation.
        *
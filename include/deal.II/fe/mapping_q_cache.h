@@ -23,11 +23,15 @@
 
 #include <deal.II/fe/mapping_q.h>
 
+#include <deal.II/grid/cell_id.h>
 #include <deal.II/grid/tria.h>
 
 #include <boost/container/small_vector.hpp>
 #include <boost/signals2/connection.hpp>
 
+#include <map>
+#include <string>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -194,6 +198,71 @@ public:
              const MGLevelObject<VectorType> &vectors,
              const bool vector_describes_relative_displacement);
 
+  /**
+   * Write the mapping support points of all cells in the cache to disk, so
+   * that a later run can restore them with load() instead of recomputing
+   * them. This is useful if the evaluation of the support points is
+   * expensive, e.g., for geometries described by CAD-backed manifolds.
+   *
+   * The support points are stored keyed by the CellId of the cells, which
+   * makes the files independent of the internal order of the cells of
+   * @p triangulation. The latter must be the triangulation the cache has
+   * been initialized with. Similar to Triangulation::save(), two kinds of
+   * files are created: a file `file_basename + "_mapping_q_cache.info"`
+   * written by the first process that describes the content, and one file
+   * per MPI process of the communicator of @p triangulation, named
+   * `file_basename + "_mapping_q_cache_" + rank + ".data"`, that contains
+   * the support points of the locally owned and ghost cells of that process
+   * as well as of their ancestors. Along with the support points of each
+   * cell, a fingerprint of the state they depend on, namely the coordinates
+   * of the vertices of the cell and the manifold ids of the cell, its faces,
+   * and its lines, is stored. These files can be written next to the
+   * ones created by parallel::distributed::Triangulation::save() for
+   * checkpointing.
+   */
+  void
+  save(const Triangulation<dim, spacedim> &triangulation,
+       const std::string                  &file_basename) const;
+
+  /**
+   * Initialize the data cache in the same way as
+   * initialize(mapping, triangulation), except that the support points of
+   * all cells that are found in the files written by save() are taken from
+   * there, and only the support points of the remaining cells, such as the
+   * ones created by refinement after the files have been written, are
+   * computed by @p mapping.
+   *
+   * The triangulation must have been created from the same coarse mesh as
+   * the one the files were written for, and the cells found in the files
+   * must still be in the state they were saved in: if the vertices of any
+   * of them have been moved or their manifold ids have been changed since,
+   * the files describe a different triangulation and an exception is thrown
+   * on all processes. Cells that have been created or removed by refinement
+   * and coarsening after saving do not invalidate the files. If the files
+   * have been written with the same number of MPI processes, every process
+   * only reads its own file; otherwise, every process reads all files and
+   * picks the cells it needs.
+   *
+   * @note The cache is invalidated upon the signal
+   * Triangulation::Signals::any_change of the underlying triangulation.
+   */
+  void
+  load(const Mapping<dim, spacedim>       &mapping,
+       const Triangulation<dim, spacedim> &triangulation,
+       const std::string                  &file_basename);
+
+  /**
+   * The same as above but computing the support points of the cells not
+   * found in the files by the function @p compute_points_on_cell, with the
+   * same requirements as in the respective initialize() function.
+   */
+  void
+  load(const Triangulation<dim, spacedim> &triangulation,
+       const std::string                  &file_basename,
+       const std::function<std::vector<Point<spacedim>>(
+         const typename Triangulation<dim, spacedim>::cell_iterator &)>
+         &compute_points_on_cell);
+
   /**
    * @copydoc Mapping::get_vertices()
    */
@@ -223,6 +292,27 @@ protected:
     const override;
 
 private:
+  /**
+   * Read the support points written by save() into a map keyed by the
+   * CellId of the cells, after checking that the files match the
+   * current state of @p triangulation.
+   */
+  static std::map<CellId, std::vector<Point<spacedim>>>
+  read_support_points(const Triangulation<dim, spacedim> &triangulation,
+                      const std::string                  &file_basename,
+                      const unsigned int                  polynomial_degree);
+
+  /**
+   * Implementation of initialize(mapping, triangulation) that takes the
+   * support points of the cells found in @p stored_points from there
+   * instead of computing them.
+   */
+  void
+  initialize(
+    const Mapping<dim, spacedim>                         &mapping,
+    const Triangulation<dim, spacedim>                   &triangulation,
+    const std::map<CellId, std::vector<Point<spacedim>>> &stored_points);
+
   /**
    * The point cache filled upon calling initialize(). It is made a shared
    * pointer to allow several instances (created via clone()) to share this
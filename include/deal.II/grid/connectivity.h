@@ -18,13 +18,16 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/array_view.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/ndarray.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/grid/reference_cell.h>
 #include <deal.II/grid/tria_description.h>
 #include <deal.II/grid/tria_objects_orientations.h>
 
 #include <numeric>
+#include <unordered_set>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -995,6 +998,14 @@ namespace internal
      *
      * Furthermore, the function determines for each cell of which d-dimensional
      * entity it consists of and its orientation relative to the cell.
+     *
+     * The entities of the cells are matched via hash tables: the entities are
+     * distributed among a number of shards according to the hash of their
+     * (sorted) vertices, and each shard is processed independently, which
+     * allows to do the work in parallel. The entities are enumerated in
+     * the order given by @p second_key_function applied to the first
+     * occurrence of each entity, which ensures the same enumeration as in
+     * deal.II, independently of the number of threads.
      */
     template <int max_n_vertices, typename FU>
     void
@@ -1008,171 +1019,205 @@ namespace internal
       TriaObjectsOrientations                          &orientations, // result
       const FU                                         &second_key_function)
     {
-      const bool compatibility_mode = true;
+      using Key = std::array<unsigned int, max_n_vertices>;
 
       const std::vector<std::size_t>  &cell_ptr      = crs.ptr;
       const std::vector<unsigned int> &cell_vertices = crs.col;
       std::vector<std::size_t>        &ptr_d         = crs_d.ptr;
       std::vector<unsigned int>       &col_d         = crs_d.col;
-
-      // note: we do not pre-allocate memory for these arrays because it turned
-      // out that counting unique entities is more expensive than push_back().
-      std::vector<std::size_t>  &ptr_0 = crs_0.ptr;
-      std::vector<unsigned int> &col_0 = crs_0.col;
+      std::vector<std::size_t>        &ptr_0         = crs_0.ptr;
+      std::vector<unsigned int>       &col_0         = crs_0.col;
 
       // clear
       ptr_0 = {};
       col_0 = {};
 
-      unsigned int n_entities = 0;
+      const unsigned int n_cells = cell_types_index.size();
 
-      for (const auto &c : cell_types_index)
-        n_entities += cell_types[c]->n_entities(face_dimensionality);
-
-      // step 1: store each d-dimensional entity of a cell (described by their
-      // vertices) into a vector and create a key for them
-      //
-      // note: it turned out to be more efficient to have a vector of tuples
-      // than to have two vectors (sorting becomes inefficient)
-      std::vector<
-        std::tuple<std::array<unsigned int, max_n_vertices>, unsigned int>>
-        keys; // key (sorted vertices), cell-entity index
-
-      std::vector<std::array<unsigned int, max_n_vertices>> ad_entity_vertices;
-      std::vector<ReferenceCell>                            ad_entity_types;
-      std::vector<std::array<unsigned int, max_n_vertices>> ad_compatibility;
-
-      keys.reserve(n_entities);
-      ad_entity_vertices.reserve(n_entities);
-      ad_entity_types.reserve(n_entities);
-      ad_compatibility.reserve(n_entities);
-
-      ptr_d.resize(cell_types_index.size() + 1);
+      // step 1: determine the position of the d-dimensional entities of each
+      // cell in the list of all cell entities
+      ptr_d.resize(n_cells + 1);
       ptr_d[0] = 0;
+      for (unsigned int c = 0; c < n_cells; ++c)
+        ptr_d[c + 1] =
+          ptr_d[c] +
+          cell_types[cell_types_index[c]]->n_entities(face_dimensionality);
 
-      static const unsigned int offset = 1;
+      const unsigned int n_entities = ptr_d.back();
 
-      // loop over all cells
-      for (unsigned int c = 0, counter = 0; c < cell_types_index.size(); ++c)
-        {
-          const auto &cell_type = cell_types[cell_types_index[c]];
-          ptr_d[c + 1] = ptr_d[c] + cell_type->n_entities(face_dimensionality);
+      // step 2: store each d-dimensional entity of a cell (described by their
+      // vertices), create a key for it (the sorted vertices), and compute the
+      // hash of the key
+      std::vector<Key>           keys(n_entities);
+      std::vector<std::size_t>   hashes(n_entities);
+      std::vector<Key>           ad_entity_vertices(n_entities);
+      std::vector<ReferenceCell> ad_entity_types(n_entities);
 
-          // ... collect vertices of cell
-          const dealii::ArrayView<const unsigned int> local_vertices(
-            cell_vertices.data() + cell_ptr[c], cell_ptr[c + 1] - cell_ptr[c]);
+      static const unsigned int offset = 1;
 
-          // ... loop over all its entities
-          for (unsigned int e = 0;
-               e < cell_type->n_entities(face_dimensionality);
-               ++e)
+      dealii::parallel::apply_to_subranges(
+        0u,
+        n_cells,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int c = begin; c < end; ++c)
             {
-              // ... determine global entity vertices
-              const auto &local_entity_vertices =
-                cell_type->vertices_of_entity(face_dimensionality, e);
-
-              std::array<unsigned int, max_n_vertices> entity_vertices;
-              std::fill(entity_vertices.begin(), entity_vertices.end(), 0);
+              const auto &cell_type = cell_types[cell_types_index[c]];
 
-              for (unsigned int i = 0; i < local_entity_vertices.size(); ++i)
-                entity_vertices[i] =
-                  local_vertices[local_entity_vertices[i]] + offset;
-
-              // ... create key
-              std::array<unsigned int, max_n_vertices> key = entity_vertices;
-              std::sort(key.begin(), key.end());
-              keys.emplace_back(key, counter++);
-
-              ad_entity_vertices.emplace_back(entity_vertices);
-
-              ad_entity_types.emplace_back(
-                cell_type->type_of_entity(face_dimensionality, e));
-
-              if (compatibility_mode)
-                ad_compatibility.emplace_back(
-                  second_key_function(entity_vertices, cell_type, c, e));
-            }
-        }
-
-      col_d.resize(keys.size());
-      orientations.reinit(keys.size());
-
-      // step 2: sort according to key so that entities with same key can be
-      // merged
-      std::sort(keys.begin(), keys.end());
-
-
-      if (compatibility_mode)
-        {
-          unsigned int n_unique_entities        = 0;
-          unsigned int n_unique_entity_vertices = 0;
+              // ... collect vertices of cell
+              const dealii::ArrayView<const unsigned int> local_vertices(
+                cell_vertices.data() + cell_ptr[c],
+                cell_ptr[c + 1] - cell_ptr[c]);
 
-          std::array<unsigned int, max_n_vertices> ref_key, new_key;
-          std::fill(ref_key.begin(), ref_key.end(), 0);
-          for (unsigned int i = 0; i < keys.size(); ++i)
-            {
-              const auto offset_i = std::get<1>(keys[i]);
-
-              if (ref_key != std::get<0>(keys[i]))
+              // ... loop over all its entities
+              for (unsigned int e = 0, counter = ptr_d[c];
+                   e < cell_type->n_entities(face_dimensionality);
+                   ++e, ++counter)
                 {
-                  ref_key = std::get<0>(keys[i]);
-
-                  ++n_unique_entities;
-                  n_unique_entity_vertices +=
-                    cell_types[ad_entity_types[offset_i]]->n_entities(0);
-
-                  new_key = ad_compatibility[offset_i];
+                  // ... determine global entity vertices
+                  const auto &local_entity_vertices =
+                    cell_type->vertices_of_entity(face_dimensionality, e);
+
+                  Key &entity_vertices = ad_entity_vertices[counter];
+                  std::fill(entity_vertices.begin(), entity_vertices.end(), 0);
+
+                  for (unsigned int i = 0; i < local_entity_vertices.size();
+                       ++i)
+                    entity_vertices[i] =
+                      local_vertices[local_entity_vertices[i]] + offset;
+
+                  // ... create key and its hash
+                  Key &key = keys[counter];
+                  key      = entity_vertices;
+                  std::sort(key.begin(), key.end());
+
+                  std::size_t hash = 0;
+                  for (const unsigned int v : key)
+                    hash ^= std::hash<unsigned int>()(v) + 0x9e3779b9 +
+                            (hash << 6) + (hash >> 2);
+                  hashes[counter] = hash;
+
+                  ad_entity_types[counter] =
+                    cell_type->type_of_entity(face_dimensionality, e);
                 }
-
-              std::get<0>(keys[i]) = new_key;
             }
+        },
+        1000);
+
+      // step 3: for each entity, determine the first entity (in the order of
+      // the cells) with the same key. to this end, distribute the entities
+      // among shards according to their hash (keeping their order within
+      // each shard), and match the entities of each shard with a hash table
+      const unsigned int n_shards =
+        (n_entities < 10000 ? 1 : 8 * MultithreadInfo::n_threads());
+
+      std::vector<unsigned int> shard_ptr(n_shards + 1, 0);
+      for (unsigned int i = 0; i < n_entities; ++i)
+        ++shard_ptr[hashes[i] % n_shards + 1];
+      std::partial_sum(shard_ptr.begin(), shard_ptr.end(), shard_ptr.begin());
+
+      std::vector<unsigned int> shard_entities(n_entities);
+      {
+        std::vector<unsigned int> position(shard_ptr.begin(),
+                                           shard_ptr.end() - 1);
+        for (unsigned int i = 0; i < n_entities; ++i)
+          shard_entities[position[hashes[i] % n_shards]++] = i;
+      }
 
-          std::sort(keys.begin(), keys.end());
-
-          ptr_0.reserve(n_unique_entities + 1);
-          col_0.reserve(n_unique_entity_vertices);
-        }
+      std::vector<unsigned int> first_entity(n_entities);
+      dealii::parallel::apply_to_subranges(
+        0u,
+        n_shards,
+        [&](const unsigned int begin, const unsigned int end) {
+          const auto hash  = [&](const unsigned int i) { return hashes[i]; };
+          const auto equal = [&](const unsigned int i, const unsigned int j) {
+            return keys[i] == keys[j];
+          };
+
+          for (unsigned int shard = begin; shard < end; ++shard)
+            {
+              std::unordered_set<unsigned int, decltype(hash), decltype(equal)>
+                first_entities(shard_ptr[shard + 1] - shard_ptr[shard],
+                               hash,
+                               equal);
+              for (unsigned int k = shard_ptr[shard]; k < shard_ptr[shard + 1];
+                   ++k)
+                first_entity[shard_entities[k]] =
+                  *first_entities.insert(shard_entities[k]).first;
+            }
+        },
+        1);
+
+      // step 4: enumerate the unique entities, sorted according to the
+      // second key of their first occurrence (to ensure the same enumeration
+      // as in deal.II)
+      std::vector<std::pair<Key, unsigned int>> unique_entities;
+      for (unsigned int i = 0; i < n_entities; ++i)
+        if (first_entity[i] == i)
+          unique_entities.emplace_back(Key(), i);
+
+      dealii::parallel::apply_to_subranges(
+        0u,
+        static_cast<unsigned int>(unique_entities.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int k = begin; k < end; ++k)
+            {
+              const unsigned int i = unique_entities[k].second;
+              const unsigned int c =
+                std::upper_bound(ptr_d.begin(), ptr_d.end(), i) -
+                ptr_d.begin() - 1;
+              unique_entities[k].first =
+                second_key_function(ad_entity_vertices[i],
+                                    cell_types[cell_types_index[c]],
+                                    c,
+                                    i - ptr_d[c]);
+            }
+        },
+        1000);
 
+      std::sort(unique_entities.begin(), unique_entities.end());
 
-      std::array<unsigned int, max_n_vertices> ref_key;
-      std::array<unsigned int, max_n_vertices> ref_indices;
-      std::fill(ref_key.begin(), ref_key.end(), 0);
+      col_d.resize(n_entities);
+      orientations.reinit(n_entities);
 
-      unsigned int counter = dealii::numbers::invalid_unsigned_int;
-      for (unsigned int i = 0; i < keys.size(); i++)
+      ptr_0.reserve(unique_entities.size() + 1);
+      for (unsigned int k = 0; k < unique_entities.size(); ++k)
         {
-          const auto offset_i = std::get<1>(keys[i]);
+          const unsigned int i = unique_entities[k].second;
+          col_d[i]             = k;
 
-          if (ref_key != std::get<0>(keys[i]))
-            {
-              // new key: default orientation is correct
-              ++counter;
-              ref_key     = std::get<0>(keys[i]);
-              ref_indices = ad_entity_vertices[offset_i];
-
-              ptr_0.push_back(col_0.size());
-              for (const auto j : ad_entity_vertices[offset_i])
-                if (j != 0)
-                  col_0.push_back(j - offset);
-            }
-          else
+          ptr_0.push_back(col_0.size());
+          for (const auto j : ad_entity_vertices[i])
+            if (j != 0)
+              col_0.push_back(j - offset);
+        }
+      ptr_0.push_back(col_0.size());
+
+      // step 5: set the index of all other entities and their orientation
+      // relative to the first occurrence
+      dealii::parallel::apply_to_subranges(
+        0u,
+        n_entities,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
             {
-              // previously seen key: set orientation relative to the first
-              // occurrence
+              const unsigned int first = first_entity[i];
+              if (first == i)
+                continue;
+
+              col_d[i] = col_d[first];
               orientations.set_combined_orientation(
-                offset_i,
-                ad_entity_types[offset_i]
+                i,
+                ad_entity_types[i]
                   .template get_combined_orientation<unsigned int>(
-                    make_array_view(ad_entity_vertices[offset_i].begin(),
-                                    ad_entity_vertices[offset_i].begin() +
-                                      ad_entity_types[offset_i].n_vertices()),
-                    make_array_view(ref_indices.begin(),
-                                    ref_indices.begin() +
-                                      ad_entity_types[offset_i].n_vertices())));
+                    make_array_view(ad_entity_vertices[i].begin(),
+                                    ad_entity_vertices[i].begin() +
+                                      ad_entity_types[i].n_vertices()),
+                    make_array_view(ad_entity_vertices[first].begin(),
+                                    ad_entity_vertices[first].begin() +
+                                      ad_entity_types[i].n_vertices())));
             }
-          col_d[offset_i] = counter;
-        }
-      ptr_0.push_back(col_0.size());
+        },
+        1000);
     }
 
 
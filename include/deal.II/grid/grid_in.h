@@ -341,6 +341,8 @@ public:
     vtk,
     /// Use read_vtu()
     vtu,
+    /// Use read_binary()
+    binary,
     /// Use read_assimp()
     assimp,
     /// Use read_exodusii()
@@ -437,6 +439,29 @@ public:
   void
   read_vtu(std::istream &in);
 
+  /**
+   * Read a triangulation in the binary format written by
+   * GridOut::write_binary(). The file contains the coarse mesh as well as
+   * the refinement hierarchy, which is recreated by refining the coarse mesh
+   * level by level. Afterwards, all vertices are moved to their saved
+   * locations and the material, manifold, and boundary ids of all cells,
+   * faces, and lines are set to their saved values, so that the resulting
+   * triangulation is the same as the one that was written, independent of
+   * the manifolds attached to the triangulation.
+   *
+   * The data is read in large contiguous blocks, so that the time to read a
+   * file is dominated by the time to create the coarse mesh and to refine it,
+   * rather than by parsing. Files written on machines with a different byte
+   * order or by a different version of the format are rejected.
+   *
+   * @note The triangulation must be empty, and its mesh smoothing flags must
+   * not lead to additional refinement when the saved refinement hierarchy is
+   * recreated; otherwise, an exception is thrown. Distributed triangulations
+   * are only supported for files without refinement.
+   */
+  void
+  read_binary(std::istream &in);
+
 
   /**
    * Read grid data from an unv file as generated by the Salome mesh
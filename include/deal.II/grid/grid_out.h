@@ -1020,7 +1020,9 @@ public:
     /// write() calls write_vtk()
     vtk,
     /// write() calls write_vtu()
-    vtu
+    vtu,
+    /// write() calls write_binary()
+    binary
   };
 
   /**
@@ -1341,6 +1343,45 @@ public:
   void
   write_vtu(const Triangulation<dim, spacedim> &tria, std::ostream &out) const;
 
+  /**
+   * Write the triangulation in deal.II's own binary format, which can be read
+   * back with GridIn::read_binary() considerably faster than text-based
+   * formats. In contrast to the other output formats, the file contains the
+   * complete refinement hierarchy, i.e., the coarse mesh and the refinement
+   * cases of all refined cells, together with the material and manifold ids
+   * of the cells on all levels, the boundary and manifold ids of their faces
+   * (and, in 3d, of their lines), and the final locations of all vertices.
+   *
+   * The file consists of a header of 64-bit unsigned integers, namely the
+   * magic number GridTools::internal::binary_mesh_format_magic_number, the
+   * format version, @p dim, @p spacedim, the number of levels, the number of
+   * vertices, the number of coarse cells, the number of vertex indices of
+   * the coarse cells, the number of face entries, the number of line entries,
+   * and the number of cells on each level. It is followed by contiguous
+   * arrays of the vertex coordinates (as doubles), the vertex indices of the
+   * coarse cells, the material and manifold ids of all cells, the manifold
+   * and boundary ids of the faces and lines of all cells (all as 32-bit
+   * unsigned integers), and finally the number of vertices of each coarse
+   * cell and the refinement case of each cell not on the finest level (as
+   * 8-bit unsigned integers). All cells are listed level by level, in the
+   * order of GridTools::internal::cells_in_hierarchical_order(), and the
+   * vertices are numbered in the order in which they are first encountered
+   * in this order. Since all arrays are stored in the byte order of the
+   * machine and the header determines their sizes, the arrays can also be
+   * accessed directly by mapping the file into memory. Files that only
+   * contain a coarse mesh can also be read in parallel, with each process
+   * reading only a part of the file, by the function
+   * create_description_from_binary_mesh_file() in namespace
+   * TriangulationDescription::Utilities.
+   *
+   * @note This function is not implemented for distributed triangulations,
+   * which do not store all cells on every process.
+   */
+  template <int dim, int spacedim>
+  void
+  write_binary(const Triangulation<dim, spacedim> &tria,
+               std::ostream                       &out) const;
+
   /**
    * Write triangulation in VTU format for each processor, and add a .pvtu file
    * for visualization in VisIt or Paraview that describes the collection of VTU
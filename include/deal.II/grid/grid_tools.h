@@ -324,6 +324,20 @@ namespace GridTools
    * will be using a non-constant coefficient in displacement formulation, the
    * default value of this parameter is <code>false</code>.
    *
+   * If @p tria is a distributed triangulation, such as a
+   * parallel::distributed::Triangulation or a
+   * parallel::fullydistributed::Triangulation, the Laplace problems are
+   * solved in parallel with distributed vectors and an operator that is
+   * applied cell by cell, without assembling a global matrix. In that case,
+   * @p new_points refers to the vertex indices of the current process and
+   * must contain the vertices with prescribed positions of all locally owned
+   * and ghost cells, with the same positions on all processes that share a
+   * vertex. The vertices of all locally owned and ghost cells are moved,
+   * consistently across processes.
+   *
+   * Hanging vertices are placed so that the mesh stays conforming,
+   * regardless of whether they appear in @p new_points.
+   *
    * @note This function is not currently implemented for the 1d case.
    */
   template <int dim>
@@ -538,6 +552,14 @@ namespace GridTools
    * GridTools::Cache::get_cell_bounding_boxes_rtree(), which either returns
    * a cached rtree or builds and stores one. Building an rtree might hinder
    * the performance if the function is called only once on few points.
+   *
+   * @note All points that lie within the bounding box of the same candidate
+   * cell are mapped to the reference cell of that cell with a single call to
+   * Mapping::transform_points_real_to_unit_cell(), which allows mappings such
+   * as MappingQ to work on several points at once with vectorization. The
+   * batches of points of different candidate cells are processed in
+   * parallel. Only points that are not found strictly inside their
+   * candidate cell are handed to find_active_cell_around_point().
    */
   template <int dim, int spacedim>
 #ifndef DOXYGEN
@@ -705,6 +727,36 @@ namespace GridTools
 
   namespace internal
   {
+    /**
+     * The first eight bytes of the files written by GridOut::write_binary(),
+     * the characters "dealmesh" when read as a little-endian integer. Reading
+     * them back on a machine with a different byte order gives a different
+     * number, which allows GridIn::read_binary() to detect such files.
+     */
+    constexpr std::uint64_t binary_mesh_format_magic_number =
+      0x6873656d6c616564;
+
+    /**
+     * The version of the file format of GridOut::write_binary(), to be
+     * incremented whenever the format changes.
+     */
+    constexpr std::uint64_t binary_mesh_format_version = 1;
+
+    /**
+     * Return the cells of @p tria level by level. The cells on level zero are
+     * in the order of the coarse cells, and the cells on each finer level are
+     * sorted by their parents and then by their child index. In contrast to
+     * the order of the cell iterators, this order does not depend on where
+     * the cells are stored, and is therefore the same for two triangulations
+     * that have been created from the same coarse mesh by the same sequence
+     * of refinements. It is used by GridOut::write_binary() and
+     * GridIn::read_binary().
+     */
+    template <int dim, int spacedim>
+    std::vector<
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator>>
+    cells_in_hierarchical_order(const Triangulation<dim, spacedim> &tria);
+
     /**
      * Data structure returned by
      * GridTools::internal::distributed_compute_point_locations(). It provides
@@ -1320,6 +1372,25 @@ namespace GridTools
         std::set<typename MeshType<dim, spacedim>::active_cell_iterator>>
         *vertex_to_cells = nullptr);
 
+  /**
+   * The same as the previous function, but using the compressed
+   * vertex-to-cell map of class VertexToCellMap to find the cells adjacent
+   * to the vertices of the first cell, e.g., the one returned by
+   * GridTools::Cache::get_compressed_vertex_to_cell_map().
+   */
+  template <int dim, int spacedim>
+  std::vector<
+    std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+              Point<dim>>>
+  find_all_active_cells_around_point(
+    const Mapping<dim, spacedim>         &mapping,
+    const Triangulation<dim, spacedim>   &mesh,
+    const Point<spacedim>                &p,
+    const double                          tolerance,
+    const std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+                    Point<dim>>          &first_cell,
+    const VertexToCellMap<dim, spacedim> &vertex_to_cells);
+
   /**
    * A variant of the previous function that internally calls one of the
    * functions find_active_cell_around_point() to obtain a first cell, and
@@ -1786,6 +1857,17 @@ namespace GridTools
       std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
       &vertex_to_cells);
 
+  /**
+   * The same as the previous function, but for the compressed
+   * vertex-to-cell map of class VertexToCellMap. The directions are
+   * computed in parallel over the vertices.
+   */
+  template <int dim, int spacedim>
+  std::vector<std::vector<Tensor<1, spacedim>>>
+  vertex_to_cell_centers_directions(
+    const Triangulation<dim, spacedim>    &mesh,
+    const VertexToCellMap<dim, spacedim> &vertex_to_cells);
+
 
   /**
    * Return the local vertex index of cell @p cell that is closest to
@@ -25,6 +25,7 @@
 #include <deal.II/fe/mapping.h>
 
 #include <deal.II/grid/grid_tools_cache_update_flags.h>
+#include <deal.II/grid/grid_tools_topology.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_accessor.h>
 #include <deal.II/grid/tria_iterator.h>
@@ -36,6 +37,7 @@
 #include <atomic>
 #include <cmath>
 #include <set>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -56,6 +58,16 @@ namespace GridTools
    * changed due to a Triangulation::Signals::any_change() signal being
    * triggered.
    *
+   * If a serial Triangulation is refined or coarsened, the cache keeps track
+   * of the cells that are affected, and those data structures that
+   * have already been computed are updated incrementally, i.e., at a cost
+   * proportional to the number of refined and coarsened cells rather than
+   * the number of cells of the mesh. This concerns the vertex-to-cell map
+   * and the vertex-to-cell-center directions, the used vertices and their
+   * RTree, and the RTrees of the cell bounding boxes. All other data
+   * structures, and all data structures of parallel triangulations, are
+   * rebuilt from scratch upon the next access.
+   *
    * If the triangulation changes for other reasons, for example because you
    * use it in conjunction with a MappingQEulerian object that sees the
    * vertices through its own transformation, or because you manually change
@@ -109,11 +121,24 @@ namespace GridTools
     /**
      * Return the cached vertex_to_cell_map as computed by
      * GridTools::vertex_to_cell_map().
+     *
+     * This object is created from the one returned by
+     * get_compressed_vertex_to_cell_map() upon the first call after the
+     * triangulation has changed. If you do not need the information in the
+     * form of a vector of sets, the latter function is cheaper.
      */
     const std::vector<
       std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>> &
     get_vertex_to_cell_map() const;
 
+    /**
+     * Return the cached vertex-to-cell map in the compressed format of class
+     * GridTools::VertexToCellMap. It contains the same information as the
+     * object returned by get_vertex_to_cell_map().
+     */
+    const VertexToCellMap<dim, spacedim> &
+    get_compressed_vertex_to_cell_map() const;
+
     /**
      * Return the cached vertex_to_cell_centers_directions as computed by
      * GridTools::vertex_to_cell_centers_directions().
@@ -253,12 +278,22 @@ namespace GridTools
 
     /**
      * Store vertex to cell map information, as generated by
-     * GridTools::vertex_to_cell_map()
+     * GridTools::vertex_to_cell_map(), in compressed form.
+     */
+    mutable VertexToCellMap<dim, spacedim> vertex_to_cells;
+    mutable std::mutex                     vertex_to_cells_mutex;
+
+    /**
+     * Store vertex to cell map information, as generated by
+     * GridTools::vertex_to_cell_map(). This object is only created from
+     * #vertex_to_cells if it is requested, and is outdated whenever
+     * #vertex_to_cell_sets_outdated is set.
      */
     mutable std::vector<
       std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
-                       vertex_to_cells;
-    mutable std::mutex vertex_to_cells_mutex;
+                              vertex_to_cell_sets;
+    mutable std::atomic<bool> vertex_to_cell_sets_outdated;
+    mutable std::mutex        vertex_to_cell_sets_mutex;
 
     /**
      * Store vertex to cell center directions, as generated by
@@ -329,11 +364,93 @@ namespace GridTools
                        vertices_with_ghost_neighbors;
     mutable std::mutex vertices_with_ghost_neighbors_mutex;
 
+    /**
+     * Information about the cells that have been refined and coarsened in
+     * the refinement cycle the triangulation is currently executing,
+     * collected via the signals Triangulation::Signals::pre_refinement,
+     * Triangulation::Signals::pre_coarsening_on_cell, and
+     * Triangulation::Signals::post_refinement_on_cell. Only used for
+     * serial triangulations.
+     */
+    struct RefinementChanges
+    {
+      /**
+       * Whether the triangulation is currently executing a refinement cycle.
+       */
+      bool in_progress = false;
+
+      /**
+       * The expected change in the number of active cells, to verify that we
+       * have seen all changes.
+       */
+      int n_active_cells_difference = 0;
+
+      /**
+       * The number of active cells before the refinement cycle.
+       */
+      unsigned int n_active_cells_before = 0;
+
+      /**
+       * The cells that have been refined.
+       */
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+        refined_cells;
+
+      /**
+       * The cells whose children have been removed.
+       */
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+        coarsened_cells;
+
+      /**
+       * The vertices of the children that have been removed.
+       */
+      std::vector<unsigned int> vertices_of_removed_cells;
+
+      /**
+       * The bounding boxes of the children that have been removed, in the form
+       * they are stored in the RTree objects. Only filled if at least one of
+       * these RTree objects is currently up to date.
+       */
+      std::vector<
+        std::pair<BoundingBox<spacedim>,
+                  typename Triangulation<dim, spacedim>::active_cell_iterator>>
+        bounding_boxes_of_removed_cells;
+    };
+
+    /**
+     * The changes of the current refinement cycle.
+     */
+    RefinementChanges refinement_changes;
+
+    /**
+     * React to a change of the triangulation: If the change is the end of
+     * a refinement cycle of a serial triangulation, update those data
+     * structures that are up to date and that allow for it incrementally
+     * using the information in refinement_changes, and mark all others
+     * for update. Otherwise, mark everything for update.
+     */
+    void
+    update_after_change();
+
+    /**
+     * Connect to the signals of a serial triangulation that allow tracking
+     * which cells are refined and coarsened.
+     */
+    void
+    connect_to_refinement_signals();
+
     /**
      * Storage for the status of the triangulation change signal.
      */
     boost::signals2::connection tria_change_signal;
 
+    /**
+     * Storage for the status of the signals used to track refinement and
+     * coarsening of serial triangulations.
+     */
+    std::vector<boost::signals2::connection> tria_refinement_signals;
+
     /**
      * Storage for the status of the triangulation creation signal.
      */
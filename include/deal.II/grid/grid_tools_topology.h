@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/observer_pointer.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/template_constraints.h>
 
@@ -345,6 +346,136 @@ namespace GridTools
     std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
   vertex_to_cell_map(const Triangulation<dim, spacedim> &triangulation);
 
+  /**
+   * A compressed representation of the information returned by
+   * vertex_to_cell_map(). Rather than storing an `std::set` of cell
+   * iterators for each vertex, this class stores the cells adjacent to all
+   * vertices in a single array, in the same way as the column indices of a
+   * SparsityPattern, and identifies each cell only by its level and index.
+   * For each vertex, the cells are sorted in the same order as in the sets
+   * returned by vertex_to_cell_map(), and the same cells are listed,
+   * including the cells for which the vertex is a hanging node.
+   *
+   * The data structure is built in parallel over the cells and vertices of
+   * the triangulation, and is considerably cheaper to build, store, and
+   * query than the vector of sets. It is used by GridTools::Cache and the
+   * functions that query cells adjacent to vertices through a
+   * GridTools::Cache object.
+   */
+  template <int dim, int spacedim = dim>
+  class VertexToCellMap
+  {
+  public:
+    /**
+     * Iterator type of the active cells of the triangulation.
+     */
+    using active_cell_iterator =
+      typename Triangulation<dim, spacedim>::active_cell_iterator;
+
+    /**
+     * Default constructor. Call reinit() before using the object.
+     */
+    VertexToCellMap() = default;
+
+    /**
+     * Constructor. Calls reinit() with the given triangulation.
+     */
+    explicit VertexToCellMap(const Triangulation<dim, spacedim> &triangulation);
+
+    /**
+     * Compute the cells adjacent to all vertices of the given triangulation.
+     */
+    void
+    reinit(const Triangulation<dim, spacedim> &triangulation);
+
+    /**
+     * Recompute the lists of adjacent cells of the given @p vertices after
+     * local changes of the triangulation, e.g., after refinement or
+     * coarsening, and keep the lists of all other vertices. Each cell that
+     * is now adjacent to one of the given vertices must either be listed in
+     * @p new_cells, or it must have been adjacent to one of the given
+     * vertices before the change. The number of vertices is adjusted to the
+     * one of the triangulation.
+     *
+     * Since the lists of all vertices are stored contiguously, the cost of
+     * this function is linear in the total number of stored cells, but
+     * apart from the given vertices it only involves copying data.
+     */
+    void
+    update(const std::vector<unsigned int>         &vertices,
+           const std::vector<active_cell_iterator> &new_cells);
+
+    /**
+     * Return the number of vertices, i.e., the number of vertices of the
+     * triangulation at the time this object was last updated.
+     */
+    unsigned int
+    n_vertices() const;
+
+    /**
+     * Return the number of cells adjacent to the given vertex.
+     */
+    unsigned int
+    n_adjacent_cells(const unsigned int vertex) const;
+
+    /**
+     * Return the @p i-th cell adjacent to the given vertex.
+     */
+    active_cell_iterator
+    get_adjacent_cell(const unsigned int vertex, const unsigned int i) const;
+
+    /**
+     * Return all cells adjacent to the given vertex.
+     */
+    std::vector<active_cell_iterator>
+    get_adjacent_cells(const unsigned int vertex) const;
+
+    /**
+     * Return the information stored in this object in the format of the
+     * function vertex_to_cell_map().
+     */
+    std::vector<std::set<active_cell_iterator>>
+    get_vector_of_sets() const;
+
+    /**
+     * Return an estimate of the memory consumption (in bytes) of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Call the given function for all pairs of a vertex and an adjacent cell
+     * that can be seen from the given cell. Pairs may be reported more than
+     * once.
+     */
+    template <typename Function>
+    static void
+    for_each_adjacent_pair(const active_cell_iterator &cell,
+                           const bool                  has_hanging_nodes,
+                           const Function             &function);
+
+    /**
+     * The triangulation whose cells are stored.
+     */
+    ObserverPointer<const Triangulation<dim, spacedim>,
+                    VertexToCellMap<dim, spacedim>>
+      triangulation;
+
+    /**
+     * The position of the first cell adjacent to each vertex in the
+     * #adjacent_cells array. The last element is the total number of stored
+     * cells.
+     */
+    std::vector<std::size_t> row_starts;
+
+    /**
+     * The level and index of the cells adjacent to all vertices.
+     */
+    std::vector<std::pair<unsigned int, unsigned int>> adjacent_cells;
+  };
+
   /**
    * Produce a sparsity pattern in which nonzero entries indicate that two
    * cells are connected via a common face. The diagonal entries of the
@@ -20,11 +20,15 @@
 
 #include <deal.II/base/function.h>
 #include <deal.II/base/function_parser.h>
+#include <deal.II/base/thread_local_storage.h>
 
 #include <deal.II/grid/manifold.h>
 
 #include <boost/signals2/connection.hpp>
 
+#include <unordered_map>
+#include <utility>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -1053,6 +1057,20 @@ private:
  * current implementation by a pre-identification of relevant cells with
  * axis-aligned bounding boxes.
  *
+ * The pull-backs of the surrounding points into the chart space of a coarse
+ * cell involve a Newton iteration that evaluates the transfinite
+ * interpolation, and with it the manifolds attached to the faces and lines of
+ * the coarse cell, several times. Since the same points (e.g., the vertices
+ * of a cell) appear as surrounding points in many calls to get_new_points(),
+ * both during mesh refinement and when a curved mapping such as MappingQ or
+ * MappingQCache computes its support points, this class keeps a cache of the
+ * pull-backs it has computed. The cache is stored separately for each
+ * thread, so no synchronization is needed, and it is emptied when
+ * initialize() is called, when the triangulation signals that its vertices
+ * have been moved (e.g., by GridTools::transform()), or when it grows beyond
+ * a fixed number of entries. If vertices of the coarse cells are changed
+ * directly in user code, initialize() must be called again.
+ *
  * @ingroup manifold
  */
 template <int dim, int spacedim = dim>
@@ -1246,11 +1264,40 @@ private:
                 InverseQuadraticApproximation<dim, spacedim>>
     quadratic_approximation;
 
+  /**
+   * Hash function for the keys of the pull-back cache, i.e., pairs of the
+   * index of a coarse cell and a point in real space.
+   */
+  struct PullBackCacheHash
+  {
+    std::size_t
+    operator()(const std::pair<unsigned int, Point<spacedim>> &key) const;
+  };
+
+  /**
+   * A cache of the pull-backs computed in compute_chart_points(), mapping the
+   * index of a coarse cell and a point in real space to the chart point on
+   * that cell. Only successful pull-backs are stored. The cache exists
+   * separately for each thread.
+   */
+  mutable Threads::ThreadLocalStorage<
+    std::unordered_map<std::pair<unsigned int, Point<spacedim>>,
+                       Point<dim>,
+                       PullBackCacheHash>>
+    pull_back_cache;
+
   /**
    * The connection to Triangulation::signals::clear that must be reset once
    * this class goes out of scope.
    */
   boost::signals2::connection clear_signal;
+
+  /**
+   * The connection to Triangulation::signals::mesh_movement, used to empty
+   * the pull-back cache, that must be reset once this class goes out of
+   * scope.
+   */
+  boost::signals2::connection mesh_movement_signal;
 };
 
 /*----------------------------- inline functions -----------------------------*/
@@ -24,6 +24,7 @@
 #include <deal.II/base/observer_pointer.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/grid/cell_id.h>
 #include <deal.II/grid/cell_status.h>
@@ -395,6 +396,12 @@ namespace internal
 
     CellAttachedDataSerializer();
 
+    /**
+     * Destructor. An asynchronous save() must have been completed by a call
+     * to wait_for_pending_save() before the object is destroyed.
+     */
+    ~CellAttachedDataSerializer();
+
     /**
      * Prepare data serialization by calling the pack callback functions on each
      * cell in @p cell_relations.
@@ -459,12 +466,32 @@ namespace internal
      * determined from the provided input parameters.
      *
      * Data has to be previously packed with pack_data().
+     *
+     * If @p asynchronous is set to true, the files are created and their
+     * headers are written before this function returns, but the packed
+     * data is only handed over to the file system: With MPI, non-blocking
+     * MPI I/O requests are posted, otherwise a separate task writes the
+     * files. The packed buffers are moved out of this object and kept
+     * alive until wait_for_pending_save() is called, so that clear() may be
+     * called right after this function.
      */
     void
     save(const unsigned int global_first_cell,
          const unsigned int global_num_cells,
          const std::string &file_basename,
-         const MPI_Comm    &mpi_communicator) const;
+         const MPI_Comm    &mpi_communicator,
+         const bool         asynchronous = false);
+
+    /**
+     * Wait until the data of a previous call to save() with asynchronous
+     * output has been written completely, close the files, and release the
+     * buffers. Nothing happens if no such operation is pending.
+     *
+     * If MPI support is enabled and the data was written via MPI I/O, this
+     * is a collective operation on the communicator passed to save().
+     */
+    void
+    wait_for_pending_save();
 
     /**
      * Deserialize data from file system.
@@ -534,6 +561,32 @@ namespace internal
     std::vector<int>  dest_sizes_variable;
     std::vector<char> src_data_variable;
     std::vector<char> dest_data_variable;
+
+  private:
+    /**
+     * Everything that needs to be kept alive until an asynchronous save()
+     * has been completed: The packed buffers whose content is being written,
+     * and the handles of the corresponding files and write operations.
+     */
+    struct PendingSave
+    {
+      std::vector<unsigned int> sizes_fixed_cumulative;
+      std::vector<char>         data_fixed;
+      std::vector<int>          sizes_variable;
+      std::vector<char>         data_variable;
+
+#ifdef DEAL_II_WITH_MPI
+      std::vector<MPI_File>    files;
+      std::vector<MPI_Request> requests;
+#endif
+
+      Threads::Task<void> task;
+    };
+
+    /**
+     * The currently pending asynchronous save() operation, if any.
+     */
+    std::unique_ptr<PendingSave> pending_save;
   };
 } // namespace internal
 
@@ -2105,6 +2158,55 @@ public:
   void
   flip_all_direction_flags();
 
+  /**
+   * Renumber the cells of the triangulation, and with them the internal
+   * storage of the cell data, so that cells that are close to each other in
+   * space are also close to each other in memory. Since cell iterators
+   * traverse the cells of each level in the order in which they are
+   * stored, this improves the cache efficiency of loops over cells, such
+   * as the assembly of linear systems or matrix-free operator evaluation.
+   *
+   * Cells are created in the order in which they appear in the input (on the
+   * coarse level) or in the order in which their parents were refined (on
+   * all other levels), i.e., after a number of adaptive refinement and
+   * coarsening cycles, neighboring cells may be stored far apart from
+   * each other. This function sorts the coarse cells along a Hilbert
+   * curve through their centers. On the finer levels, the children of
+   * each cell are then stored consecutively, in the order of their
+   * parents. For meshes consisting of hypercube cells, the
+   * children of a cell are numbered lexicographically, so the cells on the
+   * finer levels follow a Hilbert curve on the coarse level, refined by a
+   * Morton (Z-order) curve within each coarse cell. This is the same order
+   * in which p4est enumerates the cells of a
+   * parallel::distributed::Triangulation. Holes in the storage left by
+   * coarsening are moved to the end of each level.
+   *
+   * The renumbering changes the indices of cells, and consequently also
+   * the CellId of cells if coarse cells are reordered. Vertices and faces
+   * keep their indices. All user data attached to cells (flags,
+   * material and manifold ids, user flags, pointers and indices, etc.)
+   * moves with the cells. Since the function is equivalent to
+   * re-creating the triangulation in a different order, it triggers the
+   * `create` signal (see the section on signals in the general
+   * documentation of this class); objects that store information
+   * associated with cells, such as DoFHandler objects, must be reinitialized
+   * after calling this function, e.g., by calling
+   * DoFHandler::distribute_dofs() again.
+   *
+   * The function does not renumber anything automatically after mesh
+   * refinement, because data that must be transferred between meshes, e.g.
+   * by SolutionTransfer, is associated with cells via their indices. Call
+   * it after refinement, and after transferring all data, instead.
+   *
+   * For parallel::shared::Triangulation objects, the mesh is re-partitioned
+   * afterwards. The function can not be called for
+   * parallel::distributed::Triangulation and
+   * parallel::fullydistributed::Triangulation objects, whose cells are
+   * already ordered along a space-filling curve.
+   */
+  virtual void
+  renumber_cells_along_space_filling_curve();
+
   /**
    * @name Mesh refinement
    * @{
@@ -3624,6 +3726,44 @@ public:
   virtual void
   load(const std::string &file_basename);
 
+  /**
+   * Like save(), but do not wait for the cell-attached data (e.g., the
+   * vectors registered by SolutionTransfer::prepare_for_serialization())
+   * to be written to disk. The data is packed into memory buffers before
+   * this function returns, so the triangulation and the vectors can be
+   * modified right away, while the buffers are written in the background:
+   * via non-blocking MPI I/O for parallel triangulations, and by a separate
+   * task otherwise. The description of the mesh itself is still written
+   * synchronously.
+   *
+   * The files are only complete after wait_for_save() has been called. This
+   * happens automatically before the next call to save() or load(), but
+   * otherwise needs to be done explicitly, both before the files are read by
+   * another object or program and before this object is destroyed.
+   *
+   * The data is written as packed by the functions registered with
+   * register_data_attach(), without compressing it once more. Functions that
+   * attach data of variable size may compress their buffer for each cell,
+   * for example via Utilities::pack() as done by
+   * parallel::distributed::CellDataTransfer, whereas SolutionTransfer stores
+   * the values of degrees of freedom uncompressed because floating point
+   * numbers do not compress well.
+   *
+   * This function has the same collective semantics as save().
+   */
+  void
+  save_asynchronously(const std::string &file_basename) const;
+
+  /**
+   * Wait until the data written by a previous call to save_asynchronously()
+   * has reached the file system, and report any error that occurred while
+   * writing it. Nothing happens if there is no such operation pending.
+   *
+   * For parallel triangulations, this is a collective operation.
+   */
+  void
+  wait_for_save() const;
+
 
   /**
    * Declare the (coarse) face pairs given in the argument of this function as
@@ -3944,6 +4084,13 @@ protected:
     local_cell_relations;
 
   internal::CellAttachedDataSerializer<dim, spacedim> data_serializer;
+
+  /**
+   * Whether save_attached_data() is supposed to leave the writing of the
+   * packed buffers to the background. Set by save_asynchronously() for the
+   * duration of its call to save().
+   */
+  mutable bool save_attached_data_asynchronously = false;
   /**
    * @}
    */
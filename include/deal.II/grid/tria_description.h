@@ -465,6 +465,142 @@ namespace TriangulationDescription
       const TriangulationDescription::Settings setting =
         TriangulationDescription::Settings::default_setting);
 
+    /**
+     * Construct a TriangulationDescription::Description for a coarse mesh
+     * whose vertices and cells are distributed among the processes of the
+     * given communicator. In contrast to the functions above, no process
+     * ever needs to store the whole mesh: each process only provides a
+     * disjoint chunk of the vertices and a disjoint chunk of the cells, for
+     * example as read by each process from a different part of a (large)
+     * mesh file.
+     *
+     * The global vertex numbering is given implicitly by the order of the
+     * processes: the vertices in @p local_vertices of process $p$ have the
+     * global indices starting at the total number of vertices provided by
+     * processes $0,\ldots,p-1$. The vertex indices stored in the cells of
+     * @p local_cells refer to this global numbering, and the coarse-cell id
+     * of a cell is, in the same way, given by its position in the global
+     * list of cells.
+     *
+     * The cells are partitioned among all processes so that each process
+     * owns a contiguous part of the cells along a Hilbert curve through the
+     * cell centers, which typically leads to compact partitions with small
+     * interfaces. All steps of the algorithm, i.e., the computation of the
+     * cell centers, the determination of the partitioning, the distribution
+     * of the cells to their owners, and the identification of the ghost
+     * cells (the cells sharing a vertex with a locally owned cell), only
+     * involve point-to-point communication of the data relevant to each
+     * process and a small number of global reductions.
+     *
+     * A typical use looks like this:
+     * @code
+     * // read this process' part of the vertices and cells (not shown)
+     * std::vector<Point<dim>>    local_vertices = ...;
+     * std::vector<CellData<dim>> local_cells    = ...;
+     * SubCellData                local_boundary = ...;
+     *
+     * const TriangulationDescription::Description<dim, dim> description =
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_distributed_cells<dim, dim>(local_vertices,
+     *                                                         local_cells,
+     *                                                         local_boundary,
+     *                                                         comm);
+     *
+     * parallel::fullydistributed::Triangulation<dim> tria(comm);
+     * tria.create_triangulation(description);
+     * @endcode
+     *
+     * @param[in] local_vertices The locations of the vertices provided by the
+     *   current process.
+     * @param[in] local_cells The cells provided by the current process, with
+     *   vertex indices referring to the global vertex numbering. The
+     *   material and manifold ids of the cells are kept.
+     * @param[in] local_subcell_data The boundary and manifold ids of faces
+     *   (and, in 3d, the manifold ids of lines) provided by the current
+     *   process, again with vertex indices referring to the global vertex
+     *   numbering. As for the cells, each process may provide any part of
+     *   these objects, independently of which process will own the cells
+     *   they belong to. Boundary faces without an entry get the boundary id
+     *   zero.
+     * @param[in] comm The MPI communicator to be used.
+     * @param[in] smoothing Mesh smoothing type.
+     * @param[in] settings See the description of the Settings enumerator.
+     * @param[in] local_periodic_vertex_pairs Pairs of global vertex indices
+     *   of vertices that are identified because of periodicity. As for the
+     *   other arguments, each process may provide any part of these pairs.
+     *   Cells that share a vertex with a locally owned cell only via such
+     *   an identification become ghost cells, so that the periodicity can
+     *   be set up by calling Triangulation::add_periodicity() on the
+     *   resulting triangulation. Since the pairs only exist on periodic
+     *   boundaries, they are collected on all processes.
+     * @return The Description object that can then be used to set up a
+     *   dealii::parallel::fullydistributed::Triangulation.
+     *
+     * @note The cells need to be oriented consistently, as is for example
+     *   the case if the mesh has been written by GridOut, since the cells
+     *   are passed on to the triangulation unchanged. Since a Description
+     *   only stores the boundary ids of faces, the boundary ids of lines in
+     *   3d are not set (as for create_description_from_triangulation()).
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    create_description_from_distributed_cells(
+      const std::vector<Point<spacedim>>       &local_vertices,
+      const std::vector<dealii::CellData<dim>> &local_cells,
+      const SubCellData                        &local_subcell_data,
+      const MPI_Comm                            comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, spacedim>::none,
+      const TriangulationDescription::Settings settings =
+        TriangulationDescription::Settings::default_setting,
+      const std::vector<std::pair<unsigned int, unsigned int>>
+        &local_periodic_vertex_pairs = {});
+
+    /**
+     * Construct a Description of a coarse mesh that is read from a file in
+     * the binary format written by GridOut::write_binary(), without any
+     * process ever reading the whole file. Each process reads a contiguous
+     * chunk of the vertices and a contiguous chunk of the cells (along with
+     * the ids of their faces and lines) via MPI-IO, and these chunks are
+     * then passed to create_description_from_distributed_cells(), which
+     * partitions the cells and sets up the ghost layer.
+     *
+     * A typical use looks like this:
+     * @code
+     * // on a workstation, or on a single process
+     * std::ofstream out("mesh.bin", std::ios::binary);
+     * GridOut().write_binary(coarse_mesh, out);
+     *
+     * // in the parallel program
+     * parallel::fullydistributed::Triangulation<dim> tria(comm);
+     * tria.create_triangulation(
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_binary_mesh_file<dim, dim>("mesh.bin",
+     *                                                        comm));
+     * @endcode
+     *
+     * @param[in] filename The name of the file, which needs to be accessible
+     *   by all processes of @p comm.
+     * @param[in] comm The MPI communicator to be used.
+     * @param[in] smoothing Mesh smoothing type.
+     * @param[in] settings See the description of the Settings enumerator.
+     * @return The Description object that can then be used to set up a
+     *   dealii::parallel::fullydistributed::Triangulation.
+     *
+     * @note Only files that contain a mesh without any refinement, i.e.,
+     *   files with a single level, can be read by this function. The file
+     *   needs to be written on a machine with the same byte order.
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    create_description_from_binary_mesh_file(
+      const std::string &filename,
+      const MPI_Comm     comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, spacedim>::none,
+      const TriangulationDescription::Settings settings =
+        TriangulationDescription::Settings::default_setting);
+
   } // namespace Utilities
 
 
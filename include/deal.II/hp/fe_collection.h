@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/table.h>
+
 #include <deal.II/fe/component_mask.h>
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/fe_values_extractors.h>
@@ -24,6 +26,7 @@
 #include <deal.II/hp/collection.h>
 
 #include <memory>
+#include <mutex>
 #include <set>
 
 
@@ -320,6 +323,35 @@ namespace hp
     bool
     hp_constraints_are_implemented() const;
 
+    /**
+     * Return the matrix that interpolates from a face of the element with
+     * index @p source_fe_index to the face of the element with index
+     * @p fe_index, as computed by
+     * FiniteElement::get_face_interpolation_matrix(). The matrix therefore
+     * has as many rows as the source element has degrees of freedom per face,
+     * and as many columns as the element with index @p fe_index.
+     *
+     * Computing these matrices can be expensive for high polynomial degrees.
+     * Consequently, each matrix is only computed the first time it is
+     * requested and then stored for all later calls. The cache is shared
+     * between copies of this object, and it is safe to call this function
+     * from several threads at the same time.
+     */
+    const FullMatrix<double> &
+    get_face_interpolation_matrix(const unsigned int fe_index,
+                                  const unsigned int source_fe_index) const;
+
+    /**
+     * Same as get_face_interpolation_matrix(), but return the matrix that
+     * interpolates from a face of the element with index @p source_fe_index
+     * to the child @p subface of the face of the element with index
+     * @p fe_index, see FiniteElement::get_subface_interpolation_matrix().
+     */
+    const FullMatrix<double> &
+    get_subface_interpolation_matrix(const unsigned int fe_index,
+                                     const unsigned int source_fe_index,
+                                     const unsigned int subface) const;
+
     /**
      * This function combines the functionality of the
      * FiniteElement::hp_vertex_dof_identities() into multi-way comparisons.
@@ -856,6 +888,44 @@ namespace hp
     std::shared_ptr<MappingCollection<dim, spacedim>>
       reference_cell_default_linear_mapping;
 
+    /**
+     * A structure that stores the face and subface interpolation matrices
+     * returned by get_face_interpolation_matrix() and
+     * get_subface_interpolation_matrix(), along with a mutex that guards
+     * their creation.
+     */
+    struct InterpolationMatrixCache
+    {
+      /**
+       * Constructor. Create empty tables for a collection with @p n_fes
+       * elements.
+       */
+      explicit InterpolationMatrixCache(const unsigned int n_fes);
+
+      /**
+       * Mutex guarding the creation of entries of the tables below.
+       */
+      std::mutex mutex;
+
+      /**
+       * The face interpolation matrices, indexed by the pair of FE indices.
+       */
+      Table<2, std::unique_ptr<const FullMatrix<double>>> face_matrices;
+
+      /**
+       * The subface interpolation matrices, indexed by the pair of FE indices
+       * and the number of the subface.
+       */
+      Table<3, std::unique_ptr<const FullMatrix<double>>> subface_matrices;
+    };
+
+    /**
+     * The cache of interpolation matrices. Since copies of an FECollection
+     * store the same elements, they can share this object. It is replaced
+     * by an empty one whenever an element is added to the collection.
+     */
+    std::shared_ptr<InterpolationMatrixCache> interpolation_matrix_cache;
+
     /**
      * %Function returning the index of the finite element following the given
      * one in hierarchy.
@@ -952,6 +952,12 @@ public:
    * cycles in this graph of constraints are not allowed, i.e., for example
    * $u_4$ may not itself be constrained, directly or indirectly, to $u_{13}$
    * again.
+   *
+   * Chains are resolved in rounds, each of which finalizes, using several
+   * threads, all lines that only refer to lines finalized in previous
+   * rounds. The number of rounds is therefore the length of the longest chain
+   * of constraints. A cycle is detected when a round does not finalize any
+   * line, and leads to an exception also in release mode.
    */
   void
   close();
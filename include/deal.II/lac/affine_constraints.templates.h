@@ -796,21 +796,6 @@ AffineConstraints<number>::close()
 
 
 
-  // In debug mode we are computing an estimate for the maximum number
-  // of constraints so that we can bail out if there is a cycle in the
-  // constraints (which is easier than searching for cycles in the graph).
-  //
-  // Let us figure out the largest dof index. This is an upper bound for the
-  // number of constraints because it is an approximation for the number of dofs
-  // in our system.
-  [[maybe_unused]] size_type largest_idx = 0;
-  if constexpr (running_in_debug_mode())
-    {
-      for (const ConstraintLine &line : lines)
-        for (const std::pair<size_type, number> &entry : line.entries)
-          largest_idx = std::max(largest_idx, entry.first);
-    }
-
   // replace references to dofs that are themselves constrained. note that
   // because we may replace references to other dofs that may themselves be
   // constrained to third ones, we have to iterate over all this until we
@@ -823,147 +808,142 @@ AffineConstraints<number>::close()
   // we sort the list so that throwing out duplicates becomes much more
   // efficient. also, we have to do it only once, rather than in each
   // iteration
-  [[maybe_unused]] size_type iteration                   = 0;
-  bool                       chained_constraint_replaced = false;
-  std::vector<bool>          line_finalized(lines.size(), false);
-  do
-    {
-      chained_constraint_replaced = false;
-      for (unsigned int line_index = 0; line_index < lines.size(); ++line_index)
-        if (line_finalized[line_index] == false)
+  //
+  // we work in rounds: in each round, we only expand those lines whose
+  // entries are either not constrained at all, or are constrained by lines
+  // that were finalized in a previous round, i.e., that do not refer to
+  // constrained dofs any more themselves. such a line is final after a
+  // single pass over its entries, and because it only reads lines that are
+  // not modified in the current round, all lines of a round can be worked on
+  // in parallel. the number of rounds equals the length of the longest chain
+  // of constraints, which is typically very small. if a round does not make
+  // any progress, the remaining lines must form a cycle.
+  //
+  // note that we store the flags in a vector of chars rather than a
+  // std::vector<bool> so that different threads can write them concurrently
+  std::vector<char>      line_finalized(lines.size(), 0);
+  std::vector<char>      line_finalized_in_this_round(lines.size(), 0);
+  std::vector<size_type> remaining_lines(lines.size());
+  std::iota(remaining_lines.begin(), remaining_lines.end(), size_type(0));
+
+  const auto resolve_line = [&](const size_type line_index) {
+    ConstraintLine &line = lines[line_index];
+
+    // first check whether all of the entries of this line that are further
+    // constrained refer to finalized lines. ignore elements that we don't
+    // store on the current processor.
+    const size_type lines_cache_size    = lines_cache.size();
+    bool            has_sub_constraints = false;
+    for (const std::pair<size_type, number> &entry : line.entries)
+      {
+        const size_type dof_index = calculate_line_index(entry.first);
+        if (dof_index < lines_cache_size &&
+            lines_cache[dof_index] != numbers::invalid_size_type)
           {
-            ConstraintLine &line = lines[line_index];
-
-            // we need to keep track of how many replacements we do in this
-            // line, because we can end up in a cycle A->B->C->A without the
-            // number of entries growing.
-            [[maybe_unused]] size_type n_replacements = 0;
-
-            // loop over all entries of this line (including ones that we
-            // have appended in this go around) and see whether they are
-            // further constrained. ignore elements that we don't store on
-            // the current processor.
-            const unsigned int n_original_entries  = line.entries.size();
-            bool               has_sub_constraints = false;
-            const size_type    lines_cache_size    = lines_cache.size();
-            for (unsigned int entry = 0; entry < n_original_entries; ++entry)
-              {
-                const size_type dof_index =
-                  calculate_line_index(line.entries[entry].first);
+            Assert(entry.first != line.index,
+                   ExcMessage("Cycle in constraints detected!"));
+            if (line_finalized[lines_cache[dof_index]] == 0)
+              return;
+            has_sub_constraints = true;
+          }
+      }
 
-                if (dof_index < lines_cache_size &&
-                    lines_cache[dof_index] != numbers::invalid_size_type)
-                  {
-                    // Now we found an index that is further constrained, so
-                    // we need to resolve the entries.  We may replace some of
-                    // them, and we may add some, but we only walk through the
-                    // original entries (and also don't touch the
-                    // replacements) even though in principle we could also do
-                    // the ones we have added or replaced. There is no harm in
-                    // doing so: we will simply treat those in the next round
-                    // around of the outer iteration.
-                    has_sub_constraints = true;
-
-                    const number weight = line.entries[entry].second;
-                    Assert(line.entries[entry].first != line.index,
-                           ExcMessage("Cycle in constraints detected!"));
-
-                    const ConstraintLine &constrained_line =
-                      lines[lines_cache[dof_index]];
-                    Assert(constrained_line.index == line.entries[entry].first,
-                           ExcInternalError());
+    if (has_sub_constraints == true)
+      {
+        // now replace every entry that is further constrained by its
+        // expansion. we do that by overwriting the entry by the first entry
+        // of the expansion and adding the remaining ones to the end. since
+        // the expansion is final, none of the added entries is constrained.
+        const unsigned int n_original_entries = line.entries.size();
+        for (unsigned int entry = 0; entry < n_original_entries; ++entry)
+          {
+            const size_type dof_index =
+              calculate_line_index(line.entries[entry].first);
+            if (dof_index < lines_cache_size &&
+                lines_cache[dof_index] != numbers::invalid_size_type)
+              {
+                const number weight = line.entries[entry].second;
 
-                    // now we have to replace an entry by its expansion. we do
-                    // that by overwriting the entry by the first entry of the
-                    // expansion and adding the remaining ones to the end,
-                    // where we will later process them once more
-                    //
-                    // we can of course only do that if the DoF that we are
-                    // currently handling is constrained by a linear combination
-                    // of other dofs:
-                    if (constrained_line.entries.size() > 0)
-                      {
-                        for (size_type i = 0;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          Assert(line.entries[entry].first !=
-                                   constrained_line.entries[i].first,
-                                 ExcMessage("Cycle in constraints detected!"));
-
-                        // replace first entry, then tack the rest to the end
-                        // of the list
-                        line.entries[entry] = std::pair<size_type, number>(
-                          constrained_line.entries[0].first,
-                          constrained_line.entries[0].second * weight);
-
-                        for (size_type i = 1;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          line.entries.emplace_back(
-                            constrained_line.entries[i].first,
-                            constrained_line.entries[i].second * weight);
-
-                        if constexpr (library_build_mode ==
-                                      LibraryBuildMode::debug)
-                          {
-                            // keep track of how many entries we replace in this
-                            // line. If we do more than there are constraints or
-                            // dofs in our system, we must have a cycle.
-                            ++n_replacements;
-                            Assert(n_replacements / 2 < largest_idx,
-                                   ExcMessage(
-                                     "Cycle in constraints detected!"));
-                          }
-                      }
-                    else
-                      // the DoF that we encountered is not constrained by a
-                      // linear combination of other dofs but is equal to just
-                      // the inhomogeneity (i.e. its chain of entries is
-                      // empty). in that case, we can't just overwrite the
-                      // current entry, but we have to actually eliminate
-                      // it. we do not want to change the loop length above we
-                      // do so by setting the 'first' entry to
-                      // invalid_size_type here to finally remove entries in a
-                      // second loop
-                      {
-                        line.entries[entry].first = numbers::invalid_size_type;
-                      }
+                const ConstraintLine &constrained_line =
+                  lines[lines_cache[dof_index]];
+                Assert(constrained_line.index == line.entries[entry].first,
+                       ExcInternalError());
 
-                    line.inhomogeneity +=
-                      constrained_line.inhomogeneity * weight;
+                // we can of course only do that if the DoF that we are
+                // currently handling is constrained by a linear combination
+                // of other dofs:
+                if (constrained_line.entries.size() > 0)
+                  {
+                    line.entries[entry] = std::pair<size_type, number>(
+                      constrained_line.entries[0].first,
+                      constrained_line.entries[0].second * weight);
+
+                    for (size_type i = 1; i < constrained_line.entries.size();
+                         ++i)
+                      line.entries.emplace_back(
+                        constrained_line.entries[i].first,
+                        constrained_line.entries[i].second * weight);
+                  }
+                else
+                  // the DoF that we encountered is not constrained by a
+                  // linear combination of other dofs but is equal to just
+                  // the inhomogeneity (i.e. its chain of entries is
+                  // empty). in that case, we can't just overwrite the
+                  // current entry, but we have to actually eliminate
+                  // it. we do not want to change the loop length above we
+                  // do so by setting the 'first' entry to
+                  // invalid_size_type here to finally remove entries in a
+                  // second loop
+                  {
+                    line.entries[entry].first = numbers::invalid_size_type;
                   }
-              }
-
-            // If none of the entries in the current line refer to DoFs that are
-            // themselves constrained, then we can move on:
-            if (has_sub_constraints == false)
-              line_finalized[line_index] = true;
-            else
-              {
-                chained_constraint_replaced = true;
 
-                // Now delete the elements we have marked for deletion.
-                auto remaining_entries = line.entries.begin();
-                for (const auto &entry : line.entries)
-                  if (entry.first != numbers::invalid_size_type)
-                    {
-                      *remaining_entries = entry;
-                      ++remaining_entries;
-                    }
-                line.entries.erase(remaining_entries, line.entries.end());
+                line.inhomogeneity += constrained_line.inhomogeneity * weight;
               }
           }
 
-      if constexpr (running_in_debug_mode())
-        {
-          // increase iteration count. note that we should not iterate more
-          // times than there are constraints, since this puts a natural upper
-          // bound on the length of constraint chains
-          ++iteration;
-          Assert(iteration <= lines.size() + 1, ExcInternalError());
-        }
+        // Now delete the elements we have marked for deletion.
+        auto remaining_entries = line.entries.begin();
+        for (const auto &entry : line.entries)
+          if (entry.first != numbers::invalid_size_type)
+            {
+              *remaining_entries = entry;
+              ++remaining_entries;
+            }
+        line.entries.erase(remaining_entries, line.entries.end());
+      }
+
+    line_finalized_in_this_round[line_index] = 1;
+  };
+
+  while (remaining_lines.empty() == false)
+    {
+      parallel::apply_to_subranges(
+        remaining_lines.cbegin(),
+        remaining_lines.cend(),
+        [&](const typename std::vector<size_type>::const_iterator begin,
+            const typename std::vector<size_type>::const_iterator end) {
+          for (auto line_index = begin; line_index != end; ++line_index)
+            resolve_line(*line_index);
+        },
+        /* grainsize = */ 100);
+
+      // now record which lines have been finalized in this round, and
+      // remove them from the list of lines still to be worked on
+      const size_type n_remaining_lines = remaining_lines.size();
+      for (const size_type line_index : remaining_lines)
+        line_finalized[line_index] = line_finalized_in_this_round[line_index];
+      remaining_lines.erase(
+        std::remove_if(remaining_lines.begin(),
+                       remaining_lines.end(),
+                       [&](const size_type line_index) {
+                         return line_finalized[line_index] == 1;
+                       }),
+        remaining_lines.end());
+
+      AssertThrow(remaining_lines.size() < n_remaining_lines,
+                  ExcMessage("Cycle in constraints detected!"));
     }
-  while (chained_constraint_replaced == true);
 
   // Finally sort the entries and re-scale them if necessary. in this step,
   // we also throw out duplicates as mentioned above. moreover, as some
@@ -106,6 +106,59 @@ FunctionParser<dim>::value(const Point<dim>  &p,
   return this->do_value(p, this->get_time(), component);
 }
 
+
+
+template <int dim>
+void
+FunctionParser<dim>::vector_value(const Point<dim> &p,
+                                  Vector<double>   &values) const
+{
+  AssertDimension(values.size(), this->n_components);
+  ArrayView<double> values_view = make_array_view(values.begin(), values.end());
+  this->do_all_values(p, this->get_time(), values_view);
+}
+
+
+
+template <int dim>
+void
+FunctionParser<dim>::value_list(const std::vector<Point<dim>> &points,
+                                std::vector<double>           &values,
+                                const unsigned int             component) const
+{
+  AssertDimension(values.size(), points.size());
+  this->do_value_list(make_array_view(points),
+                      this->get_time(),
+                      component,
+                      make_array_view(values));
+}
+
+
+
+template <int dim>
+void
+FunctionParser<dim>::vector_value_list(
+  const std::vector<Point<dim>> &points,
+  std::vector<Vector<double>>   &values) const
+{
+  AssertDimension(values.size(), points.size());
+  const unsigned int n_points = points.size();
+
+  // evaluate all components at once into a component-major scratch array
+  // and then scatter the result into the output vectors
+  std::vector<double> all_values(this->n_components * n_points);
+  this->do_all_values_list(make_array_view(points),
+                           this->get_time(),
+                           make_array_view(all_values));
+
+  for (unsigned int q = 0; q < n_points; ++q)
+    {
+      AssertDimension(values[q].size(), this->n_components);
+      for (unsigned int c = 0; c < this->n_components; ++c)
+        values[q][c] = all_values[c * n_points + q];
+    }
+}
+
 // Explicit Instantiations.
 
 template class FunctionParser<1>;
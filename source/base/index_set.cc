@@ -49,6 +49,7 @@ IndexSet::IndexSet(
   const Teuchos::RCP<
     const Tpetra::Map<int, types::signed_global_dof_index, NodeType>> &map)
   : is_compressed(true)
+  , use_range_lookup(false)
   , index_space_size(1 + map->getMaxAllGlobalIndex())
   , largest_range(numbers::invalid_unsigned_int)
 {
@@ -85,6 +86,7 @@ IndexSet::IndexSet(
 
 IndexSet::IndexSet(const Epetra_BlockMap &map)
   : is_compressed(true)
+  , use_range_lookup(false)
   , index_space_size(1 + map.MaxAllGID64())
   , largest_range(numbers::invalid_unsigned_int)
 {
@@ -112,6 +114,7 @@ IndexSet::IndexSet(const Epetra_BlockMap &map)
 
 IndexSet::IndexSet(const Epetra_BlockMap &map)
   : is_compressed(true)
+  , use_range_lookup(false)
   , index_space_size(1 + map.MaxAllGID())
   , largest_range(numbers::invalid_unsigned_int)
 {
@@ -139,6 +142,52 @@ IndexSet::IndexSet(const Epetra_BlockMap &map)
 
 
 
+namespace
+{
+  /**
+   * The number of ranges starting from which compress() sets up the lookup
+   * tables for the search of ranges. For fewer ranges, a binary search over
+   * all ranges is just as fast.
+   */
+  constexpr unsigned int min_n_ranges_for_lookup = 16;
+} // namespace
+
+
+
+template <typename RangeEndFunction>
+void
+IndexSet::RangeLookup::reinit(const size_type         first_key,
+                              const size_type         end_key,
+                              const unsigned int      n_ranges,
+                              const RangeEndFunction &range_end)
+{
+  Assert(end_key > first_key, ExcInternalError());
+  Assert(n_ranges > 0, ExcInternalError());
+
+  // choose the bucket size such that there are not more buckets than ranges
+  const size_type n_keys = end_key - first_key;
+  offset                 = first_key;
+  end                    = end_key;
+  shift                  = 0;
+  while ((n_keys >> shift) > n_ranges)
+    ++shift;
+
+  const size_type n_buckets = ((n_keys - 1) >> shift) + 1;
+  first_range.resize(n_buckets + 1);
+
+  unsigned int range = 0;
+  for (size_type b = 0; b < n_buckets; ++b)
+    {
+      const size_type bucket_begin = first_key + (b << shift);
+      while (range_end(range) <= bucket_begin)
+        ++range;
+      first_range[b] = range;
+    }
+  first_range[n_buckets] = n_ranges - 1;
+}
+
+
+
 void
 IndexSet::do_compress() const
 {
@@ -197,6 +246,31 @@ IndexSet::do_compress() const
             largest_range      = i - ranges.begin();
           }
       }
+
+    // finally set up the lookup tables for index sets with many ranges if
+    // requested, which are otherwise searched by a binary search over all
+    // ranges
+    range_lookup.reset();
+    if (use_range_lookup && ranges.size() >= min_n_ranges_for_lookup &&
+        ranges.size() < numbers::invalid_unsigned_int)
+      {
+        auto tables = std::make_shared<RangeLookupTables>();
+        tables->global_indices.reinit(ranges.front().begin,
+                                      ranges.back().end,
+                                      ranges.size(),
+                                      [this](const unsigned int r) {
+                                        return ranges[r].end;
+                                      });
+        tables->local_indices.reinit(0,
+                                     next_index,
+                                     ranges.size(),
+                                     [this](const unsigned int r) {
+                                       return ranges[r].nth_index_in_set +
+                                              (ranges[r].end -
+                                               ranges[r].begin);
+                                     });
+        range_lookup = std::move(tables);
+      }
     is_compressed = true;
 
     // check that next_index is correct. needs to be after the previous
@@ -568,7 +642,19 @@ IndexSet::pop_back()
   --ranges.back().end;
 
   if (ranges.back().begin == ranges.back().end)
-    ranges.pop_back();
+    {
+      ranges.pop_back();
+
+      // the largest range might have been the one we just removed
+      if (largest_range >= ranges.size())
+        is_compressed = false;
+    }
+
+  // the lookup tables still refer to the old end of the last range, so
+  // searches for the removed index would be directed to a range that no
+  // longer contains it. fall back to the plain binary search until the
+  // next call to compress() rebuilds them
+  range_lookup.reset();
 
   return index;
 }
@@ -643,6 +729,7 @@ IndexSet::add_ranges_internal(
         {
           if (this->ranges.size() == 1)
             tmp_set.add_range(ranges[0].begin, ranges[0].end);
+          tmp_set.use_range_lookup = use_range_lookup;
           std::swap(*this, tmp_set);
         }
       else
@@ -804,9 +891,41 @@ IndexSet::block_read(std::istream &in)
 
 
 
+std::pair<unsigned int, unsigned int>
+IndexSet::RangeLookup::candidate_ranges(const size_type key) const
+{
+  if (key < offset || key >= end)
+    return {0, 0};
+
+  const size_type bucket = (key - offset) >> shift;
+  if (bucket + 1 >= first_range.size())
+    return {0, 0};
+
+  return {first_range[bucket], first_range[bucket + 1] + 1};
+}
+
+
+
 bool
 IndexSet::is_element_binary_search(const size_type index) const
 {
+  // if the set consists of many ranges, use the lookup table to restrict the
+  // search to the few ranges that can contain the index. the range we are
+  // looking for is the first one that ends after the index
+  const auto candidates =
+    (range_lookup ? range_lookup->global_indices.candidate_ranges(index) :
+                    std::pair<unsigned int, unsigned int>(0, 0));
+  if (candidates.first < candidates.second)
+    {
+      const std::vector<Range>::const_iterator p =
+        Utilities::lower_bound(ranges.begin() + candidates.first,
+                               ranges.begin() + candidates.second,
+                               Range(index + 1, index + 1),
+                               Range::end_compare);
+      Assert(p != ranges.begin() + candidates.second, ExcInternalError());
+      return (p->begin <= index);
+    }
+
   // get the element after which we would have to insert a range that
   // consists of all elements from this element to the end of the index
   // range plus one. after this call we know that if p!=end() then
@@ -848,8 +967,22 @@ IndexSet::nth_index_in_set_binary_search(const size_type n) const
   Range r(n, n + 1);
   r.nth_index_in_set = n;
 
-  const std::vector<Range>::const_iterator p = Utilities::lower_bound(
-    ranges.begin(), ranges.end(), r, Range::nth_index_compare);
+  // restrict the search to the candidates given by the lookup table, if the
+  // table is in use
+  const auto candidates =
+    (range_lookup ? range_lookup->local_indices.candidate_ranges(n) :
+                    std::pair<unsigned int, unsigned int>(0, 0));
+
+  const std::vector<Range>::const_iterator p =
+    (candidates.first < candidates.second ?
+       Utilities::lower_bound(ranges.begin() + candidates.first,
+                              ranges.begin() + candidates.second,
+                              r,
+                              Range::nth_index_compare) :
+       Utilities::lower_bound(ranges.begin(),
+                              ranges.end(),
+                              r,
+                              Range::nth_index_compare));
 
   Assert(p != ranges.end(), ExcInternalError());
   return p->begin + (n - p->nth_index_in_set);
@@ -862,10 +995,24 @@ IndexSet::index_within_set_binary_search(const size_type n) const
 {
   // we could try to use the main range for splitting up the search range, but
   // since we only come here when the largest range did not contain the index,
-  // there is little gain from doing a first step manually.
-  Range                              r(n, n);
-  std::vector<Range>::const_iterator p =
-    Utilities::lower_bound(ranges.begin(), ranges.end(), r, Range::end_compare);
+  // there is little gain from doing a first step manually. if the set
+  // consists of many ranges, the lookup table gives a much smaller range of
+  // candidates, though.
+  const Range r(n, n);
+  const auto  candidates =
+    (range_lookup ? range_lookup->global_indices.candidate_ranges(n) :
+                    std::pair<unsigned int, unsigned int>(0, 0));
+
+  const std::vector<Range>::const_iterator p =
+    (candidates.first < candidates.second ?
+       Utilities::lower_bound(ranges.begin() + candidates.first,
+                              ranges.begin() + candidates.second,
+                              r,
+                              Range::end_compare) :
+       Utilities::lower_bound(ranges.begin(),
+                              ranges.end(),
+                              r,
+                              Range::end_compare));
 
   // if n is not in this set
   if (p == ranges.end() || p->end == n || p->begin > n)
@@ -1220,6 +1367,12 @@ IndexSet::memory_consumption() const
   return (MemoryConsumption::memory_consumption(ranges) +
           MemoryConsumption::memory_consumption(is_compressed) +
           MemoryConsumption::memory_consumption(index_space_size) +
+          (range_lookup ?
+             MemoryConsumption::memory_consumption(
+               range_lookup->global_indices.first_range) +
+               MemoryConsumption::memory_consumption(
+                 range_lookup->local_indices.first_range) :
+             0) +
           sizeof(compress_mutex));
 }
 
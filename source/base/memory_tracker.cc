@@ -0,0 +1,267 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_tracker.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
+#include <boost/io/ios_state.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+MemoryTracker::MemoryTracker(std::ostream &stream)
+  : out_stream(stream, true)
+{}
+
+
+
+MemoryTracker::MemoryTracker(const ConditionalOStream &stream)
+  : out_stream(stream)
+{}
+
+
+
+void
+MemoryTracker::enter_subsection(const std::string &section_name)
+{
+  Assert(section_name.empty() == false, ExcMessage("Section string is empty."));
+
+  Utilities::System::MemoryStats stats;
+  Utilities::System::get_memory_stats(stats);
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Section &section = sections[section_name];
+  Assert(section.active == false,
+         ExcMessage("Cannot enter the already active section <" +
+                    section_name + ">."));
+  section.active            = true;
+  section.rss_at_entry      = stats.VmRSS;
+  section.peak_rss_at_entry = stats.VmHWM;
+}
+
+
+
+void
+MemoryTracker::leave_subsection(const std::string &section_name)
+{
+  Utilities::System::MemoryStats stats;
+  Utilities::System::get_memory_stats(stats);
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const auto section_it = sections.find(section_name);
+  Assert(section_it != sections.end() && section_it->second.active,
+         ExcMessage("Cannot leave the section <" + section_name +
+                    "> that has not been entered."));
+  Section &section = section_it->second;
+  section.active   = false;
+
+  // if the peak resident set size of the process has grown while we were in
+  // this section, then the section itself must have temporarily used
+  // at least as much memory as the difference between the new peak and the
+  // resident set size at entry
+  if (stats.VmHWM > section.peak_rss_at_entry &&
+      stats.VmHWM > section.rss_at_entry)
+    section.peak_memory =
+      std::max<std::size_t>(section.peak_memory,
+                            section.current_memory +
+                              1024 * (stats.VmHWM - section.rss_at_entry));
+
+  // now attribute the growth (or shrinkage) of the resident set size to the
+  // section, without letting the current memory become negative
+  if (stats.VmRSS >= section.rss_at_entry)
+    section.current_memory += 1024 * (stats.VmRSS - section.rss_at_entry);
+  else
+    section.current_memory -=
+      std::min<std::size_t>(section.current_memory,
+                            1024 * (section.rss_at_entry - stats.VmRSS));
+
+  section.peak_memory = std::max(section.peak_memory, section.current_memory);
+}
+
+
+
+void
+MemoryTracker::record(const std::string &section_name,
+                      const std::size_t  n_bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Section &section       = sections[section_name];
+  section.current_memory = n_bytes;
+  section.peak_memory    = std::max(section.peak_memory, n_bytes);
+}
+
+
+
+std::size_t
+MemoryTracker::get_current_memory(const std::string &section_name) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const auto section = sections.find(section_name);
+  return (section != sections.end() ? section->second.current_memory : 0);
+}
+
+
+
+std::size_t
+MemoryTracker::get_peak_memory(const std::string &section_name) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const auto section = sections.find(section_name);
+  return (section != sections.end() ? section->second.peak_memory : 0);
+}
+
+
+
+void
+MemoryTracker::print_summary(const MPI_Comm mpi_comm) const
+{
+  // we are going to change the precision and width of output below. store the
+  // old values so the get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out_stream.get_stream());
+
+  // copy the recorded information, so that other threads can go on
+  // recording while we print
+  std::map<std::string, Section> local_sections;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    local_sections = sections;
+  }
+
+  // the processes need to take part in the same reductions below, so
+  // collect the names of the subsystems recorded on any of them. a subsystem
+  // that has not been recorded on a process counts with zero bytes there
+  std::set<std::string> section_names;
+  {
+    std::vector<std::string> local_names;
+    for (const auto &i : local_sections)
+      local_names.push_back(i.first);
+    for (const auto &names : Utilities::MPI::all_gather(mpi_comm, local_names))
+      section_names.insert(names.begin(), names.end());
+  }
+
+  const std::string process_current = "Process (resident set size)";
+
+  // get the maximum width among all sections
+  unsigned int max_width = process_current.size();
+  for (const auto &name : section_names)
+    max_width = std::max(max_width, static_cast<unsigned int>(name.size()));
+  max_width += 1;
+
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  const auto print_name = [&](const std::string &name) {
+    std::string name_out = name;
+    name_out.resize(max_width, ' ');
+    out_stream << "| " << name_out << "|";
+  };
+
+  const auto print_value_and_rank = [&](const double       value,
+                                        const unsigned int rank) {
+    out_stream << std::setw(10) << std::setprecision(4) << std::right;
+    out_stream << value << "MB";
+    out_stream << std::setw(5) << std::right;
+    out_stream << rank << (n_ranks > 99999 ? "" : " ") << "|";
+  };
+
+  // print the minimum, average, and maximum of the current memory, followed
+  // by the maximum of the peak memory over all processes. all values are
+  // given in bytes, but printed in MB
+  const auto print_statistics = [&](const double current_bytes,
+                                    const double peak_bytes) {
+    const Utilities::MPI::MinMaxAvg current =
+      Utilities::MPI::min_max_avg(current_bytes / 1024. / 1024., mpi_comm);
+    const Utilities::MPI::MinMaxAvg peak =
+      Utilities::MPI::min_max_avg(peak_bytes / 1024. / 1024., mpi_comm);
+
+    print_value_and_rank(current.min, current.min_index);
+    out_stream << std::setw(10) << std::setprecision(4) << std::right;
+    out_stream << current.avg << "MB |";
+    print_value_and_rank(current.max, current.max_index);
+    print_value_and_rank(peak.max, peak.max_index);
+    out_stream << '\n';
+  };
+
+  const std::string separator = "+" + std::string(max_width + 1, '-') + "+" +
+                                std::string(18, '-') + "+" +
+                                std::string(13, '-') + "+" +
+                                std::string(18, '-') + "+" +
+                                std::string(18, '-') + "+\n";
+
+  out_stream << '\n' << separator;
+  print_name("Memory consumption");
+  out_stream << std::setw(18) << "min current " << "|" << std::setw(13)
+             << "avg current " << "|" << std::setw(18) << "max current "
+             << "|" << std::setw(18) << "max peak " << "|\n";
+  print_name("Subsystem");
+  out_stream << std::setw(18) << "MB  rank " << "|" << std::setw(13) << "MB "
+             << "|" << std::setw(18) << "MB  rank " << "|" << std::setw(18)
+             << "MB  rank "
+             << "|\n";
+  out_stream << separator;
+
+  for (const auto &name : section_names)
+    {
+      const auto section = local_sections.find(name);
+      print_name(name);
+      if (section != local_sections.end())
+        print_statistics(section->second.current_memory,
+                         section->second.peak_memory);
+      else
+        print_statistics(0., 0.);
+    }
+  out_stream << separator;
+
+  Utilities::System::MemoryStats stats;
+  Utilities::System::get_memory_stats(stats);
+  print_name(process_current);
+  print_statistics(1024. * stats.VmRSS, 1024. * stats.VmHWM);
+  out_stream << separator << std::endl;
+}
+
+
+
+void
+MemoryTracker::reset()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  sections.clear();
+}
+
+
+
+MemoryTracker::Scope::~Scope()
+{
+  try
+    {
+      stop();
+    }
+  catch (...)
+    {}
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -16,6 +16,7 @@
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
+#include <algorithm>
 #include <cmath>
 #include <ctime>
 #include <limits>
@@ -315,7 +316,8 @@ namespace internal
 
       // initialize the objects for the current thread
       data.parsers.reserve(n_components);
-      data.vars.resize(this->var_names.size());
+      data.vars.resize(this->var_names.size() * bulk_size);
+      data.bulk_values.resize(bulk_size);
       for (unsigned int component = 0; component < n_components; ++component)
         {
           data.parsers.emplace_back(std::make_unique<Parser>());
@@ -325,7 +327,7 @@ namespace internal
             parser.DefineConst(constant.first, constant.second);
 
           for (unsigned int iv = 0; iv < this->var_names.size(); ++iv)
-            parser.DefineVar(this->var_names[iv], &data.vars[iv]);
+            parser.DefineVar(this->var_names[iv], &data.vars[iv * bulk_size]);
 
           // define some compatibility functions:
           parser.DefineFun("if", mu_if, true);
@@ -422,9 +424,9 @@ namespace internal
         init_muparser();
 
       for (unsigned int i = 0; i < dim; ++i)
-        data.vars[i] = p[i];
+        data.vars[i * bulk_size] = p[i];
       if (dim != this->n_vars)
-        data.vars[dim] = time;
+        data.vars[dim * bulk_size] = time;
 
       try
         {
@@ -470,9 +472,9 @@ namespace internal
         init_muparser();
 
       for (unsigned int i = 0; i < dim; ++i)
-        data.vars[i] = p[i];
+        data.vars[i * bulk_size] = p[i];
       if (dim != this->n_vars)
-        data.vars[dim] = time;
+        data.vars[dim * bulk_size] = time;
 
       AssertDimension(values.size(), data.parsers.size());
       try
@@ -506,6 +508,150 @@ namespace internal
 #endif
     }
 
+
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::set_bulk_variables(
+      const ArrayView<const Point<dim>> &points,
+      const unsigned int                 first_point,
+      const unsigned int                 n_points,
+      const double                       time,
+      ParserData                        &data) const
+    {
+      AssertIndexRange(n_points, bulk_size + 1);
+      for (unsigned int i = 0; i < dim; ++i)
+        {
+          double *const var = data.vars.data() + i * bulk_size;
+          for (unsigned int q = 0; q < n_points; ++q)
+            var[q] = points[first_point + q][i];
+        }
+      if (dim != this->n_vars)
+        std::fill_n(data.vars.data() + dim * bulk_size, n_points, time);
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::do_value_list(
+      const ArrayView<const Point<dim>> &points,
+      const double                       time,
+      const unsigned int                 component,
+      const ArrayView<Number>           &values) const
+    {
+#ifdef DEAL_II_WITH_MUPARSER
+      Assert(this->initialized == true, ExcNotInitialized());
+      AssertDimension(values.size(), points.size());
+
+      // initialize the parser if that hasn't happened yet on the current
+      // thread
+      internal::FunctionParser::ParserData &data = this->parser_data.get();
+      if (data.vars.empty())
+        init_muparser();
+
+      AssertIndexRange(component, data.parsers.size());
+      try
+        {
+          Assert(dynamic_cast<Parser *>(data.parsers[component].get()),
+                 ExcInternalError());
+          // NOLINTNEXTLINE don't warn about using static_cast once we check
+          mu::Parser &parser = static_cast<Parser &>(*data.parsers[component]);
+
+          for (unsigned int first = 0; first < points.size();
+               first += bulk_size)
+            {
+              const unsigned int n_points =
+                std::min<unsigned int>(bulk_size, points.size() - first);
+              set_bulk_variables(points, first, n_points, time, data);
+              parser.Eval(data.bulk_values.data(), n_points);
+              for (unsigned int q = 0; q < n_points; ++q)
+                values[first + q] = data.bulk_values[q];
+            }
+        } // try
+      catch (mu::ParserError &e)
+        {
+          std::cerr << "Message:  <" << e.GetMsg() << ">\n";
+          std::cerr << "Formula:  <" << e.GetExpr() << ">\n";
+          std::cerr << "Token:    <" << e.GetToken() << ">\n";
+          std::cerr << "Position: <" << e.GetPos() << ">\n";
+          std::cerr << "Errc:     <" << e.GetCode() << ">" << std::endl;
+          AssertThrow(false, ExcParseError(e.GetCode(), e.GetMsg()));
+        } // catch
+#else
+      (void)points;
+      (void)time;
+      (void)component;
+      (void)values;
+      AssertThrow(false, ExcNeedsFunctionparser());
+#endif
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::do_all_values_list(
+      const ArrayView<const Point<dim>> &points,
+      const double                       time,
+      const ArrayView<Number>           &values) const
+    {
+#ifdef DEAL_II_WITH_MUPARSER
+      Assert(this->initialized == true, ExcNotInitialized());
+
+      // initialize the parser if that hasn't happened yet on the current
+      // thread
+      internal::FunctionParser::ParserData &data = this->parser_data.get();
+      if (data.vars.empty())
+        init_muparser();
+
+      const unsigned int n_components = data.parsers.size();
+      AssertDimension(values.size(), n_components * points.size());
+      try
+        {
+          // set the variables of each batch of points only once and then
+          // evaluate all components for the batch
+          for (unsigned int first = 0; first < points.size();
+               first += bulk_size)
+            {
+              const unsigned int n_points =
+                std::min<unsigned int>(bulk_size, points.size() - first);
+              set_bulk_variables(points, first, n_points, time, data);
+              for (unsigned int component = 0; component < n_components;
+                   ++component)
+                {
+                  Assert(dynamic_cast<Parser *>(data.parsers[component].get()),
+                         ExcInternalError());
+                  mu::Parser &parser =
+                    // We just checked that the pointer is valid so suppress
+                    // the clang-tidy check
+                    static_cast<Parser &>(*data.parsers[component]); // NOLINT
+                  parser.Eval(data.bulk_values.data(), n_points);
+
+                  Number *const component_values =
+                    values.data() + component * points.size() + first;
+                  for (unsigned int q = 0; q < n_points; ++q)
+                    component_values[q] = data.bulk_values[q];
+                }
+            }
+        } // try
+      catch (mu::ParserError &e)
+        {
+          std::cerr << "Message:  <" << e.GetMsg() << ">\n";
+          std::cerr << "Formula:  <" << e.GetExpr() << ">\n";
+          std::cerr << "Token:    <" << e.GetToken() << ">\n";
+          std::cerr << "Position: <" << e.GetPos() << ">\n";
+          std::cerr << "Errc:     <" << e.GetCode() << ">" << std::endl;
+          AssertThrow(false, ExcParseError(e.GetCode(), e.GetMsg()));
+        } // catch
+#else
+      (void)points;
+      (void)time;
+      (void)values;
+      AssertThrow(false, ExcNeedsFunctionparser());
+#endif
+    }
+
+
 // explicit instantiations
 #include "base/mu_parser_internal.inst"
 
@@ -124,9 +124,23 @@ TensorFunctionParser<rank, dim, Number>::value_list(
   Assert(p.size() == values.size(),
          ExcDimensionMismatch(p.size(), values.size()));
 
-  for (unsigned int i = 0; i < p.size(); ++i)
+  const unsigned int n_points = p.size();
+
+  // evaluate all components at all points at once and then assemble the
+  // tensors point by point from the component-major result array
+  std::vector<Number> all_values(n_components * n_points);
+  this->do_all_values_list(make_array_view(p),
+                           this->get_time(),
+                           make_array_view(all_values));
+
+  std::array<Number, Tensor<rank, dim, Number>::n_independent_components>
+    point_values;
+  for (unsigned int q = 0; q < n_points; ++q)
     {
-      values[i] = value(p[i]);
+      for (unsigned int c = 0; c < n_components; ++c)
+        point_values[c] = all_values[c * n_points + q];
+      values[q] = Tensor<rank, dim, Number>(
+        make_array_view(point_values.begin(), point_values.end()));
     }
 }
 
@@ -22,11 +22,15 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <type_traits>
 
 #ifdef DEAL_II_HAVE_SYS_RESOURCE_H
@@ -301,6 +305,7 @@ TimerOutput::TimerOutput(std::ostream         &stream,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , record_trace(false)
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
@@ -313,6 +318,7 @@ TimerOutput::TimerOutput(ConditionalOStream   &stream,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , record_trace(false)
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
@@ -326,6 +332,7 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , record_trace(false)
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
@@ -339,6 +346,7 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , record_trace(false)
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
@@ -425,11 +433,26 @@ TimerOutput::enter_subsection(const std::string &section_name)
       sections[section_name].n_calls         = 0;
     }
 
-  sections[section_name].timer.reset();
-  sections[section_name].timer.start();
-  ++sections[section_name].n_calls;
+  Section &section = sections[section_name];
+  section.timer.reset();
+  section.timer.start();
+  ++section.n_calls;
 
   active_sections.push_back(section_name);
+
+  // the section is nested in the sections that are active on the same
+  // thread
+  section.thread = std::this_thread::get_id();
+  std::vector<std::string> &thread_active_sections =
+    active_sections_of_thread[section.thread];
+  thread_active_sections.push_back(section_name);
+  section.path = thread_active_sections;
+
+  // sections entered while no trace is recorded must not create a trace
+  // event when they are left, even if recording is enabled in between
+  section.trace_start_time = (record_trace ?
+                                timer_all.wall_time() :
+                                std::numeric_limits<double>::quiet_NaN());
 }
 
 
@@ -468,6 +491,28 @@ TimerOutput::leave_subsection(const std::string &section_name)
   const double cpu_time = sections[actual_section_name].timer.last_cpu_time();
   sections[actual_section_name].total_cpu_time += cpu_time;
 
+  // attribute the time to the path of sections that were active when this
+  // section was entered
+  const Section &section = sections[actual_section_name];
+  {
+    const auto nested = nested_sections.try_emplace(section.path,
+                                                    NestedSection{0., 0});
+    nested.first->second.total_wall_time += section.timer.last_wall_time();
+    ++nested.first->second.n_calls;
+  }
+
+  if (record_trace && !std::isnan(section.trace_start_time))
+    {
+      const unsigned int thread_index =
+        thread_indices
+          .try_emplace(std::this_thread::get_id(), thread_indices.size())
+          .first->second;
+      trace_events.push_back({actual_section_name,
+                              section.trace_start_time,
+                              timer_all.wall_time() - section.trace_start_time,
+                              thread_index});
+    }
+
   // in case we have to print out something, do that here...
   if ((output_frequency == every_call ||
        output_frequency == every_call_and_summary) &&
@@ -494,6 +539,17 @@ TimerOutput::leave_subsection(const std::string &section_name)
   active_sections.erase(std::find(active_sections.begin(),
                                   active_sections.end(),
                                   actual_section_name));
+
+  const auto thread_active_sections =
+    active_sections_of_thread.find(section.thread);
+  Assert(thread_active_sections != active_sections_of_thread.end(),
+         ExcInternalError());
+  thread_active_sections->second.erase(
+    std::find(thread_active_sections->second.begin(),
+              thread_active_sections->second.end(),
+              actual_section_name));
+  if (thread_active_sections->second.empty())
+    active_sections_of_thread.erase(thread_active_sections);
 }
 
 
@@ -1010,6 +1066,255 @@ TimerOutput::print_wall_time_statistics(const MPI_Comm mpi_comm,
 
 
 
+void
+TimerOutput::print_nested_summary(const MPI_Comm mpi_comm) const
+{
+  // we are going to change the precision and width of output below. store the
+  // old values so the get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out_stream.get_stream());
+
+  std::map<std::vector<std::string>, NestedSection> local_nested_sections;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    local_nested_sections = nested_sections;
+  }
+
+  // the processes may have encountered different paths of nested sections,
+  // so collect all of them. a path not encountered on a process counts with
+  // zero calls and zero time there
+  std::vector<std::vector<std::string>> paths;
+  {
+    std::vector<std::vector<std::string>> local_paths;
+    for (const auto &nested : local_nested_sections)
+      local_paths.push_back(nested.first);
+
+    std::set<std::vector<std::string>> all_paths;
+    for (const auto &paths_of_rank :
+         Utilities::MPI::all_gather(mpi_comm, local_paths))
+      all_paths.insert(paths_of_rank.begin(), paths_of_rank.end());
+    paths.assign(all_paths.begin(), all_paths.end());
+  }
+
+  // compute the statistics of all paths and of the total run time, which we
+  // append as the last entry
+  std::vector<double>       local_times(paths.size() + 1, 0.);
+  std::vector<unsigned int> local_n_calls(paths.size(), 0);
+  for (unsigned int i = 0; i < paths.size(); ++i)
+    {
+      const auto nested = local_nested_sections.find(paths[i]);
+      if (nested != local_nested_sections.end())
+        {
+          local_times[i]   = nested->second.total_wall_time;
+          local_n_calls[i] = nested->second.n_calls;
+        }
+    }
+  local_times.back() = timer_all.wall_time();
+
+  const std::vector<Utilities::MPI::MinMaxAvg> times =
+    Utilities::MPI::min_max_avg(local_times, mpi_comm);
+  std::vector<unsigned int> n_calls(paths.size());
+  Utilities::MPI::max(local_n_calls, mpi_comm, n_calls);
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // get the maximum width among all (indented) section names
+  unsigned int max_width = 0;
+  for (const auto &path : paths)
+    max_width =
+      std::max(max_width,
+               static_cast<unsigned int>(2 * (path.size() - 1) +
+                                         path.back().size()));
+
+  // 32 is the default width until | character
+  max_width = std::max(max_width + 1, static_cast<unsigned int>(32));
+  const std::string extra_dash  = std::string(max_width - 32, '-');
+  const std::string extra_space = std::string(max_width - 32, ' ');
+
+  // with several processes, we print the minimum, average, and maximum
+  // instead of the wall time of the only process
+  const std::string time_column  = (n_ranks > 1 ? "------------------+" :
+                                                  "------------+");
+  const std::string time_columns = (n_ranks > 1 ? time_column +
+                                                    "------------+" +
+                                                    time_column :
+                                                  time_column);
+  const std::string time_spaces =
+    (n_ranks > 1 ? "                  |            |                  |" :
+                   "            |");
+
+  const auto print_time = [&](const Utilities::MPI::MinMaxAvg &time) {
+    if (n_ranks == 1)
+      {
+        out_stream << std::setw(10) << std::setprecision(3) << std::right;
+        out_stream << time.avg << "s |";
+      }
+    else
+      {
+        out_stream << std::setw(10) << std::setprecision(3) << std::right;
+        out_stream << time.min << "s ";
+        out_stream << std::setw(5) << std::right;
+        out_stream << time.min_index << (n_ranks > 99999 ? "" : " ") << "|";
+        out_stream << std::setw(10) << std::setprecision(3) << std::right;
+        out_stream << time.avg << "s |";
+        out_stream << std::setw(10) << std::setprecision(3) << std::right;
+        out_stream << time.max << "s ";
+        out_stream << std::setw(5) << std::right;
+        out_stream << time.max_index << (n_ranks > 99999 ? "" : " ") << "|";
+      }
+  };
+
+  out_stream << "\n\n"
+             << "+---------------------------------------------" << extra_dash
+             << "+" << time_columns << "------------+\n"
+             << "| Total wallclock time elapsed since start    " << extra_space
+             << "|";
+  print_time(times.back());
+  out_stream << "            |\n";
+  out_stream << "|                                             " << extra_space
+             << "|" << time_spaces << "            |\n";
+  out_stream << "| Section (nested)                " << extra_space
+             << "| no. calls |";
+  if (n_ranks == 1)
+    out_stream << "  wall time |";
+  else
+    out_stream << " min wall time    |  avg wall  | max wall time    |";
+  out_stream << " % of parent|\n";
+  out_stream << "+---------------------------------" << extra_dash
+             << "+-----------+" << time_columns << "------------+";
+
+  for (unsigned int i = 0; i < paths.size(); ++i)
+    {
+      const std::vector<std::string> &path = paths[i];
+
+      std::string name_out =
+        std::string(2 * (path.size() - 1), ' ') + path.back();
+      name_out.resize(max_width, ' ');
+
+      // find the (average) time of the enclosing section, if it exists. its
+      // path is the current path without the last element
+      double parent_time = times.back().avg;
+      if (path.size() > 1)
+        {
+          const auto parent = std::lower_bound(
+            paths.begin(),
+            paths.end(),
+            std::vector<std::string>(path.begin(), path.end() - 1));
+          if (parent != paths.end() && parent->size() == path.size() - 1 &&
+              std::equal(parent->begin(), parent->end(), path.begin()))
+            parent_time = times[parent - paths.begin()].avg;
+        }
+
+      out_stream << std::endl;
+      out_stream << "| " << name_out;
+      out_stream << "| ";
+      out_stream << std::setw(9);
+      out_stream << n_calls[i] << " |";
+      print_time(times[i]);
+      out_stream << std::setw(10);
+      if (parent_time != 0)
+        {
+          // if run time was less than 0.1%, just print a zero to avoid
+          // printing silly things such as "2.45e-6%". otherwise print the
+          // actual percentage
+          const double fraction = times[i].avg / parent_time;
+          if (fraction > 0.001)
+            {
+              out_stream << std::setprecision(2);
+              out_stream << fraction * 100;
+            }
+          else
+            out_stream << 0.0;
+
+          out_stream << "% |";
+        }
+      else
+        out_stream << 0.0 << "% |";
+    }
+  out_stream << std::endl
+             << "+---------------------------------" << extra_dash
+             << "+-----------+" << time_columns << "------------+\n"
+             << std::endl;
+}
+
+
+
+void
+TimerOutput::enable_trace_recording(const bool record)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  record_trace = record;
+}
+
+
+
+namespace
+{
+  // Escape the characters of a string that are not allowed to appear
+  // verbatim within a JSON string.
+  std::string
+  escape_json_string(const std::string &input)
+  {
+    std::string output;
+    output.reserve(input.size());
+    for (const char c : input)
+      switch (c)
+        {
+          case '"':
+            output += "\\\"";
+            break;
+          case '\\':
+            output += "\\\\";
+            break;
+          case '\n':
+            output += "\\n";
+            break;
+          case '\t':
+            output += "\\t";
+            break;
+          default:
+            output += c;
+        }
+    return output;
+  }
+} // namespace
+
+
+
+void
+TimerOutput::write_trace(std::ostream &out, const MPI_Comm mpi_comm) const
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(mpi_comm);
+
+  // each process converts its own events to JSON objects, separated by
+  // commas. times are given in microseconds
+  std::ostringstream events;
+  events << std::setprecision(16);
+  events << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << my_rank
+         << ",\"args\":{\"name\":\"MPI rank " << my_rank << "\"}}";
+  {
+    // other threads might add events while we are reading them
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const TraceEvent &event : trace_events)
+      events << ",\n{\"name\":\"" << escape_json_string(event.name)
+             << "\",\"cat\":\"section\",\"ph\":\"X\",\"ts\":"
+             << event.start_time * 1e6 << ",\"dur\":" << event.duration * 1e6
+             << ",\"pid\":" << my_rank << ",\"tid\":" << event.thread_index
+             << '}';
+  }
+
+  const std::vector<std::string> all_events =
+    Utilities::MPI::gather(mpi_comm, events.str(), 0);
+
+  if (my_rank == 0)
+    {
+      out << "{\"traceEvents\":[\n";
+      for (unsigned int i = 0; i < all_events.size(); ++i)
+        out << (i > 0 ? ",\n" : "") << all_events[i];
+      out << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+    }
+}
+
+
+
 void
 TimerOutput::disable_output()
 {
@@ -1031,7 +1336,11 @@ TimerOutput::reset()
 {
   std::lock_guard<std::mutex> lock(mutex);
   sections.clear();
+  nested_sections.clear();
+  trace_events.clear();
+  thread_indices.clear();
   active_sections.clear();
+  active_sections_of_thread.clear();
   timer_all.restart();
 }
 
@@ -13,10 +13,16 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/cell_data_transfer.h>
 #include <deal.II/distributed/cell_weights.h>
+#include <deal.II/distributed/tria.h>
 
 #include <deal.II/dofs/dof_accessor.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -210,6 +216,347 @@ namespace parallel
     // Return the cell weight determined by the function of choice.
     return weighting_function(cell, dof_handler.get_fe(fe_index));
   }
+
+
+  // ---------- MeasuredCellWeights ----------
+
+  template <int dim, int spacedim>
+  MeasuredCellWeights<dim, spacedim>::AdditionalData::AdditionalData(
+    const double       smoothing_factor,
+    const double       imbalance_threshold,
+    const unsigned int weight_scale)
+    : smoothing_factor(smoothing_factor)
+    , imbalance_threshold(imbalance_threshold)
+    , weight_scale(weight_scale)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellWeights<dim, spacedim>::ScopedCellTimer::ScopedCellTimer(
+    MeasuredCellWeights<dim, spacedim>                         &weights,
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell)
+    : weights(weights)
+    , cells(1, cell)
+    , start(std::chrono::steady_clock::now())
+  {}
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellWeights<dim, spacedim>::ScopedCellTimer::ScopedCellTimer(
+    MeasuredCellWeights<dim, spacedim> &weights,
+    const std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+      &cells)
+    : weights(weights)
+    , cells(cells)
+    , start(std::chrono::steady_clock::now())
+  {}
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellWeights<dim, spacedim>::ScopedCellTimer::~ScopedCellTimer()
+  {
+    const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    weights.add_cost(cells, elapsed.count());
+  }
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellWeights<dim, spacedim>::MeasuredCellWeights(
+    parallel::TriangulationBase<dim, spacedim> &triangulation,
+    const AdditionalData                       &additional_data)
+    : triangulation(&triangulation)
+    , additional_data(additional_data)
+    , average_cost(0.)
+    , imbalance(1.)
+  {
+    Assert(additional_data.smoothing_factor > 0. &&
+             additional_data.smoothing_factor <= 1.,
+           ExcMessage("The smoothing factor must be in the interval (0,1]."));
+    Assert(additional_data.weight_scale > 0,
+           ExcMessage("The weight scale must be positive."));
+
+    reset();
+
+    // Only parallel::distributed::Triangulation queries the weights when it
+    // is refined or repartitioned. Other triangulations either do not use
+    // the signal or, depending on the partitioner, do not support it.
+    if (dynamic_cast<const parallel::DistributedTriangulationBase<dim, spacedim>
+                       *>(&triangulation) != nullptr)
+      connections.push_back(
+        triangulation.signals.weight.connect(make_weighting_callback()));
+
+    // The estimates refer to the active cell indices, which are no longer
+    // valid once the mesh has changed
+    connections.push_back(
+      triangulation.signals.any_change.connect([this]() { reset(); }));
+    connections.push_back(
+      triangulation.signals.post_distributed_repartition.connect(
+        [this]() { reset(); }));
+  }
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellWeights<dim, spacedim>::~MeasuredCellWeights()
+  {
+    for (auto &connection : connections)
+      connection.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MeasuredCellWeights<dim, spacedim>::add_cost(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const double                                                cost)
+  {
+    Assert(cell->is_active(), ExcMessage("The cell must be active."));
+    Assert(cell->is_locally_owned(),
+           ExcMessage("The cell must be locally owned."));
+    Assert(cost >= 0., ExcMessage("The cost must not be negative."));
+    AssertIndexRange(cell->active_cell_index(), measured_costs.size());
+
+    double &measured_cost = measured_costs[cell->active_cell_index()];
+    measured_cost         = (measured_cost < 0. ? cost : measured_cost + cost);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MeasuredCellWeights<dim, spacedim>::add_cost(
+    const std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+                &cells,
+    const double cost)
+  {
+    for (const auto &cell : cells)
+      add_cost(cell, cost / cells.size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MeasuredCellWeights<dim, spacedim>::finish_step()
+  {
+    AssertDimension(estimated_costs.size(), triangulation->n_active_cells());
+
+    const double alpha = additional_data.smoothing_factor;
+
+    double       sum_of_estimates = 0.;
+    unsigned int n_estimates      = 0;
+    for (const auto &cell : triangulation->active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          const unsigned int index         = cell->active_cell_index();
+          double            &estimate      = estimated_costs[index];
+          double            &measured_cost = measured_costs[index];
+          if (measured_cost >= 0.)
+            estimate = (estimate < 0. ? measured_cost :
+                                        (1. - alpha) * estimate +
+                                          alpha * measured_cost);
+          measured_cost = -1.;
+
+          if (estimate >= 0.)
+            {
+              sum_of_estimates += estimate;
+              ++n_estimates;
+            }
+        }
+
+    const MPI_Comm mpi_communicator = triangulation->get_mpi_communicator();
+    const double   global_sum_of_estimates =
+      Utilities::MPI::sum(sum_of_estimates, mpi_communicator);
+    const unsigned int global_n_estimates =
+      Utilities::MPI::sum(n_estimates, mpi_communicator);
+    average_cost = (global_n_estimates > 0 ?
+                      global_sum_of_estimates / global_n_estimates :
+                      0.);
+
+    // Compute the load imbalance from the estimated costs of the locally
+    // owned cells, where cells without estimate count with the average cost
+    double local_cost = 0.;
+    for (const auto &cell : triangulation->active_cell_iterators())
+      if (cell->is_locally_owned())
+        local_cost += estimate_or_average(cell);
+
+    const Utilities::MPI::MinMaxAvg cost_statistics =
+      Utilities::MPI::min_max_avg(local_cost, mpi_communicator);
+    imbalance =
+      (cost_statistics.avg > 0. ? cost_statistics.max / cost_statistics.avg :
+                                  1.);
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  MeasuredCellWeights<dim, spacedim>::get_cost_estimate(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+  {
+    Assert(cell->is_active(), ExcMessage("The cell must be active."));
+    AssertIndexRange(cell->active_cell_index(), estimated_costs.size());
+    return estimated_costs[cell->active_cell_index()];
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  MeasuredCellWeights<dim, spacedim>::get_imbalance() const
+  {
+    return imbalance;
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  MeasuredCellWeights<dim, spacedim>::needs_repartitioning() const
+  {
+    return imbalance > additional_data.imbalance_threshold;
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  MeasuredCellWeights<dim, spacedim>::repartition_if_imbalanced()
+  {
+    if (needs_repartitioning() == false)
+      return false;
+
+#ifdef DEAL_II_WITH_P4EST
+    const auto tria =
+      dynamic_cast<parallel::distributed::Triangulation<dim, spacedim> *>(
+        &*triangulation);
+    AssertThrow(tria != nullptr,
+                ExcMessage("This function is only implemented for "
+                           "parallel::distributed::Triangulation objects."));
+
+    // Move the estimates along with the cells. The mesh is not refined or
+    // coarsened, so the strategies for these cases are never used.
+    Vector<double> estimates(estimated_costs.begin(), estimated_costs.end());
+    parallel::distributed::CellDataTransfer<dim, spacedim, Vector<double>>
+      cell_data_transfer(*tria);
+    cell_data_transfer.prepare_for_coarsening_and_refinement(estimates);
+
+    tria->repartition();
+
+    // repartition() has reset the data structures via the signals of the
+    // triangulation, so we only need to fill in the transferred estimates
+    estimates.reinit(tria->n_active_cells());
+    cell_data_transfer.unpack(estimates);
+    for (const auto &cell : tria->active_cell_iterators())
+      if (cell->is_locally_owned())
+        estimated_costs[cell->active_cell_index()] =
+          estimates[cell->active_cell_index()];
+
+    // The load is now balanced according to the estimates
+    imbalance = 1.;
+
+    return true;
+#else
+    AssertThrow(false,
+                ExcMessage("This function is only implemented for "
+                           "parallel::distributed::Triangulation objects, "
+                           "which require deal.II to be configured with "
+                           "p4est."));
+    return false;
+#endif
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  MeasuredCellWeights<dim, spacedim>::weight(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const CellStatus                                            status) const
+  {
+    double cost = 0.;
+    switch (status)
+      {
+        case CellStatus::cell_will_persist:
+          cost = estimate_or_average(cell);
+          break;
+
+        case CellStatus::cell_will_be_refined:
+        case CellStatus::cell_invalid:
+          // the function is called for each of the future children, with
+          // the parent as argument: for the first child with
+          // CellStatus::cell_will_be_refined, for the remaining ones with
+          // CellStatus::cell_invalid. split the cost of the parent evenly
+          cost = estimate_or_average(cell) /
+                 GeometryInfo<dim>::max_children_per_cell;
+          break;
+
+        case CellStatus::children_will_be_coarsened:
+          for (const auto &child : cell->child_iterators())
+            cost += estimate_or_average(child);
+          break;
+
+        default:
+          DEAL_II_ASSERT_UNREACHABLE();
+          break;
+      }
+
+    // Without any measurements, all cells have the same weight
+    if (average_cost <= 0.)
+      return additional_data.weight_scale;
+
+    const double result =
+      std::round(additional_data.weight_scale * cost / average_cost);
+
+    Assert(result <=
+             static_cast<double>(std::numeric_limits<unsigned int>::max()),
+           ExcMessage(
+             "Cannot cast determined weight for this cell to unsigned int!"));
+
+    // make sure that every cell has a positive weight
+    return std::max(static_cast<unsigned int>(result), 1U);
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::function<unsigned int(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const CellStatus                                            status)>
+  MeasuredCellWeights<dim, spacedim>::make_weighting_callback() const
+  {
+    return [this](
+             const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+             const CellStatus status) { return weight(cell, status); };
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MeasuredCellWeights<dim, spacedim>::reset()
+  {
+    measured_costs.assign(triangulation->n_active_cells(), -1.);
+    estimated_costs.assign(triangulation->n_active_cells(), -1.);
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  MeasuredCellWeights<dim, spacedim>::estimate_or_average(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+  {
+    AssertIndexRange(cell->active_cell_index(), estimated_costs.size());
+    const double estimate = estimated_costs[cell->active_cell_index()];
+    return (estimate < 0. ? average_cost : estimate);
+  }
 } // namespace parallel
 
 
@@ -21,6 +21,10 @@
 #include <deal.II/grid/cell_id_translator.h>
 #include <deal.II/grid/filtered_iterator.h>
 
+#include <algorithm>
+#include <map>
+#include <numeric>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -308,6 +312,249 @@ namespace RepartitioningPolicyTools
   }
 
 
+
+
+  template <int dim, int spacedim>
+  NodeAwarePolicy<dim, spacedim>::NodeAwarePolicy(
+    const double max_node_imbalance)
+    : max_node_imbalance(max_node_imbalance)
+  {
+    Assert(max_node_imbalance >= 0. && max_node_imbalance < 0.5,
+           ExcMessage("The allowed imbalance between the nodes must be in "
+                      "the range [0, 0.5)."));
+  }
+
+
+
+  template <int dim, int spacedim>
+  NodeAwarePolicy<dim, spacedim>::NodeAwarePolicy(
+    const std::vector<unsigned int> &node_of_process,
+    const double                     max_node_imbalance)
+    : node_of_process(node_of_process)
+    , max_node_imbalance(max_node_imbalance)
+  {
+    Assert(max_node_imbalance >= 0. && max_node_imbalance < 0.5,
+           ExcMessage("The allowed imbalance between the nodes must be in "
+                      "the range [0, 0.5)."));
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<unsigned int>
+  NodeAwarePolicy<dim, spacedim>::get_node_of_process(
+    const MPI_Comm communicator) const
+  {
+    if (node_of_process.empty() == false)
+      {
+        AssertDimension(node_of_process.size(),
+                        Utilities::MPI::n_mpi_processes(communicator));
+        return node_of_process;
+      }
+
+#ifndef DEAL_II_WITH_MPI
+    (void)communicator;
+    return {0};
+#else
+    // identify each node by the smallest rank running on it
+    const unsigned int my_rank = Utilities::MPI::this_mpi_process(communicator);
+
+    MPI_Comm  node_communicator;
+    const int ierr = MPI_Comm_split_type(communicator,
+                                         MPI_COMM_TYPE_SHARED,
+                                         my_rank,
+                                         MPI_INFO_NULL,
+                                         &node_communicator);
+    AssertThrowMPI(ierr);
+    const unsigned int node = Utilities::MPI::min(my_rank, node_communicator);
+    Utilities::MPI::free_communicator(node_communicator);
+
+    return Utilities::MPI::all_gather(communicator, node);
+#endif
+  }
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  NodeAwarePolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    const auto         comm        = tria_in.get_mpi_communicator();
+    const unsigned int n_processes = Utilities::MPI::n_mpi_processes(comm);
+
+    // group the processes by node; within a node, keep the order of the ranks
+    const std::vector<unsigned int> nodes = get_node_of_process(comm);
+    std::map<unsigned int, std::vector<unsigned int>> processes_of_node_map;
+    for (unsigned int p = 0; p < n_processes; ++p)
+      processes_of_node_map[nodes[p]].push_back(p);
+
+    std::vector<std::vector<unsigned int>> processes_of_node;
+    for (auto &[node, processes] : processes_of_node_map)
+      processes_of_node.emplace_back(std::move(processes));
+    const unsigned int n_nodes = processes_of_node.size();
+
+    // first level: split the cells into one contiguous range per node, with
+    // a share of the cells proportional to the number of processes of the
+    // node
+    const types::global_cell_index n_global_active_cells =
+      tria_in.n_global_active_cells();
+
+    std::vector<types::global_cell_index> node_offsets(n_nodes + 1, 0);
+    for (unsigned int n = 0, n_preceding_processes = 0; n < n_nodes; ++n)
+      {
+        n_preceding_processes += processes_of_node[n].size();
+        node_offsets[n + 1] =
+          (static_cast<std::uint64_t>(n_preceding_processes) *
+             n_global_active_cells +
+           n_processes - 1) /
+          n_processes;
+      }
+
+    // then move each boundary between two nodes, within the allowed
+    // imbalance, to the position where the fewest faces are cut. A face
+    // between the cells with the global active cell indices a < b is cut by
+    // a boundary at position x if a < x <= b, i.e., the number of cut faces
+    // grows by one from position a to a+1 and drops by one from position b
+    // to b+1. These changes are collected for the candidate positions in a
+    // window around each boundary and summed over all processes.
+    if (max_node_imbalance > 0. && n_nodes > 1)
+      {
+        std::vector<types::global_cell_index> window_begin(n_nodes - 1);
+        std::vector<types::global_cell_index> window_end(n_nodes - 1);
+        std::vector<unsigned int>             window_offsets(n_nodes, 0);
+        for (unsigned int n = 1; n < n_nodes; ++n)
+          {
+            const auto width = static_cast<types::global_cell_index>(
+              max_node_imbalance *
+              std::min(node_offsets[n] - node_offsets[n - 1],
+                       node_offsets[n + 1] - node_offsets[n]));
+            window_begin[n - 1] = node_offsets[n] - width;
+            window_end[n - 1]   = node_offsets[n] + width + 1;
+            window_offsets[n]   = window_offsets[n - 1] + 2 * width + 1;
+          }
+
+        std::vector<int> cut_changes(window_offsets.back(), 0);
+
+        const auto add_cut_change = [&](const types::global_cell_index x,
+                                        const int change) {
+          const unsigned int w =
+            std::upper_bound(window_begin.begin(), window_begin.end(), x) -
+            window_begin.begin();
+          if (w > 0 && x < window_end[w - 1])
+            cut_changes[window_offsets[w - 1] + (x - window_begin[w - 1])] +=
+              change;
+        };
+
+        // each face is counted once: from the finer side if the cells are on
+        // different levels, and from the cell with the smaller index
+        // otherwise
+        for (const auto &cell : tria_in.active_cell_iterators())
+          if (cell->is_locally_owned())
+            for (const unsigned int f : cell->face_indices())
+              if (cell->at_boundary(f) == false)
+                {
+                  const auto neighbor = cell->neighbor(f);
+                  if (neighbor->has_children())
+                    continue;
+
+                  const types::global_cell_index a =
+                    cell->global_active_cell_index();
+                  const types::global_cell_index b =
+                    neighbor->global_active_cell_index();
+                  if (neighbor->level() == cell->level() && b < a)
+                    continue;
+
+                  add_cut_change(std::min(a, b) + 1, 1);
+                  add_cut_change(std::max(a, b) + 1, -1);
+                }
+
+        Utilities::MPI::sum(cut_changes, comm, cut_changes);
+
+        // pick the position with the fewest cut faces in each window, and
+        // among these the one closest to the balanced position
+        for (unsigned int n = 1; n < n_nodes; ++n)
+          {
+            const auto distance = [&](const types::global_cell_index x) {
+              return x < node_offsets[n] ? node_offsets[n] - x :
+                                           x - node_offsets[n];
+            };
+
+            types::global_cell_index best_position = window_begin[n - 1];
+            int                      best_n_cuts   = 0;
+            int                      n_cuts        = 0;
+            for (types::global_cell_index x = window_begin[n - 1] + 1;
+                 x < window_end[n - 1];
+                 ++x)
+              {
+                n_cuts += cut_changes[window_offsets[n - 1] +
+                                      (x - window_begin[n - 1])];
+                if (n_cuts < best_n_cuts ||
+                    (n_cuts == best_n_cuts &&
+                     distance(x) < distance(best_position)))
+                  {
+                    best_position = x;
+                    best_n_cuts   = n_cuts;
+                  }
+              }
+            node_offsets[n] = best_position;
+          }
+      }
+
+    // second level: split the range of each node evenly among the processes
+    // of the node
+    LinearAlgebra::distributed::Vector<double> partition(
+      tria->global_active_cell_index_partitioner().lock());
+
+    for (const auto i : partition.locally_owned_elements())
+      {
+        const unsigned int n =
+          std::upper_bound(node_offsets.begin(), node_offsets.end(), i) -
+          node_offsets.begin() - 1;
+        const std::vector<unsigned int> &processes = processes_of_node[n];
+        partition[i] =
+          processes[static_cast<std::uint64_t>(i - node_offsets[n]) *
+                    processes.size() / (node_offsets[n + 1] - node_offsets[n])];
+      }
+
+    return partition;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::pair<types::global_cell_index, types::global_cell_index>
+  NodeAwarePolicy<dim, spacedim>::count_ghost_cells(
+    const Triangulation<dim, spacedim> &tria) const
+  {
+    const auto comm = tria.get_mpi_communicator();
+
+    const std::vector<unsigned int> nodes = get_node_of_process(comm);
+
+    const unsigned int my_node = nodes[Utilities::MPI::this_mpi_process(comm)];
+
+    types::global_cell_index n_intra_node_ghost_cells = 0;
+    types::global_cell_index n_inter_node_ghost_cells = 0;
+    for (const auto &cell : tria.active_cell_iterators())
+      if (cell->is_ghost())
+        {
+          if (nodes[cell->subdomain_id()] == my_node)
+            ++n_intra_node_ghost_cells;
+          else
+            ++n_inter_node_ghost_cells;
+        }
+
+    return {Utilities::MPI::sum(n_intra_node_ghost_cells, comm),
+            Utilities::MPI::sum(n_inter_node_ghost_cells, comm)};
+  }
+
+
 } // namespace RepartitioningPolicyTools
 
 
@@ -426,6 +426,19 @@ namespace parallel
 
 
 
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim,
+                       spacedim>::renumber_cells_along_space_filling_curve()
+    {
+      dealii::Triangulation<dim,
+                            spacedim>::renumber_cells_along_space_filling_curve();
+      partition();
+      this->update_number_cache();
+    }
+
+
+
     template <int dim, int spacedim>
     DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
     void Triangulation<dim, spacedim>::create_triangulation(
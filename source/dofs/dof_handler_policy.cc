@@ -15,6 +15,8 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -35,6 +37,7 @@
 #include <deal.II/grid/tria_iterator.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -191,6 +194,38 @@ namespace internal
 
           return identities;
         }
+
+
+
+        /**
+         * Replace every valid DoF index stored in @p indices by its new
+         * number. The arguments @p new_numbers and @p indices_we_care_about
+         * have the same meaning as in Implementation::renumber_dofs(). The
+         * work is split across threads since each entry is treated
+         * independently.
+         */
+        void
+        renumber_stored_dof_indices(
+          std::vector<types::global_dof_index>       &indices,
+          const std::vector<types::global_dof_index> &new_numbers,
+          const IndexSet                             &indices_we_care_about)
+        {
+          dealii::parallel::apply_to_subranges(
+            std::size_t(0),
+            indices.size(),
+            [&](const std::size_t begin, const std::size_t end) {
+              for (std::size_t k = begin; k < end; ++k)
+                {
+                  types::global_dof_index &i = indices[k];
+                  if (i != numbers::invalid_dof_index)
+                    i = ((indices_we_care_about.size() == 0) ?
+                           new_numbers[i] :
+                           new_numbers[indices_we_care_about.index_within_set(
+                             i)]);
+                }
+            },
+            4096);
+        }
       } // namespace
 
 
@@ -1641,6 +1676,228 @@ namespace internal
 
 
 
+        /**
+         * The number of consecutive cells that distribute_dofs_on_threads()
+         * treats as one unit of work.
+         */
+        static constexpr unsigned int n_cells_per_chunk = 128;
+
+
+
+        /**
+         * Multithreaded version of distribute_dofs() for DoFHandler objects
+         * without hp-capabilities, producing exactly the same numbering.
+         *
+         * In the sequential algorithm, the DoFs on a vertex, line, or quad are
+         * numbered by the first cell in the loop that has this object, and
+         * the DoFs in the interior of a cell by the cell itself. We therefore
+         * first determine this owning cell for each object, in parallel and
+         * using atomic minimum operations on the position of cells in the
+         * loop. The loop is then split into chunks of consecutive cells, and
+         * each chunk counts the DoFs on the objects it owns. A prefix sum
+         * over these counts yields the first index of each chunk, after
+         * which all chunks can number their DoFs independently, since every
+         * stored DoF index is written by exactly one cell.
+         */
+        template <int dim, int spacedim>
+        static types::global_dof_index
+        distribute_dofs_on_threads(const types::subdomain_id  subdomain_id,
+                                   DoFHandler<dim, spacedim> &dof_handler)
+        {
+          Assert(dof_handler.hp_capability_enabled == false,
+                 ExcInternalError());
+
+          const Triangulation<dim, spacedim> &tria =
+            dof_handler.get_triangulation();
+          const FiniteElement<dim, spacedim> &fe = dof_handler.get_fe();
+
+          // the cells in the order of the sequential loop
+          std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+            cells;
+          cells.reserve(tria.n_active_cells());
+          for (const auto &cell : dof_handler.active_cell_iterators())
+            if (!cell->is_artificial() &&
+                ((subdomain_id == numbers::invalid_subdomain_id) ||
+                 (cell->subdomain_id() == subdomain_id)))
+              cells.push_back(cell);
+
+          // the position of the first cell that has a vertex (d=0), line
+          // (d=1), or quad (d=2) in the list above. we only need those
+          // objects that are not cells and carry DoFs
+          std::array<std::vector<std::atomic<unsigned int>>, 3> first_cell;
+          const std::array<unsigned int, 3> n_objects = {
+            {tria.n_vertices(),
+             dim > 1 ? tria.n_raw_lines() : 0,
+             dim > 2 ? tria.n_raw_quads() : 0}};
+          const std::array<bool, 3> has_dofs = {
+            {fe.n_dofs_per_vertex() > 0,
+             dim > 1 && fe.n_dofs_per_line() > 0,
+             dim > 2 && fe.max_dofs_per_quad() > 0}};
+          for (unsigned int d = 0; d < 3; ++d)
+            if (has_dofs[d])
+              {
+                first_cell[d] =
+                  std::vector<std::atomic<unsigned int>>(n_objects[d]);
+                for (auto &position : first_cell[d])
+                  position.store(numbers::invalid_unsigned_int,
+                                 std::memory_order_relaxed);
+              }
+
+          const auto take_minimum = [](std::atomic<unsigned int> &position,
+                                       const unsigned int new_position) {
+            unsigned int old_position =
+              position.load(std::memory_order_relaxed);
+            while (new_position < old_position &&
+                   !position.compare_exchange_weak(old_position,
+                                                   new_position,
+                                                   std::memory_order_relaxed))
+              ;
+          };
+
+          // return the global index of the @p i-th object of dimension @p d
+          // of the given cell
+          const auto object_index = [](const auto        &cell,
+                                       const unsigned int d,
+                                       const unsigned int i) -> unsigned int {
+            if (d == 0)
+              return cell->vertex_index(i);
+            if constexpr (dim > 1)
+              if (d == 1)
+                return cell->line_index(i);
+            if constexpr (dim > 2)
+              if (d == 2)
+                return cell->quad_index(i);
+            DEAL_II_ASSERT_UNREACHABLE();
+            return numbers::invalid_unsigned_int;
+          };
+
+          const auto n_objects_of_cell = [](const auto        &cell,
+                                            const unsigned int d) {
+            return (d == 0 ? cell->n_vertices() :
+                             (d == 1 ? cell->n_lines() : cell->n_faces()));
+          };
+
+          dealii::parallel::apply_to_subranges(
+            0u,
+            static_cast<unsigned int>(cells.size()),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int c = begin; c < end; ++c)
+                for (unsigned int d = 0; d < 3; ++d)
+                  if (has_dofs[d])
+                    for (unsigned int i = 0; i < n_objects_of_cell(cells[c], d);
+                         ++i)
+                      take_minimum(
+                        first_cell[d][object_index(cells[c], d, i)], c);
+            },
+            n_cells_per_chunk);
+
+          // for the cell at the given position, mark all entries in the order
+          // in which process_dof_indices() visits the DoFs on vertices, lines,
+          // and quads (but not the interior) that the cell owns, and return
+          // the number of DoFs the cell owns including the interior ones
+          const auto mark_owned_dofs = [&](const unsigned int position,
+                                           std::vector<bool> &owned) {
+            const auto &cell = cells[position];
+            owned.clear();
+            unsigned int n_owned_dofs = 0;
+            for (unsigned int d = 0; d < 3; ++d)
+              if (has_dofs[d])
+                for (unsigned int i = 0; i < n_objects_of_cell(cell, d); ++i)
+                  {
+                    const unsigned int index = object_index(cell, d, i);
+                    const unsigned int n_dofs_on_object =
+                      dof_handler.object_dof_ptr[0][d][index + 1] -
+                      dof_handler.object_dof_ptr[0][d][index];
+                    const bool is_owned =
+                      (first_cell[d][index].load(std::memory_order_relaxed) ==
+                       position);
+                    owned.insert(owned.end(), n_dofs_on_object, is_owned);
+                    if (is_owned)
+                      n_owned_dofs += n_dofs_on_object;
+                  }
+            return n_owned_dofs + fe.template n_dofs_per_object<dim>();
+          };
+
+          // count the DoFs owned by each chunk and compute the first index
+          // of each chunk by a prefix sum
+          const unsigned int n_chunks =
+            (cells.size() + n_cells_per_chunk - 1) / n_cells_per_chunk;
+          std::vector<types::global_dof_index> chunk_start(n_chunks + 1, 0);
+          dealii::parallel::apply_to_subranges(
+            0u,
+            n_chunks,
+            [&](const unsigned int begin, const unsigned int end) {
+              std::vector<bool> owned;
+              for (unsigned int chunk = begin; chunk < end; ++chunk)
+                for (unsigned int c = chunk * n_cells_per_chunk;
+                     c < std::min<std::size_t>((chunk + 1) * n_cells_per_chunk,
+                                               cells.size());
+                     ++c)
+                  chunk_start[chunk + 1] += mark_owned_dofs(c, owned);
+            },
+            1);
+          std::partial_sum(chunk_start.begin(),
+                           chunk_start.end(),
+                           chunk_start.begin());
+
+          Assert(chunk_start.back() <
+                   std::numeric_limits<types::global_dof_index>::max(),
+                 ExcMessage(
+                   "You have reached the maximal number of degrees of "
+                   "freedom that can be stored in the chosen data "
+                   "type. In practice, this can only happen if you "
+                   "are using 32-bit data types. You will have to "
+                   "re-compile deal.II with the "
+                   "`DEAL_II_WITH_64BIT_INDICES' flag set to `ON'."));
+
+          // finally number the DoFs
+          dealii::parallel::apply_to_subranges(
+            0u,
+            n_chunks,
+            [&](const unsigned int begin, const unsigned int end) {
+              std::vector<bool> owned;
+              for (unsigned int chunk = begin; chunk < end; ++chunk)
+                {
+                  types::global_dof_index next_free_dof = chunk_start[chunk];
+                  for (unsigned int c = chunk * n_cells_per_chunk;
+                       c <
+                       std::min<std::size_t>((chunk + 1) * n_cells_per_chunk,
+                                             cells.size());
+                       ++c)
+                    {
+                      mark_owned_dofs(c, owned);
+                      unsigned int i = 0;
+                      DoFAccessorImplementation::Implementation::
+                        process_dof_indices(
+                          *cells[c],
+                          std::make_tuple(),
+                          cells[c]->active_fe_index(),
+                          DoFAccessorImplementation::Implementation::
+                            DoFIndexProcessor<dim, spacedim>(),
+                          [&](auto &stored_index, auto) {
+                            if (i >= owned.size() || owned[i])
+                              {
+                                Assert(stored_index ==
+                                         numbers::invalid_dof_index,
+                                       ExcInternalError());
+                                stored_index = next_free_dof;
+                                ++next_free_dof;
+                              }
+                            ++i;
+                          },
+                          false);
+                    }
+                  Assert(next_free_dof == chunk_start[chunk + 1],
+                         ExcInternalError());
+                }
+            },
+            1);
+
+          return chunk_start.back();
+        }
+
+
+
         /**
          * Distribute degrees of freedom on all cells, or on cells with the
          * correct subdomain_id if the corresponding argument is not equal to
@@ -1655,6 +1912,14 @@ namespace internal
           Assert(dof_handler.get_triangulation().n_levels() > 0,
                  ExcMessage("Empty triangulation"));
 
+          // use several threads for large meshes if possible; this results
+          // in the same numbering as the loop below
+          if (dof_handler.hp_capability_enabled == false &&
+              MultithreadInfo::n_threads() > 1 &&
+              dof_handler.get_triangulation().n_active_cells() >=
+                4 * n_cells_per_chunk)
+            return distribute_dofs_on_threads(subdomain_id, dof_handler);
+
           // distribute dofs on all cells excluding artificial ones
           types::global_dof_index next_free_dof = 0;
 
@@ -1815,11 +2080,9 @@ namespace internal
           DoFHandler<dim, spacedim>                  &dof_handler)
         {
           for (unsigned int d = 1; d < dim; ++d)
-            for (auto &i : dof_handler.object_dof_indices[0][d])
-              if (i != numbers::invalid_dof_index)
-                i = ((indices_we_care_about.size() == 0) ?
-                       new_numbers[i] :
-                       new_numbers[indices_we_care_about.index_within_set(i)]);
+            renumber_stored_dof_indices(dof_handler.object_dof_indices[0][d],
+                                        new_numbers,
+                                        indices_we_care_about);
         }
 
 
@@ -1993,12 +2256,10 @@ namespace internal
               for (unsigned int level = 0;
                    level < dof_handler.object_dof_indices.size();
                    ++level)
-                for (auto &i : dof_handler.object_dof_indices[level][dim])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_stored_dof_indices(
+                  dof_handler.object_dof_indices[level][dim],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
@@ -2079,12 +2340,10 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_stored_dof_indices(
+                  dof_handler.object_dof_indices[0][d],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
@@ -2174,12 +2433,10 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_stored_dof_indices(
+                  dof_handler.object_dof_indices[0][d],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
@@ -61,6 +61,7 @@
 #include <cmath>
 #include <functional>
 #include <map>
+#include <numeric>
 #include <vector>
 
 
@@ -2508,6 +2509,89 @@ namespace DoFRenumbering
 
 
 
+  template <int dim, int spacedim>
+  void
+  space_filling_curve(DoFHandler<dim, spacedim> &dof_handler)
+  {
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.n_locally_owned_dofs(), numbers::invalid_dof_index);
+    compute_space_filling_curve(renumbering, dof_handler);
+
+    dof_handler.renumber_dofs(renumbering);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  compute_space_filling_curve(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler)
+  {
+    const IndexSet &locally_owned_dofs = dof_handler.locally_owned_dofs();
+    const types::global_dof_index n_dofs = locally_owned_dofs.n_elements();
+    Assert(new_dof_indices.size() == n_dofs,
+           ExcDimensionMismatch(new_dof_indices.size(), n_dofs));
+
+    // determine the location of each locally owned DoF on the first
+    // locally owned cell it is found on
+    std::vector<Point<spacedim>> locations(n_dofs);
+    std::vector<bool>            location_known(n_dofs, false);
+    std::vector<types::global_dof_index> local_dof_indices;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          const FiniteElement<dim, spacedim> &fe = cell->get_fe();
+          local_dof_indices.resize(fe.n_dofs_per_cell());
+          cell->get_dof_indices(local_dof_indices);
+
+          const Mapping<dim, spacedim> &mapping =
+            cell->reference_cell()
+              .template get_default_linear_mapping<dim, spacedim>();
+          const Point<spacedim> center = cell->center();
+
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            if (locally_owned_dofs.is_element(local_dof_indices[i]))
+              {
+                const types::global_dof_index index =
+                  locally_owned_dofs.index_within_set(local_dof_indices[i]);
+                if (location_known[index] == false)
+                  {
+                    locations[index] =
+                      fe.has_support_points() ?
+                        mapping.transform_unit_to_real_cell(
+                          cell, fe.unit_support_point(i)) :
+                        center;
+                    location_known[index] = true;
+                  }
+              }
+        }
+    Assert(std::find(location_known.begin(), location_known.end(), false) ==
+             location_known.end(),
+           ExcInternalError());
+
+    // sort the DoFs by their index along the curve, using the old index to
+    // break ties
+    const std::vector<std::array<std::uint64_t, spacedim>> curve_indices =
+      Utilities::inverse_Hilbert_space_filling_curve(locations);
+
+    std::vector<types::global_dof_index> order(n_dofs);
+    std::iota(order.begin(), order.end(), types::global_dof_index(0));
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](const types::global_dof_index a,
+                         const types::global_dof_index b) {
+                       return curve_indices[a] < curve_indices[b];
+                     });
+
+    // reuse the original index space, which is contiguous on the current
+    // process
+    for (types::global_dof_index i = 0; i < n_dofs; ++i)
+      new_dof_indices[order[i]] = locally_owned_dofs.nth_index_in_set(i);
+  }
+
+
+
   template <int dim,
             int spacedim,
             typename Number,
@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
@@ -44,7 +45,10 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <tuple>
+#include <unordered_set>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -334,64 +338,6 @@ namespace DoFTools
 
 
 
-      /**
-       * Make sure that the given @p face_interpolation_matrix pointer points
-       * to a valid matrix. If the pointer is zero beforehand, create an entry
-       * with the correct data. If it is nonzero, don't touch it.
-       */
-      template <int dim, int spacedim>
-      void
-      ensure_existence_of_face_matrix(
-        const FiniteElement<dim, spacedim>  &fe1,
-        const FiniteElement<dim, spacedim>  &fe2,
-        std::unique_ptr<FullMatrix<double>> &matrix)
-      {
-        // TODO: the implementation makes the assumption that all faces have the
-        // same number of dofs
-        AssertDimension(fe1.n_unique_faces(), 1);
-        AssertDimension(fe2.n_unique_faces(), 1);
-        const unsigned int face_no = 0;
-
-        if (matrix == nullptr)
-          {
-            matrix = std::make_unique<FullMatrix<double>>(
-              fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
-            fe1.get_face_interpolation_matrix(fe2, *matrix, face_no);
-          }
-      }
-
-
-
-      /**
-       * Same, but for subface interpolation matrices.
-       */
-      template <int dim, int spacedim>
-      void
-      ensure_existence_of_subface_matrix(
-        const FiniteElement<dim, spacedim>  &fe1,
-        const FiniteElement<dim, spacedim>  &fe2,
-        const unsigned int                   subface,
-        std::unique_ptr<FullMatrix<double>> &matrix)
-      {
-        // TODO: the implementation makes the assumption that all faces have the
-        // same number of dofs
-        AssertDimension(fe1.n_unique_faces(), 1);
-        AssertDimension(fe2.n_unique_faces(), 1);
-        const unsigned int face_no = 0;
-
-        if (matrix == nullptr)
-          {
-            matrix = std::make_unique<FullMatrix<double>>(
-              fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
-            fe1.get_subface_interpolation_matrix(fe2,
-                                                 subface,
-                                                 *matrix,
-                                                 face_no);
-          }
-      }
-
-
-
       /**
        * Given the face interpolation matrix between two elements, split it into
        * its primary and dependent parts and invert the primary part as
@@ -455,25 +401,142 @@ namespace DoFTools
       }
 
 
+    } // namespace
+
+
+
+    /**
+     * A cache for the masks of primary dofs and the split face interpolation
+     * matrices that make_hp_hanging_node_constraints() derives from the
+     * face interpolation matrices stored in an hp::FECollection. Since
+     * several threads may ask for the same entry at the same time, the
+     * entries are created under a lock.
+     */
+    template <int dim, int spacedim>
+    class SplitFaceInterpolationMatrices
+    {
+    public:
       /**
-       * A function that returns how many different finite elements a dof
-       * handler uses. This is one for non-hp-DoFHandlers and
-       * dof_handler.get_fe().size() for the hp-versions.
+       * Constructor.
        */
-      template <int dim, int spacedim>
-      unsigned int
-      n_finite_elements(const DoFHandler<dim, spacedim> &dof_handler)
+      explicit SplitFaceInterpolationMatrices(
+        const dealii::hp::FECollection<dim, spacedim> &fe_collection)
+        : fe_collection(fe_collection)
+        , primary_dof_masks(fe_collection.size(), fe_collection.size())
+        , split_face_interpolation_matrices(fe_collection.size(),
+                                            fe_collection.size())
+      {}
+
+      /**
+       * Return the mask that states which of the dofs of the element with
+       * index @p fe_index act as primary dofs when constraining it against
+       * the element with index @p dominating_fe_index, along with the
+       * inverted primary and the dependent part of the face interpolation
+       * matrix between the two.
+       */
+      std::pair<const std::vector<bool> &,
+                const std::pair<FullMatrix<double>, FullMatrix<double>> &>
+      get(const types::fe_index dominating_fe_index,
+          const types::fe_index fe_index)
       {
-        if (dof_handler.has_hp_capabilities() == true)
-          return dof_handler.get_fe_collection().size();
-        else
-          return 1;
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const FullMatrix<double> &face_interpolation_matrix =
+          fe_collection.get_face_interpolation_matrix(dominating_fe_index,
+                                                      fe_index);
+        ensure_existence_of_primary_dof_mask(
+          fe_collection[fe_index],
+          fe_collection[dominating_fe_index],
+          face_interpolation_matrix,
+          primary_dof_masks[dominating_fe_index][fe_index]);
+        ensure_existence_of_split_face_matrix(
+          face_interpolation_matrix,
+          *primary_dof_masks[dominating_fe_index][fe_index],
+          split_face_interpolation_matrices[dominating_fe_index][fe_index]);
+
+        return {
+          *primary_dof_masks[dominating_fe_index][fe_index],
+          *split_face_interpolation_matrices[dominating_fe_index][fe_index]};
+      }
+
+    private:
+      const dealii::hp::FECollection<dim, spacedim> &fe_collection;
+
+      std::mutex mutex;
+
+      Table<2, std::unique_ptr<std::vector<bool>>> primary_dof_masks;
+
+      Table<2,
+            std::unique_ptr<std::pair<FullMatrix<double>, FullMatrix<double>>>>
+        split_face_interpolation_matrices;
+    };
+
+
+
+    /**
+     * A container for the constraints that make_hp_hanging_node_constraints()
+     * computes for one range of cells. It provides the two functions of
+     * AffineConstraints that filter_constraints() needs, but only records
+     * the constraints in the order in which they are added. This allows
+     * several threads to work on disjoint ranges of cells, and to copy the
+     * results into the AffineConstraints object one range after the other
+     * afterwards, leading to the same result as if all cells had been
+     * processed in sequence. We do not use AffineConstraints objects here
+     * because their memory consumption grows with the largest index of a
+     * constrained dof, rather than the number of constraints.
+     */
+    template <typename number>
+    class ConstraintsOfCellRange
+    {
+    public:
+      using size_type = types::global_dof_index;
+
+      bool
+      is_constrained(const size_type index) const
+      {
+        return constrained_dofs.find(index) != constrained_dofs.end();
+      }
+
+      void
+      add_constraint(
+        const size_type                                      index,
+        const ArrayView<const std::pair<size_type, number>> &entries,
+        const number                                         inhomogeneity)
+      {
+        constrained_dofs.insert(index);
+        lines.emplace_back(index,
+                           std::vector<std::pair<size_type, number>>(
+                             entries.begin(), entries.end()),
+                           inhomogeneity);
+      }
+
+      /**
+       * Add the constraints stored in this object to @p constraints,
+       * except for those dofs that are already constrained there.
+       */
+      void
+      copy_to(AffineConstraints<number> &constraints) const
+      {
+        for (const auto &[index, entries, inhomogeneity] : lines)
+          if (constraints.is_constrained(index) == false)
+            constraints.add_constraint(index, entries, inhomogeneity);
       }
 
+    private:
+      std::unordered_set<size_type> constrained_dofs;
+
+      std::vector<std::tuple<size_type,
+                             std::vector<std::pair<size_type, number>>,
+                             number>>
+        lines;
+    };
+
 
 
+    namespace
+    {
       /**
-       * Copy constraints into an AffineConstraints object.
+       * Copy constraints into a ConstraintsOfCellRange object.
        *
        * This function removes zero constraints and those, which constrain a DoF
        * which was already eliminated in one of the previous steps of the hp-
@@ -488,7 +551,7 @@ namespace DoFTools
         const std::vector<types::global_dof_index> &primary_dofs,
         const std::vector<types::global_dof_index> &dependent_dofs,
         const FullMatrix<number1>                  &face_constraints,
-        AffineConstraints<number2>                 &constraints)
+        ConstraintsOfCellRange<number2>            &constraints)
       {
         Assert(face_constraints.n() == primary_dofs.size(),
                ExcDimensionMismatch(primary_dofs.size(), face_constraints.n()));
@@ -514,7 +577,7 @@ namespace DoFTools
         // node constraints of Q4 elements in 3d, so covers most
         // common cases. Sort the primary dofs to add a sorted list to the
         // affine constraints, which increases performance there.
-        using size_type = typename AffineConstraints<number2>::size_type;
+        using size_type = typename ConstraintsOfCellRange<number2>::size_type;
         boost::container::small_vector<std::pair<size_type, size_type>, 25>
           sorted_primary_dofs;
         sorted_primary_dofs.reserve(n_primary_dofs);
@@ -2320,17 +2383,31 @@ namespace DoFTools
     }
 
 
+    /**
+     * Compute the hanging node constraints on all faces of the given active
+     * cells. This is the part of make_hp_hanging_node_constraints() that is
+     * run on several threads for disjoint ranges of cells.
+     */
     template <int dim, int spacedim, typename number>
     void
-    make_hp_hanging_node_constraints(
+    make_hp_hanging_node_constraints_on_cells(
       const DoFHandler<dim, spacedim> &dof_handler,
-      AffineConstraints<number>       &constraints)
+      const ArrayView<
+        const typename DoFHandler<dim, spacedim>::active_cell_iterator> &cells,
+      SplitFaceInterpolationMatrices<dim, spacedim>
+        &split_face_interpolation_matrices,
+      ConstraintsOfCellRange<number> &constraints)
     {
       // note: this function is going to be hard to understand if you haven't
       // read the hp-paper. however, we try to follow the notation laid out
       // there, so go read the paper before you try to understand what is going
       // on here
 
+      // the face and subface interpolation matrices between different (or the
+      // same) finite elements are cached in the FECollection, i.e., they are
+      // computed only once, namely the first time they are needed
+      const dealii::hp::FECollection<dim, spacedim> &fe_collection =
+        dof_handler.get_fe_collection();
 
       // a matrix to be used for constraints below. declared here and simply
       // resized down below to avoid permanent re-allocation of memory
@@ -2342,39 +2419,12 @@ namespace DoFTools
       std::vector<types::global_dof_index> dependent_dofs;
       std::vector<types::global_dof_index> scratch_dofs;
 
-      // caches for the face and subface interpolation matrices between
-      // different (or the same) finite elements. we compute them only once,
-      // namely the first time they are needed, and then just reuse them
-      Table<2, std::unique_ptr<FullMatrix<double>>> face_interpolation_matrices(
-        n_finite_elements(dof_handler), n_finite_elements(dof_handler));
-      Table<3, std::unique_ptr<FullMatrix<double>>>
-        subface_interpolation_matrices(
-          n_finite_elements(dof_handler),
-          n_finite_elements(dof_handler),
-          GeometryInfo<dim>::max_children_per_face);
-
-      // similarly have a cache for the matrices that are split into their
-      // primary and dependent parts, and for which the primary part is
-      // inverted. these two matrices are derived from the face interpolation
-      // matrix
-      // as described in the @ref hp_paper "hp-paper"
-      Table<2,
-            std::unique_ptr<std::pair<FullMatrix<double>, FullMatrix<double>>>>
-        split_face_interpolation_matrices(n_finite_elements(dof_handler),
-                                          n_finite_elements(dof_handler));
-
-      // finally, for each pair of finite elements, have a mask that states
-      // which of the degrees of freedom on the coarse side of a refined face
-      // will act as primary dofs.
-      Table<2, std::unique_ptr<std::vector<bool>>> primary_dof_masks(
-        n_finite_elements(dof_handler), n_finite_elements(dof_handler));
-
       // loop over all faces
       //
       // note that even though we may visit a face twice if the neighboring
       // cells are equally refined, we can only visit each face with hanging
       // nodes once
-      for (const auto &cell : dof_handler.active_cell_iterators())
+      for (const auto &cell : cells)
         {
           // artificial cells can at best neighbor ghost cells, but we're not
           // interested in these interfaces
@@ -2541,20 +2591,16 @@ namespace DoFTools
                             // and the results of those tests show that the
                             // result of projection verifies the approximation
                             // properties of a finite element onto that mesh
-                            ensure_existence_of_subface_matrix(
-                              cell->get_fe(),
-                              subface->get_fe(subface_fe_index),
-                              c,
-                              subface_interpolation_matrices
-                                [cell->active_fe_index()][subface_fe_index][c]);
-
-                            // Add constraints to global AffineConstraints
+                            const FullMatrix<double>
+                              &subface_interpolation_matrix =
+                                fe_collection.get_subface_interpolation_matrix(
+                                  cell->active_fe_index(), subface_fe_index, c);
+
+                            // Add constraints to the AffineConstraints
                             // object.
                             filter_constraints(primary_dofs,
                                                dependent_dofs,
-                                               *(subface_interpolation_matrices
-                                                   [cell->active_fe_index()]
-                                                   [subface_fe_index][c]),
+                                               subface_interpolation_matrix,
                                                constraints);
                           } // loop over subfaces
 
@@ -2574,8 +2620,6 @@ namespace DoFTools
                         Assert(dof_handler.has_hp_capabilities() == true,
                                ExcInternalError());
 
-                        const dealii::hp::FECollection<dim, spacedim>
-                          &fe_collection = dof_handler.get_fe_collection();
                         // we first have to find the finite element that is able
                         // to generate a space that all the other ones can be
                         // constrained to. At this point we potentially have
@@ -2622,41 +2666,19 @@ namespace DoFTools
                                  cell->get_fe().n_dofs_per_face(face),
                                ExcInternalError());
 
-                        ensure_existence_of_face_matrix(
-                          dominating_fe,
-                          cell->get_fe(),
-                          face_interpolation_matrices[dominating_fe_index]
-                                                     [cell->active_fe_index()]);
-
                         // split this matrix into primary and dependent
                         // components. invert the primary component
-                        ensure_existence_of_primary_dof_mask(
-                          cell->get_fe(),
-                          dominating_fe,
-                          (*face_interpolation_matrices
-                             [dominating_fe_index][cell->active_fe_index()]),
-                          primary_dof_masks[dominating_fe_index]
-                                           [cell->active_fe_index()]);
-
-                        ensure_existence_of_split_face_matrix(
-                          *face_interpolation_matrices[dominating_fe_index]
-                                                      [cell->active_fe_index()],
-                          (*primary_dof_masks[dominating_fe_index]
-                                             [cell->active_fe_index()]),
-                          split_face_interpolation_matrices
-                            [dominating_fe_index][cell->active_fe_index()]);
+                        const auto [primary_dof_mask, split_face_matrices] =
+                          split_face_interpolation_matrices.get(
+                            dominating_fe_index, cell->active_fe_index());
 
                         const FullMatrix<double>
                           &restrict_mother_to_virtual_primary_inv =
-                            (split_face_interpolation_matrices
-                               [dominating_fe_index][cell->active_fe_index()]
-                                 ->first);
+                            split_face_matrices.first;
 
                         const FullMatrix<double>
                           &restrict_mother_to_virtual_dependent =
-                            (split_face_interpolation_matrices
-                               [dominating_fe_index][cell->active_fe_index()]
-                                 ->second);
+                            split_face_matrices.second;
 
                         // now compute the constraint matrix as the product
                         // between the inverse matrix and the dependent part
@@ -2681,10 +2703,7 @@ namespace DoFTools
                         for (unsigned int i = 0;
                              i < cell->get_fe().n_dofs_per_face(face);
                              ++i)
-                          if ((*primary_dof_masks[dominating_fe_index]
-                                                 [cell
-                                                    ->active_fe_index()])[i] ==
-                              true)
+                          if (primary_dof_mask[i] == true)
                             primary_dofs.push_back(scratch_dofs[i]);
                           else
                             dependent_dofs.push_back(scratch_dofs[i]);
@@ -2733,17 +2752,10 @@ namespace DoFTools
                             Assert(dominating_fe.n_dofs_per_face(face) <=
                                      subface_fe.n_dofs_per_face(face),
                                    ExcInternalError());
-                            ensure_existence_of_subface_matrix(
-                              dominating_fe,
-                              subface_fe,
-                              sf,
-                              subface_interpolation_matrices
-                                [dominating_fe_index][subface_fe_index][sf]);
-
                             const FullMatrix<double>
-                              &restrict_subface_to_virtual = *(
-                                subface_interpolation_matrices
-                                  [dominating_fe_index][subface_fe_index][sf]);
+                              &restrict_subface_to_virtual =
+                                fe_collection.get_subface_interpolation_matrix(
+                                  dominating_fe_index, subface_fe_index, sf);
 
                             constraint_matrix.reinit(
                               subface_fe.n_dofs_per_face(face),
@@ -2831,22 +2843,14 @@ namespace DoFTools
                             cell->face(face)->get_dof_indices(
                               dependent_dofs, neighbor->active_fe_index());
 
-                            // make sure the element constraints for this face
-                            // are available
-                            ensure_existence_of_face_matrix(
-                              cell->get_fe(),
-                              neighbor->get_fe(),
-                              face_interpolation_matrices
-                                [cell->active_fe_index()]
-                                [neighbor->active_fe_index()]);
-
-                            // Add constraints to global constraint matrix.
+                            // Add constraints to the constraint matrix, using
+                            // the cached element constraints for this face
                             filter_constraints(
                               primary_dofs,
                               dependent_dofs,
-                              *(face_interpolation_matrices
-                                  [cell->active_fe_index()]
-                                  [neighbor->active_fe_index()]),
+                              fe_collection.get_face_interpolation_matrix(
+                                cell->active_fe_index(),
+                                neighbor->active_fe_index()),
                               constraints);
 
                             break;
@@ -2910,9 +2914,6 @@ namespace DoFTools
                             std::set<types::fe_index> fes;
                             fes.insert(this_fe_index);
                             fes.insert(neighbor_fe_index);
-                            const dealii::hp::FECollection<dim, spacedim>
-                              &fe_collection = dof_handler.get_fe_collection();
-
                             // TODO: Change set to types::fe_index
                             const types::fe_index dominating_fe_index =
                               fe_collection.find_dominating_fe_extended(
@@ -2938,42 +2939,20 @@ namespace DoFTools
                                      cell->get_fe().n_dofs_per_face(face),
                                    ExcInternalError());
 
-                            ensure_existence_of_face_matrix(
-                              dominating_fe,
-                              cell->get_fe(),
-                              face_interpolation_matrices
-                                [dominating_fe_index][cell->active_fe_index()]);
-
-                            // split this matrix into primary and dependent
-                            // components. invert the primary component
-                            ensure_existence_of_primary_dof_mask(
-                              cell->get_fe(),
-                              dominating_fe,
-                              (*face_interpolation_matrices
-                                 [dominating_fe_index]
-                                 [cell->active_fe_index()]),
-                              primary_dof_masks[dominating_fe_index]
-                                               [cell->active_fe_index()]);
-
-                            ensure_existence_of_split_face_matrix(
-                              *face_interpolation_matrices
-                                [dominating_fe_index][cell->active_fe_index()],
-                              (*primary_dof_masks[dominating_fe_index]
-                                                 [cell->active_fe_index()]),
-                              split_face_interpolation_matrices
-                                [dominating_fe_index][cell->active_fe_index()]);
-
-                            const FullMatrix<
-                              double> &restrict_mother_to_virtual_primary_inv =
-                              (split_face_interpolation_matrices
-                                 [dominating_fe_index][cell->active_fe_index()]
-                                   ->first);
-
-                            const FullMatrix<
-                              double> &restrict_mother_to_virtual_dependent =
-                              (split_face_interpolation_matrices
-                                 [dominating_fe_index][cell->active_fe_index()]
-                                   ->second);
+                            // split the face interpolation matrix into
+                            // primary and dependent components. invert the
+                            // primary component
+                            const auto [primary_dof_mask, split_face_matrices] =
+                              split_face_interpolation_matrices.get(
+                                dominating_fe_index, cell->active_fe_index());
+
+                            const FullMatrix<double>
+                              &restrict_mother_to_virtual_primary_inv =
+                                split_face_matrices.first;
+
+                            const FullMatrix<double>
+                              &restrict_mother_to_virtual_dependent =
+                                split_face_matrices.second;
 
                             // now compute the constraint matrix as the product
                             // between the inverse matrix and the dependent part
@@ -2998,9 +2977,7 @@ namespace DoFTools
                             for (unsigned int i = 0;
                                  i < cell->get_fe().n_dofs_per_face(face);
                                  ++i)
-                              if ((*primary_dof_masks[dominating_fe_index]
-                                                     [cell->active_fe_index()])
-                                    [i] == true)
+                              if (primary_dof_mask[i] == true)
                                 primary_dofs.push_back(scratch_dofs[i]);
                               else
                                 dependent_dofs.push_back(scratch_dofs[i]);
@@ -3025,18 +3002,11 @@ namespace DoFTools
                                      neighbor->get_fe().n_dofs_per_face(face),
                                    ExcInternalError());
 
-                            ensure_existence_of_face_matrix(
-                              dominating_fe,
-                              neighbor->get_fe(),
-                              face_interpolation_matrices
-                                [dominating_fe_index]
-                                [neighbor->active_fe_index()]);
-
                             const FullMatrix<double>
                               &restrict_secondface_to_virtual =
-                                *(face_interpolation_matrices
-                                    [dominating_fe_index]
-                                    [neighbor->active_fe_index()]);
+                                fe_collection.get_face_interpolation_matrix(
+                                  dominating_fe_index,
+                                  neighbor->active_fe_index());
 
                             constraint_matrix.reinit(
                               neighbor->get_fe().n_dofs_per_face(face),
@@ -3073,6 +3043,59 @@ namespace DoFTools
               }
         }
     }
+
+
+
+    template <int dim, int spacedim, typename number>
+    void
+    make_hp_hanging_node_constraints(
+      const DoFHandler<dim, spacedim> &dof_handler,
+      AffineConstraints<number>       &constraints)
+    {
+      std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+        cells;
+      cells.reserve(dof_handler.get_triangulation().n_active_cells());
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        cells.push_back(cell);
+
+      // the masks and split matrices derived from the face interpolation
+      // matrices are shared between all threads
+      SplitFaceInterpolationMatrices<dim, spacedim>
+        split_face_interpolation_matrices(dof_handler.get_fe_collection());
+
+      // split the cells into ranges of fixed size that are worked on in
+      // parallel. the constraints of each range are first collected
+      // separately, and then copied into the output object in the order of
+      // the ranges: if a dof is constrained from several faces, the first
+      // constraint wins, just as if we had worked on all cells in sequence
+      const unsigned int n_cells_per_range = 256;
+      const unsigned int n_ranges =
+        (cells.size() + n_cells_per_range - 1) / n_cells_per_range;
+      std::vector<ConstraintsOfCellRange<number>> constraints_of_ranges(
+        n_ranges);
+
+      dealii::parallel::apply_to_subranges(
+        0U,
+        n_ranges,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int range = begin; range < end; ++range)
+            {
+              const std::size_t first_cell = range * n_cells_per_range;
+              const std::size_t n_cells =
+                std::min<std::size_t>(n_cells_per_range,
+                                      cells.size() - first_cell);
+              make_hp_hanging_node_constraints_on_cells(
+                dof_handler,
+                make_array_view(cells, first_cell, n_cells),
+                split_face_interpolation_matrices,
+                constraints_of_ranges[range]);
+            }
+        },
+        /* grainsize = */ 1);
+
+      for (const auto &constraints_of_range : constraints_of_ranges)
+        constraints_of_range.copy_to(constraints);
+    }
   } // namespace internal
 
 
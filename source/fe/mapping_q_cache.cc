@@ -29,6 +29,14 @@
 #include <deal.II/lac/petsc_vector.h>
 #include <deal.II/lac/trilinos_vector.h>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <cstdint>
+#include <exception>
+#include <fstream>
 #include <functional>
 
 DEAL_II_NAMESPACE_OPEN
@@ -88,6 +96,20 @@ void
 MappingQCache<dim, spacedim>::initialize(
   const Mapping<dim, spacedim>       &mapping,
   const Triangulation<dim, spacedim> &triangulation)
+{
+  this->initialize(mapping,
+                   triangulation,
+                   std::map<CellId, std::vector<Point<spacedim>>>());
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::initialize(
+  const Mapping<dim, spacedim>                         &mapping,
+  const Triangulation<dim, spacedim>                   &triangulation,
+  const std::map<CellId, std::vector<Point<spacedim>>> &stored_points)
 {
   // FE and FEValues in the case they are needed
   FE_Nothing<dim, spacedim> fe;
@@ -97,6 +119,13 @@ MappingQCache<dim, spacedim>::initialize(
   this->initialize(
     triangulation,
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+      if (stored_points.empty() == false)
+        {
+          const auto entry = stored_points.find(cell->id());
+          if (entry != stored_points.end())
+            return entry->second;
+        }
+
       const auto mapping_q =
         dynamic_cast<const MappingQ<dim, spacedim> *>(&mapping);
       if (mapping_q != nullptr && this->get_degree() == mapping_q->get_degree())
@@ -699,6 +728,277 @@ MappingQCache<dim, spacedim>::initialize(
 
 
 
+namespace
+{
+  // Return the locally owned and ghost cells as well as their ancestors,
+  // i.e., the cells that a process can compute the support points of on
+  // its own, each of them once.
+  template <int dim, int spacedim>
+  std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+  locally_relevant_cells_and_ancestors(
+    const Triangulation<dim, spacedim> &triangulation)
+  {
+    std::vector<std::vector<bool>> cell_is_collected(triangulation.n_levels());
+    for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
+      cell_is_collected[l].resize(triangulation.n_raw_cells(l), false);
+
+    std::vector<typename Triangulation<dim, spacedim>::cell_iterator> cells;
+    for (const auto &active_cell : triangulation.active_cell_iterators())
+      if (active_cell->is_artificial() == false)
+        for (typename Triangulation<dim, spacedim>::cell_iterator cell =
+               active_cell;
+             cell_is_collected[cell->level()][cell->index()] == false;
+             cell = cell->parent())
+          {
+            cell_is_collected[cell->level()][cell->index()] = true;
+            cells.push_back(cell);
+            if (cell->level() == 0)
+              break;
+          }
+
+    return cells;
+  }
+
+
+
+  // Compute a fingerprint of the state of a cell that its support points
+  // depend on, i.e., of the coordinates of its vertices and of the manifold
+  // ids of the cell and of its faces and lines, using the FNV-1a hash.
+  template <int dim, int spacedim>
+  std::uint64_t
+  cell_fingerprint(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell)
+  {
+    std::uint64_t fingerprint = 14695981039346656037ULL;
+
+    const auto add = [&fingerprint](const auto &value) {
+      const unsigned char *bytes =
+        reinterpret_cast<const unsigned char *>(&value);
+      for (std::size_t i = 0; i < sizeof(value); ++i)
+        {
+          fingerprint ^= bytes[i];
+          fingerprint *= 1099511628211ULL;
+        }
+    };
+
+    for (const unsigned int v : cell->vertex_indices())
+      for (unsigned int d = 0; d < spacedim; ++d)
+        add(cell->vertex(v)[d]);
+    add(cell->manifold_id());
+    if (dim > 1)
+      for (const unsigned int f : cell->face_indices())
+        add(cell->face(f)->manifold_id());
+    if (dim > 2)
+      for (const unsigned int l : cell->line_indices())
+        add(cell->line(l)->manifold_id());
+
+    return fingerprint;
+  }
+} // namespace
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::save(
+  const Triangulation<dim, spacedim> &triangulation,
+  const std::string                  &file_basename) const
+{
+  Assert(support_point_cache.get() != nullptr,
+         ExcMessage("Must call MappingQCache::initialize() before "
+                    "saving the cache or after mesh has changed!"));
+  Assert(uses_level_info,
+         ExcMessage("Only caches that have been initialized for the cells "
+                    "on all levels can be saved."));
+  AssertDimension(support_point_cache->size(), triangulation.n_levels());
+
+  const MPI_Comm     communicator = triangulation.get_mpi_communicator();
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(communicator);
+
+  if (my_rank == 0)
+    {
+      std::ofstream ofs_info(file_basename + "_mapping_q_cache.info");
+      AssertThrow(ofs_info.fail() == false, ExcIO());
+      ofs_info << "version nproc degree n_global_coarse_cells" << std::endl
+               << 2 << ' ' << Utilities::MPI::n_mpi_processes(communicator)
+               << ' ' << this->get_degree() << ' '
+               << triangulation.n_global_coarse_cells() << std::endl;
+    }
+
+  // store the support points of each cell along with the fingerprint of
+  // the cell's state they were computed for
+  std::vector<
+    std::pair<CellId, std::pair<std::uint64_t, std::vector<Point<spacedim>>>>>
+    points;
+  for (const auto &cell : locally_relevant_cells_and_ancestors(triangulation))
+    points.emplace_back(
+      cell->id(),
+      std::make_pair(cell_fingerprint<dim, spacedim>(cell),
+                     (*support_point_cache)[cell->level()][cell->index()]));
+
+  std::ofstream ofs_data(file_basename + "_mapping_q_cache_" +
+                           Utilities::int_to_string(my_rank) + ".data",
+                         std::ios::binary);
+  AssertThrow(ofs_data.fail() == false, ExcIO());
+  boost::archive::binary_oarchive oa(ofs_data);
+  oa << points;
+}
+
+
+
+template <int dim, int spacedim>
+std::map<CellId, std::vector<Point<spacedim>>>
+MappingQCache<dim, spacedim>::read_support_points(
+  const Triangulation<dim, spacedim> &triangulation,
+  const std::string                  &file_basename,
+  const unsigned int                  polynomial_degree)
+{
+  const MPI_Comm     communicator = triangulation.get_mpi_communicator();
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(communicator);
+
+  // read the files on all processes before any of the collective
+  // operations below, and postpone errors until all processes know about
+  // them: a process that threw right away would leave all others waiting
+  // in these operations forever
+  std::map<CellId, std::pair<std::uint64_t, std::vector<Point<spacedim>>>>
+                     stored_points;
+  std::exception_ptr pending_exception;
+  try
+    {
+      unsigned int version, n_processes, degree, n_global_coarse_cells;
+      {
+        std::ifstream ifs_info(file_basename + "_mapping_q_cache.info");
+        AssertThrow(ifs_info.fail() == false, ExcIO());
+        std::string first_line;
+        std::getline(ifs_info, first_line);
+        ifs_info >> version >> n_processes >> degree >> n_global_coarse_cells;
+        AssertThrow(ifs_info.fail() == false, ExcIO());
+      }
+      AssertThrow(version == 2,
+                  ExcMessage("The information saved in the file you are "
+                             "trying to read the mapping support points "
+                             "from was written with an incompatible file "
+                             "format version and cannot be read."));
+      AssertThrow(degree == polynomial_degree,
+                  ExcMessage("The mapping support points were saved for a "
+                             "different polynomial degree."));
+      AssertThrow(n_global_coarse_cells ==
+                    triangulation.n_global_coarse_cells(),
+                  ExcMessage("The mapping support points were saved for a "
+                             "triangulation with a different coarse mesh."));
+
+      // with the same number of processes, the cells a process needs are
+      // all in its own file (assuming the same partitioning); otherwise
+      // read all files and keep only the cells that are present on this
+      // process
+      const bool same_n_processes =
+        (n_processes == Utilities::MPI::n_mpi_processes(communicator));
+      for (unsigned int p = (same_n_processes ? my_rank : 0);
+           p < (same_n_processes ? my_rank + 1 : n_processes);
+           ++p)
+        {
+          std::ifstream ifs_data(file_basename + "_mapping_q_cache_" +
+                                   Utilities::int_to_string(p) + ".data",
+                                 std::ios::binary);
+          AssertThrow(ifs_data.fail() == false, ExcIO());
+          boost::archive::binary_iarchive ia(ifs_data);
+
+          std::vector<
+            std::pair<CellId,
+                      std::pair<std::uint64_t, std::vector<Point<spacedim>>>>>
+            points;
+          ia >> points;
+          for (auto &entry : points)
+            if (same_n_processes ||
+                triangulation.contains_cell(entry.first) == true)
+              stored_points.insert(std::move(entry));
+        }
+    }
+  catch (...)
+    {
+      pending_exception = std::current_exception();
+    }
+
+  if (Utilities::MPI::logical_or(static_cast<bool>(pending_exception),
+                                 communicator))
+    {
+      if (pending_exception)
+        std::rethrow_exception(pending_exception);
+      else
+        AssertThrow(false,
+                    ExcMessage("The mapping support points could not be "
+                               "read on another process."));
+    }
+
+  // cells that have been created by refinement after saving are simply
+  // not found in the files, but a stored cell whose vertices or manifold
+  // ids have changed since means that the files describe a different
+  // triangulation; reject them on all processes alike
+  std::map<CellId, std::vector<Point<spacedim>>> support_points;
+  bool                                           state_has_changed = false;
+  for (const auto &cell : locally_relevant_cells_and_ancestors(triangulation))
+    {
+      const auto entry = stored_points.find(cell->id());
+      if (entry != stored_points.end())
+        {
+          if (entry->second.first != cell_fingerprint<dim, spacedim>(cell))
+            state_has_changed = true;
+          support_points.emplace(entry->first,
+                                 std::move(entry->second.second));
+        }
+    }
+  AssertThrow(Utilities::MPI::logical_or(state_has_changed, communicator) ==
+                false,
+              ExcMessage("The mapping support points were saved for a "
+                         "triangulation with different vertex locations "
+                         "or manifold ids."));
+
+  return support_points;
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::load(
+  const Mapping<dim, spacedim>       &mapping,
+  const Triangulation<dim, spacedim> &triangulation,
+  const std::string                  &file_basename)
+{
+  this->initialize(mapping,
+                   triangulation,
+                   read_support_points(triangulation,
+                                       file_basename,
+                                       this->get_degree()));
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::load(
+  const Triangulation<dim, spacedim> &triangulation,
+  const std::string                  &file_basename,
+  const std::function<std::vector<Point<spacedim>>(
+    const typename Triangulation<dim, spacedim>::cell_iterator &)>
+    &compute_points_on_cell)
+{
+  const std::map<CellId, std::vector<Point<spacedim>>> stored_points =
+    read_support_points(triangulation, file_basename, this->get_degree());
+
+  this->initialize(
+    triangulation,
+    [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+      const auto entry = stored_points.find(cell->id());
+      if (entry != stored_points.end())
+        return entry->second;
+      else
+        return compute_points_on_cell(cell);
+    });
+}
+
+
+
 template <int dim, int spacedim>
 std::size_t
 MappingQCache<dim, spacedim>::memory_consumption() const
@@ -17,6 +17,8 @@
 #include <deal.II/base/patterns.h>
 #include <deal.II/base/utilities.h>
 
+#include <deal.II/distributed/tria_base.h>
+
 #include <deal.II/grid/grid_in.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/tria.h>
@@ -38,6 +40,7 @@
 #include <fstream>
 #include <limits>
 #include <map>
+#include <numeric>
 
 #ifdef DEAL_II_WITH_ASSIMP
 #  include <assimp/Importer.hpp>  // C++ importer interface
@@ -687,6 +690,185 @@ GridIn<dim, spacedim>::read_vtu(std::istream &in)
 }
 
 
+
+template <int dim, int spacedim>
+void
+GridIn<dim, spacedim>::read_binary(std::istream &in)
+{
+  Assert(tria != nullptr, ExcNoTriangulationSelected());
+  AssertThrow(in.fail() == false, ExcIO());
+
+  // read all data in contiguous blocks, whose sizes are given in the header
+  const auto read_block = [&in](auto &data, const std::uint64_t size) {
+    data.resize(size);
+    in.read(reinterpret_cast<char *>(data.data()), size * sizeof(data[0]));
+    AssertThrow(in.fail() == false,
+                ExcMessage("The binary mesh file ended unexpectedly."));
+  };
+
+  std::vector<std::uint64_t> header;
+  read_block(header, 10);
+  AssertThrow(header[0] ==
+                GridTools::internal::binary_mesh_format_magic_number,
+              ExcMessage("The file is not a binary mesh file written by "
+                         "GridOut::write_binary(), or it was written on a "
+                         "machine with a different byte order."));
+  AssertThrow(header[1] == GridTools::internal::binary_mesh_format_version,
+              ExcMessage("The binary mesh file was written with an "
+                         "incompatible version of the file format."));
+  AssertThrow(header[2] == dim && header[3] == spacedim,
+              ExcMessage("The binary mesh file was written for a "
+                         "triangulation of a different dimension."));
+
+  const unsigned int n_levels = header[4];
+  const unsigned int n_vertices = header[5];
+  const unsigned int n_coarse_cells = header[6];
+
+  std::vector<std::uint64_t> n_cells_per_level;
+  read_block(n_cells_per_level, n_levels);
+  const std::uint64_t n_cells = std::accumulate(n_cells_per_level.begin(),
+                                                n_cells_per_level.end(),
+                                                std::uint64_t(0));
+  AssertThrow(n_levels > 0 && n_cells_per_level[0] == n_coarse_cells,
+              ExcMessage("The binary mesh file is corrupted."));
+
+  std::vector<double>        vertices;
+  std::vector<std::uint32_t> coarse_cell_vertices;
+  std::vector<std::uint32_t> cell_ids;
+  std::vector<std::uint32_t> face_ids;
+  std::vector<std::uint32_t> line_ids;
+  std::vector<std::uint8_t>  coarse_cell_n_vertices;
+  std::vector<std::uint8_t>  refinement_cases;
+  read_block(vertices, static_cast<std::uint64_t>(n_vertices) * spacedim);
+  read_block(coarse_cell_vertices, header[7]);
+  read_block(cell_ids, 2 * n_cells);
+  read_block(face_ids, header[8]);
+  read_block(line_ids, header[9]);
+  read_block(coarse_cell_n_vertices, n_coarse_cells);
+  read_block(refinement_cases, n_cells - n_cells_per_level.back());
+
+  // create the coarse mesh. its vertices are the first ones in the numbering
+  // of the file, since the coarse cells are listed first
+  std::vector<CellData<dim>> coarse_cells(n_coarse_cells);
+  unsigned int               n_coarse_vertices = 0;
+  for (unsigned int c = 0, offset = 0; c < n_coarse_cells; ++c)
+    {
+      AssertThrow(offset + coarse_cell_n_vertices[c] <=
+                    coarse_cell_vertices.size(),
+                  ExcMessage("The binary mesh file is corrupted."));
+      coarse_cells[c].vertices.assign(
+        coarse_cell_vertices.begin() + offset,
+        coarse_cell_vertices.begin() + offset + coarse_cell_n_vertices[c]);
+      offset += coarse_cell_n_vertices[c];
+      for (const unsigned int v : coarse_cells[c].vertices)
+        n_coarse_vertices = std::max(n_coarse_vertices, v + 1);
+    }
+  AssertThrow(n_coarse_vertices <= n_vertices,
+              ExcMessage("The binary mesh file is corrupted."));
+
+  std::vector<Point<spacedim>> coarse_vertices(n_coarse_vertices);
+  for (unsigned int v = 0; v < n_coarse_vertices; ++v)
+    for (unsigned int d = 0; d < spacedim; ++d)
+      coarse_vertices[v][d] = vertices[v * spacedim + d];
+
+  tria->create_triangulation(coarse_vertices, coarse_cells, SubCellData());
+
+  // recreate the refinement hierarchy level by level
+  const bool is_distributed =
+    (dynamic_cast<parallel::DistributedTriangulationBase<dim, spacedim> *>(
+       &*tria) != nullptr);
+  AssertThrow(
+    n_levels == 1 || is_distributed == false,
+    ExcMessage("Reading refined meshes from binary mesh files is not "
+               "implemented for distributed triangulations."));
+
+  std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+    level_cells(tria->begin(0), tria->end(0));
+  for (unsigned int level = 0, offset = 0; level + 1 < n_levels; ++level)
+    {
+      for (unsigned int c = 0; c < level_cells.size(); ++c)
+        if (refinement_cases[offset + c] != 0)
+          {
+            if (level_cells[c]->reference_cell().is_hyper_cube())
+              level_cells[c]->set_refine_flag(
+                RefinementCase<dim>(refinement_cases[offset + c]));
+            else
+              level_cells[c]->set_refine_flag();
+          }
+      offset += level_cells.size();
+
+      tria->execute_coarsening_and_refinement();
+
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+        children;
+      for (const auto &cell : level_cells)
+        if (cell->has_children())
+          for (unsigned int c = 0; c < cell->n_children(); ++c)
+            children.push_back(cell->child(c));
+      level_cells.swap(children);
+
+      for (unsigned int l = 0; l <= level + 1; ++l)
+        AssertThrow(tria->n_cells(l) == n_cells_per_level[l],
+                    ExcMessage(
+                      "The refinement hierarchy saved in the binary mesh file "
+                      "could not be recreated. This can happen if the mesh "
+                      "smoothing flags of the triangulation lead to "
+                      "additional refinement."));
+    }
+
+  // finally, set the locations of all vertices and the ids of all objects
+  std::vector<unsigned int> vertex_numbers(tria->n_vertices(),
+                                           numbers::invalid_unsigned_int);
+  unsigned int              n_numbered_vertices = 0;
+  std::uint64_t             cell_index = 0, face_index = 0, line_index = 0;
+  for (const auto &cells :
+       GridTools::internal::cells_in_hierarchical_order(*tria))
+    for (const auto &cell : cells)
+      {
+        for (const unsigned int v : cell->vertex_indices())
+          if (vertex_numbers[cell->vertex_index(v)] ==
+              numbers::invalid_unsigned_int)
+            {
+              AssertThrow(n_numbered_vertices < n_vertices,
+                          ExcMessage("The binary mesh file is corrupted."));
+              vertex_numbers[cell->vertex_index(v)] = n_numbered_vertices;
+              for (unsigned int d = 0; d < spacedim; ++d)
+                cell->vertex(v)[d] =
+                  vertices[n_numbered_vertices * spacedim + d];
+              ++n_numbered_vertices;
+            }
+
+        cell->set_material_id(cell_ids[2 * cell_index]);
+        cell->set_manifold_id(cell_ids[2 * cell_index + 1]);
+        ++cell_index;
+
+        for (const unsigned int f : cell->face_indices())
+          {
+            AssertThrow(face_index + 2 <= face_ids.size(),
+                        ExcMessage("The binary mesh file is corrupted."));
+            if constexpr (dim > 1)
+              cell->face(f)->set_manifold_id(face_ids[face_index]);
+            if (cell->face(f)->at_boundary())
+              cell->face(f)->set_boundary_id(face_ids[face_index + 1]);
+            face_index += 2;
+          }
+
+        if constexpr (dim == 3)
+          for (const unsigned int l : cell->line_indices())
+            {
+              AssertThrow(line_index + 2 <= line_ids.size(),
+                          ExcMessage("The binary mesh file is corrupted."));
+              cell->line(l)->set_manifold_id(line_ids[line_index]);
+              if (cell->line(l)->at_boundary())
+                cell->line(l)->set_boundary_id(line_ids[line_index + 1]);
+              line_index += 2;
+            }
+      }
+  AssertThrow(n_numbered_vertices == n_vertices,
+              ExcMessage("The binary mesh file is corrupted."));
+}
+
+
 template <int dim, int spacedim>
 void
 GridIn<dim, spacedim>::read_unv(std::istream &in)
@@ -4271,7 +4453,9 @@ GridIn<dim, spacedim>::read(const std::string &filename, Format format)
     }
   else
     {
-      std::ifstream in(filename);
+      std::ifstream in(filename,
+                       (format == binary ? std::ios::in | std::ios::binary :
+                                           std::ios::in));
       read(in, format);
     }
 }
@@ -4302,6 +4486,10 @@ GridIn<dim, spacedim>::read(std::istream &in, Format format)
         read_vtu(in);
         return;
 
+      case binary:
+        read_binary(in);
+        return;
+
       case unv:
         read_unv(in);
         return;
@@ -4360,6 +4548,8 @@ GridIn<dim, spacedim>::default_suffix(const Format format)
         return ".vtk";
       case vtu:
         return ".vtu";
+      case binary:
+        return ".dealii";
       case unv:
         return ".unv";
       case ucd:
@@ -4401,6 +4591,12 @@ GridIn<dim, spacedim>::parse_format(const std::string &format_name)
   if (format_name == "vtu")
     return vtu;
 
+  if (format_name == "binary")
+    return binary;
+
+  if (format_name == "dealii")
+    return binary;
+
   // This is also the typical extension of Abaqus input files.
   if (format_name == "inp")
     return ucd;
@@ -4440,7 +4636,8 @@ template <int dim, int spacedim>
 std::string
 GridIn<dim, spacedim>::get_format_names()
 {
-  return "dbmesh|exodusii|msh|unv|vtk|vtu|ucd|abaqus|xda|tecplot|assimp";
+  return "dbmesh|exodusii|msh|unv|vtk|vtu|binary|ucd|abaqus|xda|tecplot|"
+         "assimp";
 }
 
 
@@ -24,6 +24,7 @@
 #include <deal.II/fe/mapping.h>
 
 #include <deal.II/grid/grid_out.h>
+#include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_accessor.h>
 #include <deal.II/grid/tria_iterator.h>
@@ -581,6 +582,8 @@ GridOut::default_suffix(const OutputFormat output_format)
         return ".vtk";
       case vtu:
         return ".vtu";
+      case binary:
+        return ".dealii";
       default:
         DEAL_II_NOT_IMPLEMENTED();
         return "";
@@ -633,6 +636,9 @@ GridOut::parse_output_format(const std::string &format_name)
   if (format_name == "vtu")
     return vtu;
 
+  if (format_name == "binary")
+    return binary;
+
   AssertThrow(false, ExcInvalidState());
   // return something weird
   return OutputFormat(-1);
@@ -643,7 +649,7 @@ GridOut::parse_output_format(const std::string &format_name)
 std::string
 GridOut::get_output_format_names()
 {
-  return "none|dx|gnuplot|eps|ucd|xfig|msh|svg|mathgl|vtk|vtu";
+  return "none|dx|gnuplot|eps|ucd|xfig|msh|svg|mathgl|vtk|vtu|binary";
 }
 
 
@@ -3592,6 +3598,109 @@ GridOut::write_vtu(const Triangulation<dim, spacedim> &tria,
 
 
 
+template <int dim, int spacedim>
+void
+GridOut::write_binary(const Triangulation<dim, spacedim> &tria,
+                      std::ostream                       &out) const
+{
+  AssertThrow(out.fail() == false, ExcIO());
+  Assert((dynamic_cast<
+            const parallel::DistributedTriangulationBase<dim, spacedim> *>(
+            &tria) == nullptr),
+         ExcMessage("GridOut::write_binary() is not implemented for "
+                    "distributed triangulations."));
+
+  const auto cells = GridTools::internal::cells_in_hierarchical_order(tria);
+
+  // collect the data of all cells level by level, and number the vertices
+  // in the order in which they are first encountered
+  std::vector<unsigned int>  vertex_numbers(tria.n_vertices(),
+                                           numbers::invalid_unsigned_int);
+  std::vector<double>        vertices;
+  std::vector<std::uint32_t> coarse_cell_vertices;
+  std::vector<std::uint32_t> cell_ids;
+  std::vector<std::uint32_t> face_ids;
+  std::vector<std::uint32_t> line_ids;
+  std::vector<std::uint8_t>  coarse_cell_n_vertices;
+  std::vector<std::uint8_t>  refinement_cases;
+  std::vector<std::uint64_t> n_cells_per_level;
+
+  for (unsigned int level = 0; level < cells.size(); ++level)
+    {
+      n_cells_per_level.push_back(cells[level].size());
+      for (const auto &cell : cells[level])
+        {
+          for (const unsigned int v : cell->vertex_indices())
+            if (vertex_numbers[cell->vertex_index(v)] ==
+                numbers::invalid_unsigned_int)
+              {
+                vertex_numbers[cell->vertex_index(v)] =
+                  vertices.size() / spacedim;
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  vertices.push_back(cell->vertex(v)[d]);
+              }
+
+          if (level == 0)
+            {
+              coarse_cell_n_vertices.push_back(cell->n_vertices());
+              for (const unsigned int v : cell->vertex_indices())
+                coarse_cell_vertices.push_back(
+                  vertex_numbers[cell->vertex_index(v)]);
+            }
+
+          cell_ids.push_back(cell->material_id());
+          cell_ids.push_back(cell->manifold_id());
+
+          for (const auto &face : cell->face_iterators())
+            {
+              face_ids.push_back(face->manifold_id());
+              face_ids.push_back(face->boundary_id());
+            }
+
+          if constexpr (dim == 3)
+            for (const unsigned int l : cell->line_indices())
+              {
+                line_ids.push_back(cell->line(l)->manifold_id());
+                line_ids.push_back(cell->line(l)->boundary_id());
+              }
+
+          if (level + 1 < cells.size())
+            refinement_cases.push_back(cell->refinement_case());
+        }
+    }
+
+  const std::vector<std::uint64_t> header = {
+    GridTools::internal::binary_mesh_format_magic_number,
+    GridTools::internal::binary_mesh_format_version,
+    dim,
+    spacedim,
+    cells.size(),
+    vertices.size() / spacedim,
+    coarse_cell_n_vertices.size(),
+    coarse_cell_vertices.size(),
+    face_ids.size(),
+    line_ids.size()};
+
+  const auto write_block = [&out](const auto &data) {
+    out.write(reinterpret_cast<const char *>(data.data()),
+              data.size() * sizeof(data[0]));
+  };
+  write_block(header);
+  write_block(n_cells_per_level);
+  write_block(vertices);
+  write_block(coarse_cell_vertices);
+  write_block(cell_ids);
+  write_block(face_ids);
+  write_block(line_ids);
+  write_block(coarse_cell_n_vertices);
+  write_block(refinement_cases);
+
+  out << std::flush;
+  AssertThrow(out.fail() == false, ExcIO());
+}
+
+
+
 template <int dim, int spacedim>
 void
 GridOut::write_mesh_per_processor_as_vtu(
@@ -5189,6 +5298,10 @@ GridOut::write(const Triangulation<dim, spacedim> &tria,
       case vtu:
         write_vtu(tria, out);
         return;
+
+      case binary:
+        write_binary(tria, out);
+        return;
     }
 
   DEAL_II_ASSERT_UNREACHABLE();
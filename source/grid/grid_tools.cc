@@ -16,6 +16,7 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/thread_management.h>
 
@@ -53,7 +54,9 @@
 #include <deal.II/grid/tria_iterator.h>
 
 #include <deal.II/lac/constrained_linear_operator.h>
+#include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/lapack_full_matrix.h>
 #include <deal.II/lac/precondition.h>
 #include <deal.II/lac/solver_cg.h>
@@ -76,6 +79,7 @@
 #include <iostream>
 #include <limits>
 #include <list>
+#include <map>
 #include <numeric>
 #include <set>
 #include <tuple>
@@ -282,6 +286,335 @@ namespace GridTools
 
       constraints.distribute(u);
     }
+
+
+
+    /**
+     * Set up the constraints of the @p dim Laplace problems solved by
+     * laplace_transform() on the linear elements of @p dof_handler, one for
+     * each coordinate direction. The vertices in @p new_points are prescribed
+     * the respective component of their new position, or of their
+     * displacement if @p solve_for_absolute_positions is false. Hanging
+     * vertices are instead constrained to the vertices they hang on, so
+     * that the transformed mesh stays conforming. Only the vertices of
+     * locally owned and ghost cells are considered.
+     *
+     * If @p homogeneous_constraints is not a null pointer, it is set to the
+     * constraints of the same degrees of freedom with zero values.
+     */
+    template <int dim>
+    void
+    make_laplace_transform_constraints(
+      const DoFHandler<dim>                      &dof_handler,
+      const std::map<unsigned int, Point<dim>>   &new_points,
+      const bool                                  solve_for_absolute_positions,
+      std::array<AffineConstraints<double>, dim> &constraints,
+      AffineConstraints<double>                  *homogeneous_constraints)
+    {
+      const IndexSet &locally_owned_dofs = dof_handler.locally_owned_dofs();
+      const IndexSet  locally_relevant_dofs =
+        DoFTools::extract_locally_relevant_dofs(dof_handler);
+
+      // First collect the prescribed values of the vertices that do not
+      // hang, then set up one set of constraints per component with the
+      // respective values.
+      AffineConstraints<double> hanging_node_constraints(locally_owned_dofs,
+                                                         locally_relevant_dofs);
+      DoFTools::make_hanging_node_constraints(dof_handler,
+                                              hanging_node_constraints);
+
+      std::map<types::global_dof_index, Point<dim>> prescribed_values;
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        if (cell->is_artificial() == false)
+          for (const unsigned int vertex_no : cell->vertex_indices())
+            {
+              const auto map_iter =
+                new_points.find(cell->vertex_index(vertex_no));
+              const types::global_dof_index dof_index =
+                cell->vertex_dof_index(vertex_no, 0);
+              if (map_iter != new_points.end() &&
+                  hanging_node_constraints.is_constrained(dof_index) == false)
+                prescribed_values[dof_index] =
+                  (solve_for_absolute_positions ?
+                     map_iter->second :
+                     Point<dim>(map_iter->second - cell->vertex(vertex_no)));
+            }
+
+      for (unsigned int i = 0; i < dim; ++i)
+        {
+          constraints[i].copy_from(hanging_node_constraints);
+          for (const auto &[dof_index, value] : prescribed_values)
+            constraints[i].add_constraint(dof_index, {}, value[i]);
+          constraints[i].close();
+        }
+
+      if (homogeneous_constraints != nullptr)
+        {
+          homogeneous_constraints->copy_from(hanging_node_constraints);
+          for (const auto &[dof_index, value] : prescribed_values)
+            homogeneous_constraints->add_line(dof_index);
+          homogeneous_constraints->close();
+        }
+    }
+
+
+
+    /**
+     * The operator of the Laplace problem solved by laplace_transform() on
+     * distributed triangulations. Rather than assembling a global sparse
+     * matrix, the operator is applied cell by cell from the element matrices
+     * of the locally owned cells, with the degrees of freedom constrained by
+     * hanging nodes and prescribed vertex positions eliminated.
+     *
+     * This is not a matrix-free operator in the sense of MatrixFree: the
+     * element matrices are computed once and stored. For the linear
+     * elements used here, a matrix-free evaluation would have to store the
+     * inverse Jacobians and JxW values at the quadrature points of the
+     * (generally deformed) cells instead, i.e., 10 numbers at each of the 8
+     * quadrature points of a cell in 3d, which is more than the 64 entries
+     * of the element matrix, and would be slower to apply.
+     */
+    template <int dim>
+    class LaplaceTransformOperator
+    {
+    public:
+      using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+      /**
+       * Compute the element matrices of all locally owned cells of
+       * @p dof_handler.
+       */
+      LaplaceTransformOperator(
+        const DoFHandler<dim>           &dof_handler,
+        const AffineConstraints<double> &homogeneous_constraints,
+        const Function<dim>             *coefficient)
+        : constraints(homogeneous_constraints)
+      {
+        const QGauss<dim> quadrature(4);
+        const auto reference_cell = ReferenceCells::get_hypercube<dim>();
+
+        FEValues<dim> fe_values(
+          reference_cell.template get_default_linear_mapping<dim, dim>(),
+          dof_handler.get_fe(),
+          quadrature,
+          update_gradients | update_JxW_values |
+            (coefficient != nullptr ? update_quadrature_points :
+                                      update_default));
+
+        const unsigned int dofs_per_cell =
+          dof_handler.get_fe().n_dofs_per_cell();
+        std::vector<double> coefficient_values(quadrature.size(), 1.);
+        for (const auto &cell : dof_handler.active_cell_iterators())
+          if (cell->is_locally_owned())
+            {
+              fe_values.reinit(cell);
+              if (coefficient != nullptr)
+                coefficient->value_list(fe_values.get_quadrature_points(),
+                                        coefficient_values);
+
+              FullMatrix<double> cell_matrix(dofs_per_cell, dofs_per_cell);
+              for (const unsigned int q : fe_values.quadrature_point_indices())
+                for (const unsigned int i : fe_values.dof_indices())
+                  for (const unsigned int j : fe_values.dof_indices())
+                    cell_matrix(i, j) += coefficient_values[q] *
+                                         fe_values.shape_grad(i, q) *
+                                         fe_values.shape_grad(j, q) *
+                                         fe_values.JxW(q);
+              cell_matrices.push_back(std::move(cell_matrix));
+
+              cell_dof_indices.emplace_back(dofs_per_cell);
+              cell->get_dof_indices(cell_dof_indices.back());
+            }
+
+        for (const auto &line : constraints.get_lines())
+          if (dof_handler.locally_owned_dofs().is_element(line.index))
+            constrained_dofs.push_back(line.index);
+      }
+
+      /**
+       * Apply the operator. The rows of the constrained degrees of freedom
+       * are replaced by identity rows.
+       */
+      void
+      vmult(VectorType &dst, const VectorType &src) const
+      {
+        dst = 0;
+        src.update_ghost_values();
+
+        Vector<double> src_values, dst_values;
+        for (unsigned int c = 0; c < cell_matrices.size(); ++c)
+          {
+            const auto &dof_indices = cell_dof_indices[c];
+            src_values.reinit(dof_indices.size());
+            dst_values.reinit(dof_indices.size());
+            constraints.get_dof_values(src,
+                                       dof_indices.begin(),
+                                       src_values.begin(),
+                                       src_values.end());
+            cell_matrices[c].vmult(dst_values, src_values);
+            constraints.distribute_local_to_global(dst_values,
+                                                   dof_indices,
+                                                   dst);
+          }
+
+        dst.compress(VectorOperation::add);
+        src.zero_out_ghost_values();
+
+        for (const types::global_dof_index dof : constrained_dofs)
+          dst(dof) = src(dof);
+      }
+
+      /**
+       * Compute the right hand side that results from moving the values of
+       * the prescribed degrees of freedom, given in @p constraints, to the
+       * right hand side. The vector @p zero must be a zero vector with ghost
+       * entries for the locally relevant degrees of freedom.
+       */
+      void
+      compute_rhs(VectorType                      &rhs,
+                  const AffineConstraints<double> &inhomogeneous_constraints,
+                  const VectorType                &zero) const
+      {
+        rhs = 0;
+        Vector<double> values, cell_rhs;
+        for (unsigned int c = 0; c < cell_matrices.size(); ++c)
+          {
+            const auto &dof_indices = cell_dof_indices[c];
+            values.reinit(dof_indices.size());
+            cell_rhs.reinit(dof_indices.size());
+            inhomogeneous_constraints.get_dof_values(zero,
+                                                     dof_indices.begin(),
+                                                     values.begin(),
+                                                     values.end());
+            cell_matrices[c].vmult(cell_rhs, values);
+            cell_rhs *= -1.;
+            constraints.distribute_local_to_global(cell_rhs, dof_indices, rhs);
+          }
+        rhs.compress(VectorOperation::add);
+      }
+
+      /**
+       * Compute the inverse of the diagonal of the operator, for use as a
+       * Jacobi preconditioner.
+       */
+      void
+      compute_inverse_diagonal(VectorType &inverse_diagonal) const
+      {
+        inverse_diagonal = 0;
+        Vector<double> cell_diagonal;
+        for (unsigned int c = 0; c < cell_matrices.size(); ++c)
+          {
+            const auto &dof_indices = cell_dof_indices[c];
+            cell_diagonal.reinit(dof_indices.size());
+            for (unsigned int i = 0; i < dof_indices.size(); ++i)
+              cell_diagonal(i) = cell_matrices[c](i, i);
+            constraints.distribute_local_to_global(cell_diagonal,
+                                                   dof_indices,
+                                                   inverse_diagonal);
+          }
+        inverse_diagonal.compress(VectorOperation::add);
+
+        for (const types::global_dof_index dof : constrained_dofs)
+          inverse_diagonal(dof) = 1.;
+        for (auto &entry : inverse_diagonal)
+          entry = (entry > 0. ? 1. / entry : 1.);
+      }
+
+    private:
+      const AffineConstraints<double>                   &constraints;
+      std::vector<FullMatrix<double>>                    cell_matrices;
+      std::vector<std::vector<types::global_dof_index>> cell_dof_indices;
+      std::vector<types::global_dof_index>               constrained_dofs;
+    };
+
+
+
+    /**
+     * Implementation of laplace_transform() for distributed triangulations.
+     * The @p dim Laplace problems are solved one after the other with
+     * distributed vectors and the element-by-element operator above, and
+     * the vertices of all locally owned and ghost cells are moved, so that
+     * all processes agree on the positions of the vertices they share.
+     */
+    template <int dim>
+    void
+    laplace_transform_distributed(
+      const std::map<unsigned int, Point<dim>> &new_points,
+      Triangulation<dim>                       &triangulation,
+      const Function<dim>                      *coefficient,
+      const bool                                solve_for_absolute_positions)
+    {
+      using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+      const FE_Q<dim> q1(1);
+      DoFHandler<dim> dof_handler(triangulation);
+      dof_handler.distribute_dofs(q1);
+
+      const IndexSet &locally_owned_dofs = dof_handler.locally_owned_dofs();
+      const IndexSet  locally_relevant_dofs =
+        DoFTools::extract_locally_relevant_dofs(dof_handler);
+
+      std::array<AffineConstraints<double>, dim> constraints;
+      AffineConstraints<double>                  homogeneous_constraints;
+      make_laplace_transform_constraints<dim>(dof_handler,
+                                              new_points,
+                                              solve_for_absolute_positions,
+                                              constraints,
+                                              &homogeneous_constraints);
+
+      const LaplaceTransformOperator<dim> laplace_operator(
+        dof_handler, homogeneous_constraints, coefficient);
+
+      VectorType zero(locally_owned_dofs,
+                      locally_relevant_dofs,
+                      triangulation.get_mpi_communicator());
+      zero.update_ghost_values();
+
+      DiagonalMatrix<VectorType> preconditioner;
+      preconditioner.get_vector().reinit(zero);
+      laplace_operator.compute_inverse_diagonal(preconditioner.get_vector());
+
+      std::array<VectorType, dim> us;
+      VectorType                  rhs(zero);
+      for (unsigned int i = 0; i < dim; ++i)
+        {
+          us[i].reinit(zero);
+          laplace_operator.compute_rhs(rhs, constraints[i], zero);
+
+          SolverControl control(dof_handler.n_dofs(), 1.e-10, false, false);
+          SolverCG<VectorType> solver(control);
+          solver.solve(laplace_operator, us[i], rhs, preconditioner);
+
+          // set the values of the constrained vertices on their owners, who
+          // know all of their constraints, and only then send the values to
+          // the other processes. a process does not know the hanging node
+          // constraint of a vertex of a ghost cell if the coarser cell the
+          // vertex is hanging on is artificial on that process
+          constraints[i].distribute(us[i]);
+          us[i].update_ghost_values();
+        }
+
+      // change the coordinates of the vertices of the locally owned and
+      // ghost cells according to the computed values
+      std::vector<bool> vertex_touched(triangulation.n_vertices(), false);
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        if (cell->is_artificial() == false)
+          for (const unsigned int vertex_no : cell->vertex_indices())
+            if (vertex_touched[cell->vertex_index(vertex_no)] == false)
+              {
+                Point<dim> &v = cell->vertex(vertex_no);
+
+                const types::global_dof_index dof_index =
+                  cell->vertex_dof_index(vertex_no, 0);
+                for (unsigned int i = 0; i < dim; ++i)
+                  if (solve_for_absolute_positions)
+                    v[i] = us[i](dof_index);
+                  else
+                    v[i] += us[i](dof_index);
+
+                vertex_touched[cell->vertex_index(vertex_no)] = true;
+              }
+    }
   } // namespace internal
 
 
@@ -296,6 +629,19 @@ namespace GridTools
     if (dim == 1)
       DEAL_II_NOT_IMPLEMENTED();
 
+    Assert(triangulation.all_reference_cells_are_hyper_cube(),
+           ExcNotImplemented());
+
+    if (dynamic_cast<parallel::DistributedTriangulationBase<dim> *>(
+          &triangulation) != nullptr)
+      {
+        internal::laplace_transform_distributed(new_points,
+                                                triangulation,
+                                                coefficient,
+                                                solve_for_absolute_positions);
+        return;
+      }
+
     // first provide everything that is needed for solving a Laplace
     // equation.
     FE_Q<dim> q1(1);
@@ -315,8 +661,6 @@ namespace GridTools
 
     const QGauss<dim> quadrature(4);
 
-    Assert(triangulation.all_reference_cells_are_hyper_cube(),
-           ExcNotImplemented());
     const auto reference_cell = ReferenceCells::get_hypercube<dim>();
     MatrixCreator::create_laplace_matrix(
       reference_cell.template get_default_linear_mapping<dim, dim>(),
@@ -325,43 +669,15 @@ namespace GridTools
       S,
       coefficient);
 
-    // set up the boundary values for the laplace problem
-    std::array<AffineConstraints<double>, dim>                  constraints;
-    typename std::map<unsigned int, Point<dim>>::const_iterator map_end =
-      new_points.end();
-
-    // Fill these maps using the data given by new_points
-    for (const auto &cell : dof_handler.active_cell_iterators())
-      {
-        // Loop over all vertices of the cell and see if it is listed in the map
-        // given as first argument of the function. We visit vertices multiple
-        // times, so also check that if we have already added a constraint, we
-        // don't do it a second time again.
-        for (const unsigned int vertex_no : cell->vertex_indices())
-          {
-            const unsigned int vertex_index = cell->vertex_index(vertex_no);
-            const Point<dim>  &vertex_point = cell->vertex(vertex_no);
-
-            const typename std::map<unsigned int, Point<dim>>::const_iterator
-              map_iter = new_points.find(vertex_index);
-
-            if (map_iter != map_end)
-              for (unsigned int i = 0; i < dim; ++i)
-                if (constraints[i].is_constrained(
-                      cell->vertex_dof_index(vertex_no, 0)) == false)
-                  {
-                    constraints[i].add_constraint(
-                      cell->vertex_dof_index(vertex_no, 0),
-                      {},
-                      (solve_for_absolute_positions ?
-                         map_iter->second[i] :
-                         map_iter->second[i] - vertex_point[i]));
-                  }
-          }
-      }
-
-    for (unsigned int i = 0; i < dim; ++i)
-      constraints[i].close();
+    // set up the boundary values and hanging node constraints for the
+    // laplace problem
+    std::array<AffineConstraints<double>, dim> constraints;
+    internal::make_laplace_transform_constraints<dim>(
+      dof_handler,
+      new_points,
+      solve_for_absolute_positions,
+      constraints,
+      nullptr);
 
     // solve the dim problems with different right hand sides.
     Vector<double> us[dim];
@@ -783,8 +1099,80 @@ namespace GridTools
   }
 
 
+
+  template <int dim, int spacedim>
+  std::vector<std::vector<Tensor<1, spacedim>>>
+  vertex_to_cell_centers_directions(
+    const Triangulation<dim, spacedim>   &mesh,
+    const VertexToCellMap<dim, spacedim> &vertex_to_cells)
+  {
+    const std::vector<Point<spacedim>> &vertices = mesh.get_vertices();
+    const unsigned int n_vertices = vertex_to_cells.n_vertices();
+
+    AssertDimension(vertices.size(), n_vertices);
+
+    std::vector<std::vector<Tensor<1, spacedim>>> vertex_to_cell_centers(
+      n_vertices);
+    parallel::apply_to_subranges(
+      0,
+      n_vertices,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int vertex = begin; vertex < end; ++vertex)
+          if (mesh.vertex_used(vertex))
+            {
+              const unsigned int n_neighbor_cells =
+                vertex_to_cells.n_adjacent_cells(vertex);
+              vertex_to_cell_centers[vertex].resize(n_neighbor_cells);
+              for (unsigned int cell = 0; cell < n_neighbor_cells; ++cell)
+                {
+                  vertex_to_cell_centers[vertex][cell] =
+                    vertex_to_cells.get_adjacent_cell(vertex, cell)->center() -
+                    vertices[vertex];
+                  vertex_to_cell_centers[vertex][cell] /=
+                    vertex_to_cell_centers[vertex][cell].norm();
+                }
+            }
+      },
+      1024);
+    return vertex_to_cell_centers;
+  }
+
+
   namespace internal
   {
+    /**
+     * Give access to the output of GridTools::vertex_to_cell_map() through
+     * the same interface as the one of class VertexToCellMap.
+     */
+    template <typename CellIterator>
+    class VertexToCellSetsAccessor
+    {
+    public:
+      VertexToCellSetsAccessor(
+        const std::vector<std::set<CellIterator>> &vertex_to_cells)
+        : vertex_to_cells(vertex_to_cells)
+      {}
+
+      unsigned int
+      n_adjacent_cells(const unsigned int vertex) const
+      {
+        return vertex_to_cells[vertex].size();
+      }
+
+      CellIterator
+      get_adjacent_cell(const unsigned int vertex, const unsigned int i) const
+      {
+        auto cell = vertex_to_cells[vertex].begin();
+        std::advance(cell, i);
+        return *cell;
+      }
+
+    private:
+      const std::vector<std::set<CellIterator>> &vertex_to_cells;
+    };
+
+
+
     template <int spacedim>
     bool
     compare_point_association(
@@ -801,267 +1189,314 @@ namespace GridTools
       // return if the scalar product of a is larger.
       return (scalar_product_a > scalar_product_b);
     }
-  } // namespace internal
 
-  template <int dim, template <int, int> class MeshType, int spacedim>
-  DEAL_II_CXX20_REQUIRES(
-    (concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
-#ifndef _MSC_VER
-  std::pair<typename MeshType<dim, spacedim>::active_cell_iterator, Point<dim>>
-#else
-  std::pair<typename dealii::internal::
-              ActiveCellIterator<dim, spacedim, MeshType<dim, spacedim>>::type,
-            Point<dim>>
-#endif
+
+
+    /**
+     * The implementation of GridTools::find_active_cell_around_point() with
+     * a vertex-to-cell map. @p vertex_to_cells can be any object with the
+     * interface of class VertexToCellMap.
+     */
+    template <int dim, int spacedim, typename MeshType, typename VertexToCells>
+    std::pair<typename MeshType::active_cell_iterator, Point<dim>>
     find_active_cell_around_point(
-      const Mapping<dim, spacedim>  &mapping,
-      const MeshType<dim, spacedim> &mesh,
-      const Point<spacedim>         &p,
-      const std::vector<
-        std::set<typename MeshType<dim, spacedim>::active_cell_iterator>>
-        &vertex_to_cells,
+      const Mapping<dim, spacedim> &mapping,
+      const MeshType               &mesh,
+      const Point<spacedim>        &p,
+      const VertexToCells          &vertex_to_cells,
       const std::vector<std::vector<Tensor<1, spacedim>>>
-        &vertex_to_cell_centers,
-      const typename MeshType<dim, spacedim>::active_cell_iterator &cell_hint,
-      const std::vector<bool> &marked_vertices,
+                                                    &vertex_to_cell_centers,
+      const typename MeshType::active_cell_iterator &cell_hint,
+      const std::vector<bool>                       &marked_vertices,
       const RTree<std::pair<Point<spacedim>, unsigned int>>
                   &used_vertices_rtree,
       const double tolerance,
       const RTree<
         std::pair<BoundingBox<spacedim>,
                   typename Triangulation<dim, spacedim>::active_cell_iterator>>
-        *relevant_cell_bounding_boxes_rtree)
-  {
-    std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
-              Point<dim>>
-      cell_and_position;
-    cell_and_position.first = mesh.end();
-
-    // To handle points at the border we keep track of points which are close to
-    // the unit cell:
-    std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
-              Point<dim>>
-      cell_and_position_approx;
-
-    if (relevant_cell_bounding_boxes_rtree != nullptr &&
-        !relevant_cell_bounding_boxes_rtree->empty())
-      {
-        // create a bounding box around point p with 2*tolerance as side length.
-        const auto bb = BoundingBox<spacedim>(p).create_extended(tolerance);
+        *relevant_cell_bounding_boxes_rtree = nullptr)
+    {
+      std::pair<typename MeshType::active_cell_iterator, Point<dim>>
+        cell_and_position;
+      cell_and_position.first = mesh.end();
 
-        if (relevant_cell_bounding_boxes_rtree->qbegin(
-              boost::geometry::index::intersects(bb)) ==
-            relevant_cell_bounding_boxes_rtree->qend())
-          return cell_and_position;
-      }
+      // To handle points at the border we keep track of points which are
+      // close to the unit cell:
+      std::pair<typename MeshType::active_cell_iterator, Point<dim>>
+        cell_and_position_approx;
 
-    bool found_cell  = false;
-    bool approx_cell = false;
+      if (relevant_cell_bounding_boxes_rtree != nullptr &&
+          !relevant_cell_bounding_boxes_rtree->empty())
+        {
+          // create a bounding box around point p with 2*tolerance as side
+          // length.
+          const auto bb = BoundingBox<spacedim>(p).create_extended(tolerance);
+
+          if (relevant_cell_bounding_boxes_rtree->qbegin(
+                boost::geometry::index::intersects(bb)) ==
+              relevant_cell_bounding_boxes_rtree->qend())
+            return cell_and_position;
+        }
 
-    unsigned int closest_vertex_index = 0;
-    // ensure closest vertex index is a marked one, otherwise cell (with vertex
-    // 0) might be found even though it is not marked. This is only relevant if
-    // searching with rtree, using find_closest_vertex already can manage not
-    // finding points
-    if (marked_vertices.size() && !used_vertices_rtree.empty())
-      {
-        const auto itr =
-          std::find(marked_vertices.begin(), marked_vertices.end(), true);
-        Assert(itr != marked_vertices.end(),
-               dealii::ExcMessage("No vertex has been marked!"));
-        closest_vertex_index = std::distance(marked_vertices.begin(), itr);
-      }
+      bool found_cell  = false;
+      bool approx_cell = false;
 
-    Tensor<1, spacedim> vertex_to_point;
-    auto                current_cell = cell_hint;
+      unsigned int closest_vertex_index = 0;
+      // ensure closest vertex index is a marked one, otherwise cell (with
+      // vertex 0) might be found even though it is not marked. This is only
+      // relevant if searching with rtree, using find_closest_vertex already
+      // can manage not finding points
+      if (marked_vertices.size() && !used_vertices_rtree.empty())
+        {
+          const auto itr =
+            std::find(marked_vertices.begin(), marked_vertices.end(), true);
+          Assert(itr != marked_vertices.end(),
+                 dealii::ExcMessage("No vertex has been marked!"));
+          closest_vertex_index = std::distance(marked_vertices.begin(), itr);
+        }
 
-    // check whether cell has at least one marked vertex
-    const auto cell_marked = [&mesh, &marked_vertices](const auto &cell) {
-      if (marked_vertices.empty())
-        return true;
+      Tensor<1, spacedim> vertex_to_point;
+      auto                current_cell = cell_hint;
 
-      if (cell != mesh.active_cell_iterators().end())
-        for (unsigned int i = 0; i < cell->n_vertices(); ++i)
-          if (marked_vertices[cell->vertex_index(i)])
-            return true;
+      // check whether cell has at least one marked vertex
+      const auto cell_marked = [&mesh, &marked_vertices](const auto &cell) {
+        if (marked_vertices.empty())
+          return true;
 
-      return false;
-    };
+        if (cell != mesh.active_cell_iterators().end())
+          for (unsigned int i = 0; i < cell->n_vertices(); ++i)
+            if (marked_vertices[cell->vertex_index(i)])
+              return true;
 
-    // check whether any cell in collection is marked
-    const auto any_cell_marked = [&cell_marked](const auto &cells) {
-      return std::any_of(cells.begin(),
-                         cells.end(),
-                         [&cell_marked](const auto &cell) {
-                           return cell_marked(cell);
-                         });
-    };
-    (void)any_cell_marked;
+        return false;
+      };
 
-    while (found_cell == false)
-      {
-        // First look at the vertices of the cell cell_hint. If it's an
-        // invalid cell, then query for the closest global vertex
-        if (current_cell.state() == IteratorState::valid &&
-            cell_marked(cell_hint))
-          {
-            const auto cell_vertices = mapping.get_vertices(current_cell);
-            const unsigned int closest_vertex =
-              find_closest_vertex_of_cell<dim, spacedim>(current_cell,
-                                                         p,
-                                                         mapping);
-            vertex_to_point      = p - cell_vertices[closest_vertex];
-            closest_vertex_index = current_cell->vertex_index(closest_vertex);
-          }
-        else
-          {
-            // For some clang-based compilers and boost versions the call to
-            // RTree::query doesn't compile. Since using an rtree here is just a
-            // performance improvement disabling this branch is OK.
-            // This is fixed in boost in
-            // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
+      // check whether any cell adjacent to a vertex is marked
+      const auto any_cell_marked = [&cell_marked, &vertex_to_cells](
+                                     const unsigned int vertex) {
+        for (unsigned int i = 0; i < vertex_to_cells.n_adjacent_cells(vertex);
+             ++i)
+          if (cell_marked(vertex_to_cells.get_adjacent_cell(vertex, i)))
+            return true;
+        return false;
+      };
+      (void)any_cell_marked;
+
+      while (found_cell == false)
+        {
+          // First look at the vertices of the cell cell_hint. If it's an
+          // invalid cell, then query for the closest global vertex
+          if (current_cell.state() == IteratorState::valid &&
+              cell_marked(cell_hint))
+            {
+              const auto cell_vertices = mapping.get_vertices(current_cell);
+              const unsigned int closest_vertex =
+                find_closest_vertex_of_cell<dim, spacedim>(current_cell,
+                                                           p,
+                                                           mapping);
+              vertex_to_point = p - cell_vertices[closest_vertex];
+              closest_vertex_index =
+                current_cell->vertex_index(closest_vertex);
+            }
+          else
+            {
+              // For some clang-based compilers and boost versions the call
+              // to RTree::query doesn't compile. Since using an rtree here is
+              // just a performance improvement disabling this branch is OK.
+              // This is fixed in boost in
+              // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
 #if defined(DEAL_II_WITH_BOOST_BUNDLED) ||                \
   !(defined(__clang_major__) && __clang_major__ >= 16) || \
   BOOST_VERSION >= 108100
-            if (!used_vertices_rtree.empty())
-              {
-                // If we have an rtree at our disposal, use it.
-                using ValueType = std::pair<Point<spacedim>, unsigned int>;
-                std::function<bool(const ValueType &)> marked;
-                if (marked_vertices.size() == mesh.n_vertices())
-                  marked = [&marked_vertices](const ValueType &value) -> bool {
-                    return marked_vertices[value.second];
-                  };
-                else
-                  marked = [](const ValueType &) -> bool { return true; };
-
-                std::vector<std::pair<Point<spacedim>, unsigned int>> res;
-                used_vertices_rtree.query(
-                  boost::geometry::index::nearest(p, 1) &&
-                    boost::geometry::index::satisfies(marked),
-                  std::back_inserter(res));
-
-                // Searching for a point which is located outside the
-                // triangulation results in res.size() = 0
-                Assert(res.size() < 2,
-                       dealii::ExcMessage("There can not be multiple results"));
-
-                if (res.size() > 0)
-                  if (any_cell_marked(vertex_to_cells[res[0].second]))
-                    closest_vertex_index = res[0].second;
-              }
-            else
+              if (!used_vertices_rtree.empty())
+                {
+                  // If we have an rtree at our disposal, use it.
+                  using ValueType = std::pair<Point<spacedim>, unsigned int>;
+                  std::function<bool(const ValueType &)> marked;
+                  if (marked_vertices.size() == mesh.n_vertices())
+                    marked =
+                      [&marked_vertices](const ValueType &value) -> bool {
+                      return marked_vertices[value.second];
+                    };
+                  else
+                    marked = [](const ValueType &) -> bool { return true; };
+
+                  std::vector<std::pair<Point<spacedim>, unsigned int>> res;
+                  used_vertices_rtree.query(
+                    boost::geometry::index::nearest(p, 1) &&
+                      boost::geometry::index::satisfies(marked),
+                    std::back_inserter(res));
+
+                  // Searching for a point which is located outside the
+                  // triangulation results in res.size() = 0
+                  Assert(res.size() < 2,
+                         dealii::ExcMessage(
+                           "There can not be multiple results"));
+
+                  if (res.size() > 0)
+                    if (any_cell_marked(res[0].second))
+                      closest_vertex_index = res[0].second;
+                }
+              else
 #endif
-              {
-                closest_vertex_index = GridTools::find_closest_vertex(
-                  mapping, mesh, p, marked_vertices);
-              }
-            vertex_to_point = p - mesh.get_vertices()[closest_vertex_index];
-          }
+                {
+                  closest_vertex_index = GridTools::find_closest_vertex(
+                    mapping, mesh, p, marked_vertices);
+                }
+              vertex_to_point = p - mesh.get_vertices()[closest_vertex_index];
+            }
 
-        if constexpr (running_in_debug_mode())
-          {
+          if constexpr (running_in_debug_mode())
             {
-              // Double-check if found index is at marked cell
-              Assert(any_cell_marked(vertex_to_cells[closest_vertex_index]),
-                     dealii::ExcMessage("Found non-marked vertex"));
+              {
+                // Double-check if found index is at marked cell
+                Assert(any_cell_marked(closest_vertex_index),
+                       dealii::ExcMessage("Found non-marked vertex"));
+              }
             }
-          }
 
-        const double vertex_point_norm = vertex_to_point.norm();
-        if (vertex_point_norm > 0)
-          vertex_to_point /= vertex_point_norm;
+          const double vertex_point_norm = vertex_to_point.norm();
+          if (vertex_point_norm > 0)
+            vertex_to_point /= vertex_point_norm;
 
-        const unsigned int n_neighbor_cells =
-          vertex_to_cells[closest_vertex_index].size();
+          const unsigned int n_neighbor_cells =
+            vertex_to_cells.n_adjacent_cells(closest_vertex_index);
 
-        // Create a corresponding map of vectors from vertex to cell center
-        std::vector<unsigned int> neighbor_permutation(n_neighbor_cells);
+          // Create a corresponding map of vectors from vertex to cell center
+          std::vector<unsigned int> neighbor_permutation(n_neighbor_cells);
 
-        for (unsigned int i = 0; i < n_neighbor_cells; ++i)
-          neighbor_permutation[i] = i;
+          for (unsigned int i = 0; i < n_neighbor_cells; ++i)
+            neighbor_permutation[i] = i;
 
-        auto comp = [&](const unsigned int a, const unsigned int b) -> bool {
-          return internal::compare_point_association<spacedim>(
-            a,
-            b,
-            vertex_to_point,
-            vertex_to_cell_centers[closest_vertex_index]);
-        };
+          auto comp = [&](const unsigned int a, const unsigned int b) -> bool {
+            return internal::compare_point_association<spacedim>(
+              a,
+              b,
+              vertex_to_point,
+              vertex_to_cell_centers[closest_vertex_index]);
+          };
 
-        std::sort(neighbor_permutation.begin(),
-                  neighbor_permutation.end(),
-                  comp);
-        // It is possible the vertex is close
-        // to an edge, thus we add a tolerance
-        // to keep also the "best" cell
-        double best_distance = tolerance;
-
-        // Search all of the cells adjacent to the closest vertex of the cell
-        // hint. Most likely we will find the point in them.
-        for (unsigned int i = 0; i < n_neighbor_cells; ++i)
-          {
-            try
-              {
-                auto cell = vertex_to_cells[closest_vertex_index].begin();
-                std::advance(cell, neighbor_permutation[i]);
+          std::sort(neighbor_permutation.begin(),
+                    neighbor_permutation.end(),
+                    comp);
+          // It is possible the vertex is close
+          // to an edge, thus we add a tolerance
+          // to keep also the "best" cell
+          double best_distance = tolerance;
+
+          // Search all of the cells adjacent to the closest vertex of the
+          // cell hint. Most likely we will find the point in them.
+          for (unsigned int i = 0; i < n_neighbor_cells; ++i)
+            {
+              try
+                {
+                  const auto cell = vertex_to_cells.get_adjacent_cell(
+                    closest_vertex_index, neighbor_permutation[i]);
 
-                if (!(*cell)->is_artificial())
-                  {
-                    const Point<dim> p_unit =
-                      mapping.transform_real_to_unit_cell(*cell, p);
-                    if ((*cell)->reference_cell().contains_point(p_unit,
-                                                                 tolerance))
-                      {
-                        cell_and_position.first  = *cell;
-                        cell_and_position.second = p_unit;
-                        found_cell               = true;
-                        approx_cell              = false;
-                        break;
-                      }
-                    // The point is not inside this cell: checking how far
-                    // outside it is and whether we want to use this cell as a
-                    // backup if we can't find a cell within which the point
-                    // lies.
-                    const double dist = p_unit.distance(
-                      (*cell)->reference_cell().closest_point(p_unit));
-                    if (dist < best_distance)
-                      {
-                        best_distance                   = dist;
-                        cell_and_position_approx.first  = *cell;
-                        cell_and_position_approx.second = p_unit;
-                        approx_cell                     = true;
-                      }
-                  }
-              }
-            catch (typename Mapping<dim>::ExcTransformationFailed &)
-              {}
-          }
+                  if (!cell->is_artificial())
+                    {
+                      const Point<dim> p_unit =
+                        mapping.transform_real_to_unit_cell(cell, p);
+                      if (cell->reference_cell().contains_point(p_unit,
+                                                                tolerance))
+                        {
+                          cell_and_position.first  = cell;
+                          cell_and_position.second = p_unit;
+                          found_cell               = true;
+                          approx_cell              = false;
+                          break;
+                        }
+                      // The point is not inside this cell: checking how far
+                      // outside it is and whether we want to use this cell as
+                      // a backup if we can't find a cell within which the
+                      // point lies.
+                      const double dist = p_unit.distance(
+                        cell->reference_cell().closest_point(p_unit));
+                      if (dist < best_distance)
+                        {
+                          best_distance                   = dist;
+                          cell_and_position_approx.first  = cell;
+                          cell_and_position_approx.second = p_unit;
+                          approx_cell                     = true;
+                        }
+                    }
+                }
+              catch (typename Mapping<dim>::ExcTransformationFailed &)
+                {}
+            }
+
+          if (found_cell == true)
+            return cell_and_position;
+          else if (approx_cell == true)
+            return cell_and_position_approx;
+
+          // The first time around, we check for vertices in the hint_cell.
+          // If that does not work, we set the cell iterator to an invalid
+          // one, and look for a global vertex close to the point. If that
+          // does not work, we are in trouble, and just throw an exception.
+          //
+          // If we got here, then we did not find the point. If the
+          // current_cell.state() here is not IteratorState::valid, it means
+          // that the user did not provide a hint_cell, and at the beginning
+          // of the while loop we performed an actual global search on the
+          // mesh vertices. Not finding the point then means the point is
+          // outside the domain, or that we've had problems with the
+          // algorithm above. Try as a last resort the other (simpler)
+          // algorithm.
+          if (current_cell.state() != IteratorState::valid)
+            return GridTools::find_active_cell_around_point(
+              mapping, mesh, p, marked_vertices, tolerance);
+
+          current_cell = typename MeshType::active_cell_iterator();
+        }
+      return cell_and_position;
+    }
+  } // namespace internal
 
-        if (found_cell == true)
-          return cell_and_position;
-        else if (approx_cell == true)
-          return cell_and_position_approx;
 
-        // The first time around, we check for vertices in the hint_cell. If
-        // that does not work, we set the cell iterator to an invalid one, and
-        // look for a global vertex close to the point. If that does not work,
-        // we are in trouble, and just throw an exception.
-        //
-        // If we got here, then we did not find the point. If the
-        // current_cell.state() here is not IteratorState::valid, it means that
-        // the user did not provide a hint_cell, and at the beginning of the
-        // while loop we performed an actual global search on the mesh
-        // vertices. Not finding the point then means the point is outside the
-        // domain, or that we've had problems with the algorithm above. Try as a
-        // last resort the other (simpler) algorithm.
-        if (current_cell.state() != IteratorState::valid)
-          return find_active_cell_around_point(
-            mapping, mesh, p, marked_vertices, tolerance);
-
-        current_cell = typename MeshType<dim, spacedim>::active_cell_iterator();
-      }
-    return cell_and_position;
+
+  template <int dim, template <int, int> class MeshType, int spacedim>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
+#ifndef _MSC_VER
+  std::pair<typename MeshType<dim, spacedim>::active_cell_iterator, Point<dim>>
+#else
+  std::pair<typename dealii::internal::
+              ActiveCellIterator<dim, spacedim, MeshType<dim, spacedim>>::type,
+            Point<dim>>
+#endif
+    find_active_cell_around_point(
+      const Mapping<dim, spacedim>  &mapping,
+      const MeshType<dim, spacedim> &mesh,
+      const Point<spacedim>         &p,
+      const std::vector<
+        std::set<typename MeshType<dim, spacedim>::active_cell_iterator>>
+        &vertex_to_cells,
+      const std::vector<std::vector<Tensor<1, spacedim>>>
+        &vertex_to_cell_centers,
+      const typename MeshType<dim, spacedim>::active_cell_iterator &cell_hint,
+      const std::vector<bool> &marked_vertices,
+      const RTree<std::pair<Point<spacedim>, unsigned int>>
+                  &used_vertices_rtree,
+      const double tolerance,
+      const RTree<
+        std::pair<BoundingBox<spacedim>,
+                  typename Triangulation<dim, spacedim>::active_cell_iterator>>
+        *relevant_cell_bounding_boxes_rtree)
+  {
+    return internal::find_active_cell_around_point(
+      mapping,
+      mesh,
+      p,
+      internal::VertexToCellSetsAccessor<
+        typename MeshType<dim, spacedim>::active_cell_iterator>(
+        vertex_to_cells),
+      vertex_to_cell_centers,
+      cell_hint,
+      marked_vertices,
+      used_vertices_rtree,
+      tolerance,
+      relevant_cell_bounding_boxes_rtree);
   }
 
 
@@ -1419,8 +1854,7 @@ namespace GridTools
 
     using active_cell_iterator =
       typename Triangulation<dim, spacedim>::active_cell_iterator;
-    const std::vector<std::set<active_cell_iterator>> vertex_to_cell =
-      vertex_to_cell_map(triangulation);
+    const VertexToCellMap<dim, spacedim> vertex_to_cell(triangulation);
 
     // Create a local index for the locally "owned" vertices
     types::global_vertex_index next_index      = 0;
@@ -1443,7 +1877,7 @@ namespace GridTools
               {
                 types::subdomain_id lowest_subdomain_id = cell->subdomain_id();
                 for (const auto &adjacent_cell :
-                     vertex_to_cell[cell->vertex_index(i)])
+                     vertex_to_cell.get_adjacent_cells(cell->vertex_index(i)))
                   lowest_subdomain_id = std::min(lowest_subdomain_id,
                                                  adjacent_cell->subdomain_id());
 
@@ -1462,7 +1896,8 @@ namespace GridTools
                         // Store the information that will be sent to the
                         // adjacent cells on other subdomains
                         for (const auto &adjacent_cell :
-                             vertex_to_cell[cell->vertex_index(i)])
+                             vertex_to_cell.get_adjacent_cells(
+                               cell->vertex_index(i)))
                           if (adjacent_cell->subdomain_id() !=
                               cell->subdomain_id())
                             {
@@ -1718,20 +2153,17 @@ namespace GridTools
             for (; (found == false) && (cell_set_it != end_cell_set);
                  ++cell_set_it)
               {
-                typename std::set<active_cell_iterator>::iterator
-                  candidate_cell =
-                    vertex_to_cell[(*cell_set_it)->vertex_index(i)].begin(),
-                  end_cell =
-                    vertex_to_cell[(*cell_set_it)->vertex_index(i)].end();
-                for (; candidate_cell != end_cell; ++candidate_cell)
+                for (const auto &candidate_cell :
+                     vertex_to_cell.get_adjacent_cells(
+                       (*cell_set_it)->vertex_index(i)))
                   {
                     std::string current_cellid =
-                      (*candidate_cell)->id().to_string();
+                      candidate_cell->id().to_string();
                     current_cellid.resize(max_cellid_size, '-');
                     if (current_cellid.compare(cellid_recv) == 0)
                       {
                         local_to_global_vertex_index
-                          [(*candidate_cell)->vertex_index(local_pos_recv)] =
+                          [candidate_cell->vertex_index(local_pos_recv)] =
                             global_id_recv;
                         found = true;
 
@@ -1993,6 +2425,38 @@ namespace GridTools
     }
   } // namespace internal
 
+  namespace internal
+  {
+    template <int dim, int spacedim>
+    std::vector<
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator>>
+    cells_in_hierarchical_order(const Triangulation<dim, spacedim> &tria)
+    {
+      std::vector<
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>>
+        cells(tria.n_levels());
+      if (tria.n_levels() == 0)
+        return cells;
+
+      cells[0].reserve(tria.n_cells(0));
+      for (const auto &cell : tria.cell_iterators_on_level(0))
+        cells[0].push_back(cell);
+
+      for (unsigned int level = 1; level < tria.n_levels(); ++level)
+        {
+          cells[level].reserve(tria.n_cells(level));
+          for (const auto &parent : cells[level - 1])
+            if (parent->has_children())
+              for (unsigned int c = 0; c < parent->n_children(); ++c)
+                cells[level].push_back(parent->child(c));
+        }
+
+      return cells;
+    }
+  } // namespace internal
+
+
+
   template <int dim, int spacedim>
   void
   partition_triangulation_zorder(const unsigned int            n_partitions,
@@ -3397,21 +3861,22 @@ namespace GridTools
       return found_points[id.second];
     };
 
-    // check if the given cell was already in the vector of cells before. If so,
-    // insert in the corresponding vectors the reference point and the id.
-    // Otherwise append a new entry to all vectors.
+    // Check if the given cell was already in the vector of cells before. If
+    // so, insert in the corresponding vectors the reference point and the
+    // id. Otherwise append a new entry to all vectors.
+    std::map<typename Triangulation<dim, spacedim>::active_cell_iterator,
+             unsigned int>
+               cell_to_index;
     const auto store_cell_point_and_id =
       [&](
         const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
         const Point<dim>   &ref_point,
         const unsigned int &id) {
-        const auto it = std::find(cells_out.rbegin(), cells_out.rend(), cell);
-        if (it != cells_out.rend())
+        const auto it = cell_to_index.emplace(cell, cells_out.size()).first;
+        if (it->second < cells_out.size())
           {
-            const auto cell_id =
-              (cells_out.size() - 1 - (it - cells_out.rbegin()));
-            qpoints_out[cell_id].emplace_back(ref_point);
-            maps_out[cell_id].emplace_back(id);
+            qpoints_out[it->second].emplace_back(ref_point);
+            maps_out[it->second].emplace_back(id);
           }
         else
           {
@@ -3421,38 +3886,40 @@ namespace GridTools
           }
       };
 
-    // Check all points within a given pair of box and cell
-    const auto check_all_points_within_box = [&](const auto &leaf) {
+    // The search proceeds in batches: For each candidate cell, we collect
+    // all points within its bounding box that have not been assigned to
+    // another candidate cell yet. The points of a batch are then mapped to
+    // the reference cell of the candidate cell all at once, which allows
+    // the mapping to run the Newton iteration of the inverse mapping on
+    // several points simultaneously (as MappingQ does with
+    // VectorizedArray), and different batches are processed in parallel.
+    std::vector<
+      std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+                std::vector<unsigned int>>>
+      batches;
+
+    // Collect all points within a given pair of box and cell
+    const auto collect_all_points_within_box = [&](const auto &leaf) {
       const double                relative_tolerance = 1e-12;
       const BoundingBox<spacedim> box =
         leaf.first.create_extended_relative(relative_tolerance);
-      const auto &cell_hint = leaf.second;
 
+      std::vector<unsigned int> ids;
       for (const auto &point_and_id :
            p_tree | bgi::adaptors::queried(!bgi::satisfies(already_found) &&
                                            bgi::intersects(box)))
-        {
-          const auto id = point_and_id.second;
-          const auto cell_and_ref =
-            GridTools::find_active_cell_around_point(cache,
-                                                     points[id],
-                                                     cell_hint);
-          const auto &cell      = cell_and_ref.first;
-          const auto &ref_point = cell_and_ref.second;
-
-          if (cell.state() == IteratorState::valid)
-            store_cell_point_and_id(cell, ref_point, id);
-          else
-            missing_points_out.emplace_back(id);
+        ids.push_back(point_and_id.second);
 
-          // Don't look anymore for this point
-          found_points[id] = true;
-        }
+      // Don't look anymore for these points
+      for (const unsigned int id : ids)
+        found_points[id] = true;
+
+      batches.emplace_back(leaf.second, std::move(ids));
     };
 
     // If a hint cell was given, use it
     if (cell_hint.state() == IteratorState::valid)
-      check_all_points_within_box(
+      collect_all_points_within_box(
         std::make_pair(mapping.get_bounding_box(cell_hint), cell_hint));
 
     // Now loop over all points that have not been found yet
@@ -3461,15 +3928,76 @@ namespace GridTools
         {
           // Get the closest cell to this point
           const auto leaf = b_tree.qbegin(bgi::nearest(points[i], 1));
-          // Now checks all points that fall within this box
+          // Now collect all points that fall within this box
           if (leaf != b_tree.qend())
-            check_all_points_within_box(*leaf);
+            collect_all_points_within_box(*leaf);
           else
             {
               // We should not get here. Throw an error.
               DEAL_II_ASSERT_UNREACHABLE();
             }
         }
+
+    // Map the points of each batch to the reference cell of its candidate
+    // cell
+    std::vector<std::vector<Point<dim>>> unit_points(batches.size());
+    parallel::apply_to_subranges(
+      0,
+      static_cast<unsigned int>(batches.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<Point<spacedim>> real_points;
+        for (unsigned int b = begin; b < end; ++b)
+          {
+            const auto &ids = batches[b].second;
+            real_points.resize(ids.size());
+            for (unsigned int i = 0; i < ids.size(); ++i)
+              real_points[i] = points[ids[i]];
+            unit_points[b].resize(ids.size());
+            mapping.transform_points_real_to_unit_cell(
+              batches[b].first,
+              make_array_view(real_points),
+              make_array_view(unit_points[b]));
+          }
+      },
+      8);
+
+    // Points strictly inside their candidate cell can only be located in
+    // that cell, so we can accept them directly unless the cell is
+    // artificial. All other points (those outside of the candidate cell,
+    // close to its boundary, for which the inverse mapping failed, or whose
+    // candidate cell is artificial) are searched for in the neighborhood of
+    // the candidate cell. The batches are worked on in the order in which
+    // they were created, so that the ordering of the output does not
+    // depend on the number of threads.
+    const double interior_tolerance = 1e-10;
+    for (unsigned int b = 0; b < batches.size(); ++b)
+      {
+        const auto &cell = batches[b].first;
+        const auto &ids  = batches[b].second;
+        for (unsigned int i = 0; i < ids.size(); ++i)
+          {
+            const Point<dim> &unit_point = unit_points[b][i];
+            if (!cell->is_artificial() &&
+                unit_point[0] != std::numeric_limits<double>::lowest() &&
+                cell->reference_cell().contains_point(unit_point,
+                                                      -interior_tolerance))
+              store_cell_point_and_id(cell, unit_point, ids[i]);
+            else
+              {
+                const auto cell_and_ref =
+                  GridTools::find_active_cell_around_point(cache,
+                                                           points[ids[i]],
+                                                           cell);
+                if (cell_and_ref.first.state() == IteratorState::valid)
+                  store_cell_point_and_id(cell_and_ref.first,
+                                          cell_and_ref.second,
+                                          ids[i]);
+                else
+                  missing_points_out.emplace_back(ids[i]);
+              }
+          }
+      }
+
     // Now make sure we send out the rest of the points that we did not find.
     for (unsigned int i = 0; i < np; ++i)
       if (found_points[i] == false)
@@ -3744,11 +4272,11 @@ namespace GridTools
                   Point<dim>>>
         locally_owned_active_cells_around_point;
 
-      const auto first_cell = GridTools::find_active_cell_around_point(
+      const auto first_cell = internal::find_active_cell_around_point(
         cache.get_mapping(),
         cache.get_triangulation(),
         point,
-        cache.get_vertex_to_cell_map(),
+        cache.get_compressed_vertex_to_cell_map(),
         cache.get_vertex_to_cell_centers_directions(),
         cell_hint,
         marked_vertices,
@@ -3769,7 +4297,7 @@ namespace GridTools
               point,
               tolerance,
               first_cell,
-              &cache.get_vertex_to_cell_map());
+              cache.get_compressed_vertex_to_cell_map());
 
           if (enforce_unique_mapping)
             {
@@ -4595,20 +5123,20 @@ namespace GridTools
   {
     const auto &mesh            = cache.get_triangulation();
     const auto &mapping         = cache.get_mapping();
-    const auto &vertex_to_cells = cache.get_vertex_to_cell_map();
+    const auto &vertex_to_cells = cache.get_compressed_vertex_to_cell_map();
     const auto &vertex_to_cell_centers =
       cache.get_vertex_to_cell_centers_directions();
     const auto &used_vertices_rtree = cache.get_used_vertices_rtree();
 
-    return find_active_cell_around_point(mapping,
-                                         mesh,
-                                         p,
-                                         vertex_to_cells,
-                                         vertex_to_cell_centers,
-                                         cell_hint,
-                                         marked_vertices,
-                                         used_vertices_rtree,
-                                         tolerance);
+    return internal::find_active_cell_around_point(mapping,
+                                                   mesh,
+                                                   p,
+                                                   vertex_to_cells,
+                                                   vertex_to_cell_centers,
+                                                   cell_hint,
+                                                   marked_vertices,
+                                                   used_vertices_rtree,
+                                                   tolerance);
   }
 
   template <int spacedim>
@@ -19,6 +19,11 @@
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
+#include <boost/geometry/algorithms/equals.hpp>
+
+#include <algorithm>
+#include <iterator>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
@@ -29,9 +34,11 @@ namespace GridTools
     : update_flags(update_all)
     , tria(&tria)
     , mapping(&mapping)
+    , vertex_to_cell_sets_outdated(true)
   {
     tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+      tria.signals.any_change.connect([&]() { update_after_change(); });
+    connect_to_refinement_signals();
   }
 
 
@@ -40,9 +47,11 @@ namespace GridTools
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria)
     : update_flags(update_all)
     , tria(&tria)
+    , vertex_to_cell_sets_outdated(true)
   {
     tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+      tria.signals.any_change.connect([&]() { update_after_change(); });
+    connect_to_refinement_signals();
 
     // Allow users to set this class up with an empty Triangulation and no
     // Mapping argument by deferring Mapping assignment until after the
@@ -71,6 +80,9 @@ namespace GridTools
       tria_change_signal.disconnect();
     if (tria_create_signal.connected())
       tria_create_signal.disconnect();
+    for (auto &connection : tria_refinement_signals)
+      if (connection.connected())
+        connection.disconnect();
   }
 
 
@@ -80,6 +92,299 @@ namespace GridTools
   Cache<dim, spacedim>::mark_for_update(const CacheUpdateFlags &flags)
   {
     update_flags |= flags;
+    if (flags & update_vertex_to_cell_map)
+      vertex_to_cell_sets_outdated = true;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::connect_to_refinement_signals()
+  {
+    // the cells of parallel triangulations also change in ways that are not
+    // reported by the signals below, e.g., when the mesh is repartitioned, so
+    // we only track the changes of serial triangulations
+    if (dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+          &*tria) != nullptr)
+      return;
+
+    tria_refinement_signals.push_back(
+      tria->signals.pre_refinement.connect([&]() {
+        refinement_changes                       = RefinementChanges();
+        refinement_changes.in_progress           = true;
+        refinement_changes.n_active_cells_before = tria->n_active_cells();
+      }));
+
+    tria_refinement_signals.push_back(
+      tria->signals.pre_coarsening_on_cell.connect(
+        [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+          refinement_changes.coarsened_cells.push_back(cell);
+          refinement_changes.n_active_cells_difference -=
+            cell->n_children() - 1;
+
+          // the bounding boxes of the children are needed to remove them
+          // from the RTree objects, but we can not compute them anymore once
+          // the children are gone
+          const bool store_bounding_boxes =
+            !(update_flags & update_cell_bounding_boxes_rtree) ||
+            !(update_flags & update_locally_owned_cell_bounding_boxes_rtree);
+          for (unsigned int c = 0; c < cell->n_children(); ++c)
+            {
+              const typename Triangulation<dim, spacedim>::active_cell_iterator
+                child = cell->child(c);
+              for (const unsigned int v : child->vertex_indices())
+                refinement_changes.vertices_of_removed_cells.push_back(
+                  child->vertex_index(v));
+              if (store_bounding_boxes)
+                refinement_changes.bounding_boxes_of_removed_cells
+                  .emplace_back(mapping->get_bounding_box(child), child);
+            }
+        }));
+
+    tria_refinement_signals.push_back(
+      tria->signals.post_refinement_on_cell.connect(
+        [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+          refinement_changes.refined_cells.push_back(cell);
+          refinement_changes.n_active_cells_difference +=
+            cell->n_children() - 1;
+        }));
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::update_after_change()
+  {
+    const RefinementChanges changes = std::move(refinement_changes);
+    refinement_changes              = RefinementChanges();
+
+    // unless this is the end of a refinement cycle of which we have seen all
+    // changes, we have to rebuild everything
+    if (changes.in_progress == false ||
+        tria->n_active_cells() != changes.n_active_cells_before +
+                                    changes.n_active_cells_difference)
+      {
+        mark_for_update(update_all);
+        return;
+      }
+
+    // the following data structures are updated below if they are currently
+    // up to date, all others are simply rebuilt upon the next access
+    const CacheUpdateFlags incremental_flags =
+      update_vertex_to_cell_map | update_vertex_to_cell_centers_directions |
+      update_used_vertices | update_used_vertices_rtree |
+      update_cell_bounding_boxes_rtree |
+      update_locally_owned_cell_bounding_boxes_rtree;
+    mark_for_update(update_all & ~incremental_flags);
+
+    // some of the incremental updates need the previous state of other data
+    // structures
+    if (update_flags & update_vertex_to_cell_map)
+      mark_for_update(update_vertex_to_cell_centers_directions);
+    if (update_flags & update_used_vertices)
+      mark_for_update(update_used_vertices_rtree);
+
+    using active_cell_iterator =
+      typename Triangulation<dim, spacedim>::active_cell_iterator;
+
+    // first collect the vertices whose information might have changed, i.e.,
+    // all vertices on the closure of the refined and coarsened cells,
+    // including those in the interior of their faces and edges
+    std::vector<bool>         is_affected_vertex(tria->n_vertices(), false);
+    std::vector<unsigned int> affected_vertices;
+    const auto                add_vertex = [&](const unsigned int vertex) {
+      if (is_affected_vertex[vertex] == false)
+        {
+          is_affected_vertex[vertex] = true;
+          affected_vertices.push_back(vertex);
+        }
+    };
+    const auto add_vertices_of_descendants = [&](const auto &object,
+                                                 const auto &self) -> void {
+      for (const unsigned int v : object->vertex_indices())
+        add_vertex(object->vertex_index(v));
+      if (object->has_children())
+        for (unsigned int c = 0; c < object->n_children(); ++c)
+          self(object->child(c), self);
+    };
+
+    // the cells that have become active, i.e., the children of refined cells
+    // and the coarsened cells
+    std::vector<active_cell_iterator> new_cells;
+    for (const auto &cells : {changes.refined_cells, changes.coarsened_cells})
+      for (const auto &cell : cells)
+        {
+          add_vertices_of_descendants(cell, add_vertices_of_descendants);
+          if constexpr (dim > 1)
+            for (const unsigned int f : cell->face_indices())
+              add_vertices_of_descendants(cell->face(f),
+                                          add_vertices_of_descendants);
+          if constexpr (dim == 3)
+            for (const unsigned int l : cell->line_indices())
+              add_vertices_of_descendants(cell->line(l),
+                                          add_vertices_of_descendants);
+
+          if (cell->has_children())
+            for (unsigned int c = 0; c < cell->n_children(); ++c)
+              new_cells.emplace_back(cell->child(c));
+          else
+            new_cells.emplace_back(cell);
+        }
+    for (const unsigned int vertex : changes.vertices_of_removed_cells)
+      add_vertex(vertex);
+
+    // the vertex-to-cell map: every cell that contributes to the entry of an
+    // affected vertex touches the closure of a changed cell, and therefore
+    // either is a new cell or was previously listed for one of the affected
+    // vertices that already existed
+    if (!(update_flags & update_vertex_to_cell_map))
+      {
+        std::lock_guard<std::mutex> lock(vertex_to_cells_mutex);
+
+        vertex_to_cells.update(affected_vertices, new_cells);
+        vertex_to_cell_sets_outdated = true;
+
+        // the directions from the vertices to the cell centers follow from
+        // the new vertex-to-cell map
+        if (!(update_flags & update_vertex_to_cell_centers_directions))
+          {
+            std::lock_guard<std::mutex> lock(vertex_to_cell_centers_mutex);
+
+            vertex_to_cell_centers.resize(tria->n_vertices());
+            for (const unsigned int vertex : affected_vertices)
+              {
+                vertex_to_cell_centers[vertex].clear();
+                if (tria->vertex_used(vertex))
+                  for (unsigned int i = 0;
+                       i < vertex_to_cells.n_adjacent_cells(vertex);
+                       ++i)
+                    {
+                      Tensor<1, spacedim> direction =
+                        vertex_to_cells.get_adjacent_cell(vertex, i)
+                          ->center() -
+                        tria->get_vertices()[vertex];
+                      direction /= direction.norm();
+                      vertex_to_cell_centers[vertex].push_back(direction);
+                    }
+              }
+          }
+      }
+
+    // the used vertices: vertices can only have been added or removed among
+    // the affected ones, and new vertices are vertices of new cells
+    if (!(update_flags & update_used_vertices))
+      {
+        std::lock_guard<std::mutex> lock(used_vertices_mutex);
+        const bool update_rtree = !(update_flags & update_used_vertices_rtree);
+
+        std::vector<std::pair<Point<spacedim>, unsigned int>> removed_vertices;
+        for (const unsigned int vertex : affected_vertices)
+          if (tria->vertex_used(vertex) == false)
+            {
+              const auto entry = used_vertices.find(vertex);
+              if (entry != used_vertices.end())
+                {
+                  removed_vertices.emplace_back(entry->second, vertex);
+                  used_vertices.erase(entry);
+                }
+            }
+
+        // the indices of vertices that were freed by coarsening may have
+        // been reused by refinement in the same cycle, so the locations of
+        // the vertices of removed cells need to be checked as well
+        std::vector<bool> is_vertex_of_removed_cell(tria->n_vertices(), false);
+        for (const unsigned int vertex : changes.vertices_of_removed_cells)
+          is_vertex_of_removed_cell[vertex] = true;
+
+        std::vector<std::pair<Point<spacedim>, unsigned int>> added_vertices;
+        for (const auto &cell : new_cells)
+          {
+            bool has_new_vertex = false;
+            for (const unsigned int v : cell->vertex_indices())
+              if (is_vertex_of_removed_cell[cell->vertex_index(v)] ||
+                  used_vertices.find(cell->vertex_index(v)) ==
+                    used_vertices.end())
+                has_new_vertex = true;
+            if (has_new_vertex)
+              {
+                const auto vertices = mapping->get_vertices(cell);
+                for (unsigned int v = 0; v < vertices.size(); ++v)
+                  {
+                    const unsigned int vertex = cell->vertex_index(v);
+                    const auto [entry, inserted] =
+                      used_vertices.emplace(vertex, vertices[v]);
+                    if (inserted)
+                      added_vertices.emplace_back(vertices[v], vertex);
+                    else if (is_vertex_of_removed_cell[vertex] &&
+                             entry->second != vertices[v])
+                      {
+                        removed_vertices.emplace_back(entry->second, vertex);
+                        entry->second = vertices[v];
+                        added_vertices.emplace_back(vertices[v], vertex);
+                      }
+                  }
+              }
+          }
+
+        if (update_rtree)
+          {
+            std::lock_guard<std::mutex> lock(used_vertices_rtree_mutex);
+            for (const auto &vertex : removed_vertices)
+              used_vertices_rtree.remove(vertex);
+            for (const auto &vertex : added_vertices)
+              used_vertices_rtree.insert(vertex);
+          }
+      }
+
+    // the RTree objects of the cell bounding boxes: remove the cells that
+    // have been refined or removed and add the new cells. if we can not
+    // find a box we want to remove, e.g., because the mapping has changed
+    // in the meantime, we rebuild the tree from scratch
+    const auto update_bounding_boxes =
+      [&](RTree<std::pair<BoundingBox<spacedim>, active_cell_iterator>> &rtree,
+          const CacheUpdateFlags flag) {
+        namespace bgi = boost::geometry::index;
+
+        bool success = true;
+        for (const auto &cell : changes.refined_cells)
+          {
+            // the refined cells are not active anymore, so find their
+            // entries via their level and index
+            std::vector<std::pair<BoundingBox<spacedim>, active_cell_iterator>>
+              entries;
+            rtree.query(bgi::intersects(mapping->get_bounding_box(cell)) &&
+                          bgi::satisfies([&](const auto &entry) {
+                            return entry.second->level() == cell->level() &&
+                                   entry.second->index() == cell->index();
+                          }),
+                        std::back_inserter(entries));
+            success = success && (entries.size() == 1) &&
+                      (rtree.remove(entries[0]) == 1);
+          }
+        for (const auto &box : changes.bounding_boxes_of_removed_cells)
+          success = success && (rtree.remove(box) == 1);
+        for (const auto &cell : new_cells)
+          rtree.insert(std::make_pair(mapping->get_bounding_box(cell), cell));
+
+        if (success == false)
+          mark_for_update(flag);
+      };
+
+    if (!(update_flags & update_cell_bounding_boxes_rtree))
+      {
+        std::lock_guard<std::mutex> lock(cell_bounding_boxes_rtree_mutex);
+        update_bounding_boxes(cell_bounding_boxes_rtree,
+                              update_cell_bounding_boxes_rtree);
+      }
+    if (!(update_flags & update_locally_owned_cell_bounding_boxes_rtree))
+      {
+        std::lock_guard<std::mutex> lock(
+          locally_owned_cell_bounding_boxes_rtree_mutex);
+        update_bounding_boxes(locally_owned_cell_bounding_boxes_rtree,
+                              update_locally_owned_cell_bounding_boxes_rtree);
+      }
   }
 
 
@@ -88,6 +393,27 @@ namespace GridTools
   const std::vector<
     std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>> &
   Cache<dim, spacedim>::get_vertex_to_cell_map() const
+  {
+    std::lock_guard<std::mutex> lock(vertex_to_cell_sets_mutex);
+
+    // the compressed map might need to be updated first, which also marks
+    // the sets as outdated
+    const VertexToCellMap<dim, spacedim> &compressed_vertex_to_cells =
+      get_compressed_vertex_to_cell_map();
+    if (vertex_to_cell_sets_outdated)
+      {
+        vertex_to_cell_sets =
+          compressed_vertex_to_cells.get_vector_of_sets();
+        vertex_to_cell_sets_outdated = false;
+      }
+    return vertex_to_cell_sets;
+  }
+
+
+
+  template <int dim, int spacedim>
+  const VertexToCellMap<dim, spacedim> &
+  Cache<dim, spacedim>::get_compressed_vertex_to_cell_map() const
   {
     // In the following, we will first check whether the data structure
     // in question needs to be updated (in which case we update it, and
@@ -98,7 +424,8 @@ namespace GridTools
 
     if (update_flags & update_vertex_to_cell_map)
       {
-        vertex_to_cells = GridTools::vertex_to_cell_map(*tria);
+        vertex_to_cells.reinit(*tria);
+        vertex_to_cell_sets_outdated = true;
 
         // Atomically clear the flag that indicates that this data member
         // needs to be updated:
@@ -123,7 +450,7 @@ namespace GridTools
     if (update_flags & update_vertex_to_cell_centers_directions)
       {
         vertex_to_cell_centers = GridTools::vertex_to_cell_centers_directions(
-          *tria, get_vertex_to_cell_map());
+          *tria, get_compressed_vertex_to_cell_map());
 
         // Atomically clear the flag that indicates that this data member
         // needs to be updated:
@@ -12,7 +12,9 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/bounding_box.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/types.h>
@@ -36,9 +38,12 @@
 
 #include <deal.II/lac/full_matrix.h>
 
+#include <deal.II/numerics/rtree.h>
+
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <iterator>
 #include <limits>
 #include <list>
 #include <map>
@@ -601,216 +606,270 @@ namespace GridTools
 
 
 
-  template <int dim, template <int, int> class MeshType, int spacedim>
-  DEAL_II_CXX20_REQUIRES(
-    (concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
-#ifndef _MSC_VER
-  std::vector<std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
-                        Point<dim>>>
-#else
-  std::vector<std::pair<
-    typename dealii::internal::
-      ActiveCellIterator<dim, spacedim, MeshType<dim, spacedim>>::type,
-    Point<dim>>>
-#endif
-    find_all_active_cells_around_point(
-      const Mapping<dim, spacedim>  &mapping,
-      const MeshType<dim, spacedim> &mesh,
-      const Point<spacedim>         &p,
-      const double                   tolerance,
-      const std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
-                      Point<dim>>   &first_cell,
-      const std::vector<
-        std::set<typename MeshType<dim, spacedim>::active_cell_iterator>>
-        *vertex_to_cells)
+  namespace
   {
-    std::vector<
-      std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
-                Point<dim>>>
-      cells_and_points;
+    /**
+     * The implementation of find_all_active_cells_around_point() starting
+     * from a first cell. @p adjacent_cells is a function that returns the
+     * active cells adjacent to a given vertex.
+     */
+    template <int dim,
+              int spacedim,
+              typename MeshType,
+              typename AdjacentCellsFunction>
+    std::vector<std::pair<typename MeshType::active_cell_iterator, Point<dim>>>
+    find_all_active_cells_around_first_cell(
+      const Mapping<dim, spacedim> &mapping,
+      const Point<spacedim>        &p,
+      const double                  tolerance,
+      const std::pair<typename MeshType::active_cell_iterator, Point<dim>>
+                                  &first_cell,
+      const AdjacentCellsFunction &adjacent_cells)
+    {
+      std::vector<
+        std::pair<typename MeshType::active_cell_iterator, Point<dim>>>
+        cells_and_points;
 
-    // insert the fist cell and point into the vector
-    cells_and_points.push_back(first_cell);
+      // insert the fist cell and point into the vector
+      cells_and_points.push_back(first_cell);
 
-    const Point<dim> unit_point = cells_and_points.front().second;
-    const auto       my_cell    = cells_and_points.front().first;
+      const Point<dim> unit_point = cells_and_points.front().second;
+      const auto       my_cell    = cells_and_points.front().first;
 
-    std::vector<typename MeshType<dim, spacedim>::active_cell_iterator>
-      cells_to_add;
+      std::vector<typename MeshType::active_cell_iterator> cells_to_add;
 
-    if (my_cell->reference_cell().is_hyper_cube())
-      {
-        // check if the given point is on the surface of the unit cell. If yes,
-        // need to find all neighbors
+      if (my_cell->reference_cell().is_hyper_cube())
+        {
+          // check if the given point is on the surface of the unit cell. If
+          // yes, need to find all neighbors
+
+          Tensor<1, dim> distance_to_center;
+          unsigned int   n_dirs_at_threshold = 0;
+          unsigned int   last_point_at_threshold =
+            numbers::invalid_unsigned_int;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              distance_to_center[d] = std::abs(unit_point[d] - 0.5);
+              if (distance_to_center[d] > 0.5 - tolerance)
+                {
+                  ++n_dirs_at_threshold;
+                  last_point_at_threshold = d;
+                }
+            }
 
-        Tensor<1, dim> distance_to_center;
-        unsigned int   n_dirs_at_threshold     = 0;
-        unsigned int   last_point_at_threshold = numbers::invalid_unsigned_int;
-        for (unsigned int d = 0; d < dim; ++d)
-          {
-            distance_to_center[d] = std::abs(unit_point[d] - 0.5);
-            if (distance_to_center[d] > 0.5 - tolerance)
-              {
-                ++n_dirs_at_threshold;
-                last_point_at_threshold = d;
-              }
-          }
+          // point is within face -> only need neighbor
+          if (n_dirs_at_threshold == 1)
+            {
+              unsigned int neighbor_index =
+                2 * last_point_at_threshold +
+                (unit_point[last_point_at_threshold] > 0.5 ? 1 : 0);
+              if (!my_cell->at_boundary(neighbor_index))
+                {
+                  const auto neighbor_cell = my_cell->neighbor(neighbor_index);
 
-        // point is within face -> only need neighbor
-        if (n_dirs_at_threshold == 1)
-          {
-            unsigned int neighbor_index =
-              2 * last_point_at_threshold +
-              (unit_point[last_point_at_threshold] > 0.5 ? 1 : 0);
-            if (!my_cell->at_boundary(neighbor_index))
-              {
-                const auto neighbor_cell = my_cell->neighbor(neighbor_index);
+                  if (neighbor_cell->is_active())
+                    cells_to_add.push_back(neighbor_cell);
+                  else
+                    for (const auto &child_cell :
+                         neighbor_cell->child_iterators())
+                      {
+                        if (child_cell->is_active())
+                          cells_to_add.push_back(child_cell);
+                      }
+                }
+            }
+          // corner point -> use all neighbors
+          else if (n_dirs_at_threshold == dim)
+            {
+              unsigned int local_vertex_index = 0;
+              for (unsigned int d = 0; d < dim; ++d)
+                local_vertex_index += (unit_point[d] > 0.5 ? 1 : 0) << d;
+
+              const auto fu = [&](const auto &tentative_cells) {
+                for (const auto &cell : tentative_cells)
+                  if (cell != my_cell)
+                    cells_to_add.push_back(cell);
+              };
+
+              const auto vertex_index =
+                my_cell->vertex_index(local_vertex_index);
 
-                if (neighbor_cell->is_active())
-                  cells_to_add.push_back(neighbor_cell);
-                else
-                  for (const auto &child_cell :
-                       neighbor_cell->child_iterators())
+              fu(adjacent_cells(vertex_index));
+            }
+          // point on line in 3d: We cannot simply take the intersection between
+          // the two vertices of cells because of hanging nodes. So instead we
+          // list the vertices around both points and then select the
+          // appropriate cells according to the result of read_to_unit_cell
+          // below.
+          else if (n_dirs_at_threshold == 2)
+            {
+              std::pair<unsigned int, unsigned int> vertex_indices[3];
+              unsigned int                          count_vertex_indices = 0;
+              unsigned int free_direction = numbers::invalid_unsigned_int;
+              for (unsigned int d = 0; d < dim; ++d)
+                {
+                  if (distance_to_center[d] > 0.5 - tolerance)
                     {
-                      if (child_cell->is_active())
-                        cells_to_add.push_back(child_cell);
+                      vertex_indices[count_vertex_indices].first = d;
+                      vertex_indices[count_vertex_indices].second =
+                        unit_point[d] > 0.5 ? 1 : 0;
+                      ++count_vertex_indices;
                     }
-              }
-          }
-        // corner point -> use all neighbors
-        else if (n_dirs_at_threshold == dim)
-          {
-            unsigned int local_vertex_index = 0;
-            for (unsigned int d = 0; d < dim; ++d)
-              local_vertex_index += (unit_point[d] > 0.5 ? 1 : 0) << d;
+                  else
+                    free_direction = d;
+                }
 
-            const auto fu = [&](const auto &tentative_cells) {
-              for (const auto &cell : tentative_cells)
-                if (cell != my_cell)
-                  cells_to_add.push_back(cell);
-            };
+              AssertDimension(count_vertex_indices, 2);
+              Assert(free_direction != numbers::invalid_unsigned_int,
+                     ExcInternalError());
 
-            const auto vertex_index = my_cell->vertex_index(local_vertex_index);
+              const unsigned int first_vertex =
+                (vertex_indices[0].second << vertex_indices[0].first) +
+                (vertex_indices[1].second << vertex_indices[1].first);
+              for (unsigned int d = 0; d < 2; ++d)
+                {
+                  const auto fu = [&](const auto &tentative_cells) {
+                    for (const auto &cell : tentative_cells)
+                      {
+                        bool cell_not_yet_present = true;
+                        for (const auto &other_cell : cells_to_add)
+                          if (cell == other_cell)
+                            {
+                              cell_not_yet_present = false;
+                              break;
+                            }
+                        if (cell_not_yet_present)
+                          cells_to_add.push_back(cell);
+                      }
+                  };
 
-            if (vertex_to_cells != nullptr)
-              fu((*vertex_to_cells)[vertex_index]);
-            else
-              fu(find_cells_adjacent_to_vertex(mesh, vertex_index));
-          }
-        // point on line in 3d: We cannot simply take the intersection between
-        // the two vertices of cells because of hanging nodes. So instead we
-        // list the vertices around both points and then select the
-        // appropriate cells according to the result of read_to_unit_cell
-        // below.
-        else if (n_dirs_at_threshold == 2)
-          {
-            std::pair<unsigned int, unsigned int> vertex_indices[3];
-            unsigned int                          count_vertex_indices = 0;
-            unsigned int free_direction = numbers::invalid_unsigned_int;
-            for (unsigned int d = 0; d < dim; ++d)
-              {
-                if (distance_to_center[d] > 0.5 - tolerance)
+                  const auto vertex_index =
+                    my_cell->vertex_index(first_vertex + (d << free_direction));
+
+                  fu(adjacent_cells(vertex_index));
+                }
+            }
+        }
+      else
+        {
+          // Note: The non-hypercube path takes a very naive approach and
+          // checks all possible neighbors. This can be made faster by 1)
+          // checking if the point is in the inner cell and 2) identifying
+          // the right lines/vertices so that the number of potential
+          // neighbors is reduced.
+
+          for (const auto v : my_cell->vertex_indices())
+            {
+              const auto fu = [&](const auto &tentative_cells) {
+                for (const auto &cell : tentative_cells)
                   {
-                    vertex_indices[count_vertex_indices].first = d;
-                    vertex_indices[count_vertex_indices].second =
-                      unit_point[d] > 0.5 ? 1 : 0;
-                    ++count_vertex_indices;
+                    bool cell_not_yet_present = true;
+                    for (const auto &other_cell : cells_to_add)
+                      if (cell == other_cell)
+                        {
+                          cell_not_yet_present = false;
+                          break;
+                        }
+                    if (cell_not_yet_present)
+                      cells_to_add.push_back(cell);
                   }
-                else
-                  free_direction = d;
-              }
+              };
 
-            AssertDimension(count_vertex_indices, 2);
-            Assert(free_direction != numbers::invalid_unsigned_int,
-                   ExcInternalError());
+              const auto vertex_index = my_cell->vertex_index(v);
+
+              fu(adjacent_cells(vertex_index));
+            }
+        }
 
-            const unsigned int first_vertex =
-              (vertex_indices[0].second << vertex_indices[0].first) +
-              (vertex_indices[1].second << vertex_indices[1].first);
-            for (unsigned int d = 0; d < 2; ++d)
+      for (const auto &cell : cells_to_add)
+        {
+          if (cell != my_cell)
+            try
               {
-                const auto fu = [&](const auto &tentative_cells) {
-                  for (const auto &cell : tentative_cells)
-                    {
-                      bool cell_not_yet_present = true;
-                      for (const auto &other_cell : cells_to_add)
-                        if (cell == other_cell)
-                          {
-                            cell_not_yet_present = false;
-                            break;
-                          }
-                      if (cell_not_yet_present)
-                        cells_to_add.push_back(cell);
-                    }
-                };
+                const Point<dim> p_unit =
+                  mapping.transform_real_to_unit_cell(cell, p);
+                if (cell->reference_cell().contains_point(p_unit, tolerance))
+                  cells_and_points.emplace_back(cell, p_unit);
+              }
+            catch (typename Mapping<dim>::ExcTransformationFailed &)
+              {}
+        }
 
-                const auto vertex_index =
-                  my_cell->vertex_index(first_vertex + (d << free_direction));
+      std::sort(
+        cells_and_points.begin(),
+        cells_and_points.end(),
+        [](const std::pair<typename MeshType::active_cell_iterator,
+                           Point<dim>> &a,
+           const std::pair<typename MeshType::active_cell_iterator,
+                           Point<dim>> &b) { return a.first < b.first; });
 
-                if (vertex_to_cells != nullptr)
-                  fu((*vertex_to_cells)[vertex_index]);
-                else
-                  fu(find_cells_adjacent_to_vertex(mesh, vertex_index));
-              }
-          }
-      }
-    else
-      {
-        // Note: The non-hypercube path takes a very naive approach and
-        // checks all possible neighbors. This can be made faster by 1)
-        // checking if the point is in the inner cell and 2) identifying
-        // the right lines/vertices so that the number of potential
-        // neighbors is reduced.
+      return cells_and_points;
+    }
+  } // namespace
 
-        for (const auto v : my_cell->vertex_indices())
-          {
-            const auto fu = [&](const auto &tentative_cells) {
-              for (const auto &cell : tentative_cells)
-                {
-                  bool cell_not_yet_present = true;
-                  for (const auto &other_cell : cells_to_add)
-                    if (cell == other_cell)
-                      {
-                        cell_not_yet_present = false;
-                        break;
-                      }
-                  if (cell_not_yet_present)
-                    cells_to_add.push_back(cell);
-                }
-            };
 
-            const auto vertex_index = my_cell->vertex_index(v);
 
-            if (vertex_to_cells != nullptr)
-              fu((*vertex_to_cells)[vertex_index]);
-            else
-              fu(find_cells_adjacent_to_vertex(mesh, vertex_index));
-          }
-      }
+  template <int dim, template <int, int> class MeshType, int spacedim>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
+#ifndef _MSC_VER
+  std::vector<std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
+                        Point<dim>>>
+#else
+  std::vector<std::pair<
+    typename dealii::internal::
+      ActiveCellIterator<dim, spacedim, MeshType<dim, spacedim>>::type,
+    Point<dim>>>
+#endif
+    find_all_active_cells_around_point(
+      const Mapping<dim, spacedim>  &mapping,
+      const MeshType<dim, spacedim> &mesh,
+      const Point<spacedim>         &p,
+      const double                   tolerance,
+      const std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
+                      Point<dim>>   &first_cell,
+      const std::vector<
+        std::set<typename MeshType<dim, spacedim>::active_cell_iterator>>
+        *vertex_to_cells)
+  {
+    using active_cell_iterator =
+      typename MeshType<dim, spacedim>::active_cell_iterator;
+    return find_all_active_cells_around_first_cell<dim,
+                                                   spacedim,
+                                                   MeshType<dim, spacedim>>(
+      mapping,
+      p,
+      tolerance,
+      first_cell,
+      [&](const unsigned int vertex) -> std::vector<active_cell_iterator> {
+        if (vertex_to_cells != nullptr)
+          return {(*vertex_to_cells)[vertex].begin(),
+                  (*vertex_to_cells)[vertex].end()};
+        else
+          return find_cells_adjacent_to_vertex(mesh, vertex);
+      });
+  }
 
-    for (const auto &cell : cells_to_add)
-      {
-        if (cell != my_cell)
-          try
-            {
-              const Point<dim> p_unit =
-                mapping.transform_real_to_unit_cell(cell, p);
-              if (cell->reference_cell().contains_point(p_unit, tolerance))
-                cells_and_points.emplace_back(cell, p_unit);
-            }
-          catch (typename Mapping<dim>::ExcTransformationFailed &)
-            {}
-      }
 
-    std::sort(
-      cells_and_points.begin(),
-      cells_and_points.end(),
-      [](const std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
-                         Point<dim>> &a,
-         const std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
-                         Point<dim>> &b) { return a.first < b.first; });
 
-    return cells_and_points;
+  template <int dim, int spacedim>
+  std::vector<
+    std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+              Point<dim>>>
+  find_all_active_cells_around_point(
+    const Mapping<dim, spacedim>         &mapping,
+    const Triangulation<dim, spacedim> & /*mesh*/,
+    const Point<spacedim>                &p,
+    const double                          tolerance,
+    const std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+                    Point<dim>>          &first_cell,
+    const VertexToCellMap<dim, spacedim> &vertex_to_cells)
+  {
+    using MeshType = Triangulation<dim, spacedim>;
+    return find_all_active_cells_around_first_cell<dim, spacedim, MeshType>(
+      mapping, p, tolerance, first_cell, [&](const unsigned int vertex) {
+        return vertex_to_cells.get_adjacent_cells(vertex);
+      });
   }
 
 
@@ -2157,40 +2216,117 @@ namespace GridTools
 
     unsigned int n_matches = 0;
 
-    // Match with a complexity of O(n^2). This could be improved...
-    using PairIterator =
-      typename std::set<std::pair<CellIterator, unsigned int>>::const_iterator;
-    for (PairIterator it1 = pairs1.begin(); it1 != pairs1.end(); ++it1)
+    // Rather than comparing every face of the first set with every face of
+    // the second one, put the centers of the faces of the second set into an
+    // RTree and only compare with those faces whose centers are close to the
+    // transformed center of a face of the first set. The component in
+    // 'direction' is ignored by the comparison, so set it to zero for all
+    // centers. If two faces match, their centers agree up to the tolerance
+    // as well, since the center is the average of the vertices.
+    const auto transformed_center =
+      [&](const CellIterator &cell, const unsigned int face_no) {
+        const Point<space_dim> center = cell->face(face_no)->center();
+        Point<space_dim>       transformed;
+        if (matrix.m() == space_dim)
+          for (unsigned int i = 0; i < space_dim; ++i)
+            for (unsigned int j = 0; j < space_dim; ++j)
+              transformed[i] += matrix(i, j) * center[j];
+        else
+          transformed = center;
+        transformed += offset;
+        transformed[direction] = 0.;
+        return transformed;
+      };
+
+    const std::vector<std::pair<CellIterator, unsigned int>> faces1(
+      pairs1.begin(), pairs1.end());
+    const std::vector<std::pair<CellIterator, unsigned int>> faces2(
+      pairs2.begin(), pairs2.end());
+
+    std::vector<std::pair<Point<space_dim>, unsigned int>> centers2;
+    centers2.reserve(faces2.size());
+    for (unsigned int i = 0; i < faces2.size(); ++i)
       {
-        for (PairIterator it2 = pairs2.begin(); it2 != pairs2.end(); ++it2)
+        Point<space_dim> center =
+          faces2[i].first->face(faces2[i].second)->center();
+        center[direction] = 0.;
+        centers2.emplace_back(center, i);
+      }
+    const auto rtree = pack_rtree(centers2);
+
+    // For each face of the first set, find all faces of the second set that
+    // match it. This can be done in parallel. The candidates are sorted by
+    // their position in the second set, so that we can pick the same
+    // partner as a search through the second set in order would.
+    std::vector<std::vector<
+      std::pair<unsigned int, types::geometric_orientation>>>
+      matches(faces1.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(faces1.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<std::pair<Point<space_dim>, unsigned int>> candidates;
+        for (unsigned int i = begin; i < end; ++i)
           {
-            const CellIterator cell1     = it1->first;
-            const CellIterator cell2     = it2->first;
-            const unsigned int face_idx1 = it1->second;
-            const unsigned int face_idx2 = it2->second;
-            if (const std::optional<types::geometric_orientation> orientation =
-                  GridTools::orthogonal_equality(cell1->face(face_idx1),
-                                                 cell2->face(face_idx2),
-                                                 direction,
-                                                 offset,
-                                                 matrix,
-                                                 abs_tol))
+            const CellIterator     cell1     = faces1[i].first;
+            const unsigned int     face_idx1 = faces1[i].second;
+            const Point<space_dim> center =
+              transformed_center(cell1, face_idx1);
+
+            // rounding may make the centers differ slightly more than the
+            // vertices, so enlarge the search box a bit
+            const double tolerance = abs_tol + 1e-12 * (1. + center.norm());
+            Point<space_dim> lower = center, upper = center;
+            for (unsigned int d = 0; d < space_dim; ++d)
               {
-                // We have a match, so insert the matching pairs and
-                // remove the matched cell in pairs2 to speed up the
-                // matching:
-                const PeriodicFacePair<CellIterator> matched_face = {
-                  {cell1, cell2},
-                  {face_idx1, face_idx2},
-                  orientation.value(),
-                  matrix};
-                matched_pairs.push_back(matched_face);
-                pairs2.erase(it2);
-                ++n_matches;
-                break;
+                lower[d] -= tolerance;
+                upper[d] += tolerance;
               }
+
+            candidates.clear();
+            rtree.query(boost::geometry::index::intersects(
+                          BoundingBox<space_dim>(std::make_pair(lower, upper))),
+                        std::back_inserter(candidates));
+            std::sort(candidates.begin(),
+                      candidates.end(),
+                      [](const auto &a, const auto &b) {
+                        return a.second < b.second;
+                      });
+
+            for (const auto &candidate : candidates)
+              if (const std::optional<types::geometric_orientation>
+                    orientation = GridTools::orthogonal_equality(
+                      cell1->face(face_idx1),
+                      faces2[candidate.second].first->face(
+                        faces2[candidate.second].second),
+                      direction,
+                      offset,
+                      matrix,
+                      abs_tol))
+                matches[i].emplace_back(candidate.second, orientation.value());
+          }
+      },
+      /* grainsize = */ 64);
+
+    // Now assign each face of the first set the first matching face of the
+    // second set that has not been matched before, and remove the matched
+    // faces from the second set.
+    std::vector<bool> matched2(faces2.size(), false);
+    for (unsigned int i = 0; i < faces1.size(); ++i)
+      for (const auto &[index2, orientation] : matches[i])
+        if (matched2[index2] == false)
+          {
+            const PeriodicFacePair<CellIterator> matched_face = {
+              {faces1[i].first, faces2[index2].first},
+              {faces1[i].second, faces2[index2].second},
+              orientation,
+              matrix};
+            matched_pairs.push_back(matched_face);
+            pairs2.erase(faces2[index2]);
+            matched2[index2] = true;
+            ++n_matches;
+            break;
           }
-      }
 
     // Assure that all faces are matched if
     // parallel::fullydistributed::Triangulation is not used. This is related to
@@ -15,6 +15,8 @@
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/floating_point_comparator.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/grid/grid_tools_geometry.h>
@@ -1874,56 +1876,329 @@ namespace GridTools
     std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
   vertex_to_cell_map(const Triangulation<dim, spacedim> &triangulation)
   {
-    std::vector<
-      std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
-      vertex_to_cell_map(triangulation.n_vertices());
-    typename Triangulation<dim, spacedim>::active_cell_iterator
-      cell = triangulation.begin_active(),
-      endc = triangulation.end();
-    for (; cell != endc; ++cell)
-      for (const unsigned int i : cell->vertex_indices())
-        vertex_to_cell_map[cell->vertex_index(i)].insert(cell);
+    return VertexToCellMap<dim, spacedim>(triangulation).get_vector_of_sets();
+  }
+
+
+
+  template <int dim, int spacedim>
+  VertexToCellMap<dim, spacedim>::VertexToCellMap(
+    const Triangulation<dim, spacedim> &triangulation)
+  {
+    reinit(triangulation);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Function>
+  void
+  VertexToCellMap<dim, spacedim>::for_each_adjacent_pair(
+    const active_cell_iterator &cell,
+    const bool                  has_hanging_nodes,
+    const Function             &function)
+  {
+    for (const unsigned int v : cell->vertex_indices())
+      function(cell->vertex_index(v), cell);
+
+    // if the mesh has hanging nodes, these are also the neighbors across
+    // faces and, in 3d, the cells that have a vertex in the middle of one of
+    // their edges
+    if (has_hanging_nodes)
+      {
+        for (const unsigned int f : cell->face_indices())
+          if ((cell->at_boundary(f) == false) &&
+              (cell->neighbor(f)->is_active()))
+            {
+              const active_cell_iterator neighbor = cell->neighbor(f);
+              for (unsigned int j = 0; j < cell->face(f)->n_vertices(); ++j)
+                function(cell->face(f)->vertex_index(j), neighbor);
+            }
+
+        // the only place where a vertex could have been hiding is on the
+        // mid-edge point of the edge we are looking at
+        if constexpr (dim == 3)
+          for (unsigned int l = 0; l < cell->n_lines(); ++l)
+            if (cell->line(l)->has_children())
+              function(cell->line(l)->child(0)->vertex_index(1), cell);
+      }
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  VertexToCellMap<dim, spacedim>::reinit(
+    const Triangulation<dim, spacedim> &tria)
+  {
+    triangulation = &tria;
+
+    std::vector<active_cell_iterator> cells;
+    cells.reserve(tria.n_active_cells());
+    for (const auto &cell : tria.active_cell_iterators())
+      cells.push_back(cell);
+    const unsigned int n_cells = cells.size();
 
     // Check if mesh has hanging nodes. Do this only locally to
     // prevent communication and possible deadlock.
-    if (triangulation.Triangulation<dim, spacedim>::has_hanging_nodes())
-      {
-        Assert(triangulation.all_reference_cells_are_hyper_cube(),
-               ExcNotImplemented());
+    const bool has_hanging_nodes =
+      tria.Triangulation<dim, spacedim>::has_hanging_nodes();
+    Assert(!has_hanging_nodes || tria.all_reference_cells_are_hyper_cube(),
+           ExcNotImplemented());
+
+    // first collect the pairs of vertices and adjacent cells seen from all
+    // cells in parallel: count them, and then write them to their place in
+    // one array
+    std::vector<std::size_t> cell_starts(n_cells + 1, 0);
+    parallel::apply_to_subranges(
+      0,
+      n_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            std::size_t n_pairs = 0;
+            for_each_adjacent_pair(cells[c],
+                                   has_hanging_nodes,
+                                   [&n_pairs](const unsigned int,
+                                              const active_cell_iterator &) {
+                                     ++n_pairs;
+                                   });
+            cell_starts[c + 1] = n_pairs;
+          }
+      },
+      256);
+    std::partial_sum(cell_starts.begin(),
+                     cell_starts.end(),
+                     cell_starts.begin());
+
+    std::vector<std::pair<unsigned int, std::pair<unsigned int, unsigned int>>>
+      pairs(cell_starts.back());
+    parallel::apply_to_subranges(
+      0,
+      n_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            std::size_t position = cell_starts[c];
+            for_each_adjacent_pair(
+              cells[c],
+              has_hanging_nodes,
+              [&](const unsigned int vertex, const active_cell_iterator &cell) {
+                pairs[position++] = {
+                  vertex,
+                  {static_cast<unsigned int>(cell->level()),
+                   static_cast<unsigned int>(cell->index())}};
+              });
+          }
+      },
+      256);
+
+    // then sort the pairs by vertex, and sort the cells of each vertex and
+    // remove duplicates in parallel
+    const unsigned int       n_vertices = tria.n_vertices();
+    std::vector<std::size_t> starts(n_vertices + 1, 0);
+    for (const auto &pair : pairs)
+      ++starts[pair.first + 1];
+    std::partial_sum(starts.begin(), starts.end(), starts.begin());
+
+    std::vector<std::pair<unsigned int, unsigned int>> sorted_cells(
+      pairs.size());
+    {
+      std::vector<std::size_t> next(starts.begin(), starts.end() - 1);
+      for (const auto &pair : pairs)
+        sorted_cells[next[pair.first]++] = pair.second;
+    }
 
-        // Take care of hanging nodes
-        cell = triangulation.begin_active();
-        for (; cell != endc; ++cell)
+    std::vector<unsigned int> row_lengths(n_vertices);
+    parallel::apply_to_subranges(
+      0,
+      n_vertices,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int v = begin; v < end; ++v)
           {
-            for (const unsigned int i : cell->face_indices())
-              {
-                if ((cell->at_boundary(i) == false) &&
-                    (cell->neighbor(i)->is_active()))
-                  {
-                    typename Triangulation<dim, spacedim>::active_cell_iterator
-                      adjacent_cell = cell->neighbor(i);
-                    for (unsigned int j = 0; j < cell->face(i)->n_vertices();
-                         ++j)
-                      vertex_to_cell_map[cell->face(i)->vertex_index(j)].insert(
-                        adjacent_cell);
-                  }
-              }
+            const auto first = sorted_cells.begin() + starts[v];
+            const auto last  = sorted_cells.begin() + starts[v + 1];
+            std::sort(first, last);
+            row_lengths[v] = std::unique(first, last) - first;
+          }
+      },
+      1024);
+
+    // finally compress the rows
+    row_starts.resize(n_vertices + 1);
+    row_starts[0] = 0;
+    for (unsigned int v = 0; v < n_vertices; ++v)
+      row_starts[v + 1] = row_starts[v] + row_lengths[v];
+
+    adjacent_cells.resize(row_starts.back());
+    for (unsigned int v = 0; v < n_vertices; ++v)
+      std::copy(sorted_cells.begin() + starts[v],
+                sorted_cells.begin() + starts[v] + row_lengths[v],
+                adjacent_cells.begin() + row_starts[v]);
+  }
 
-            // in 3d also loop over the edges
-            if (dim == 3)
+
+
+  template <int dim, int spacedim>
+  void
+  VertexToCellMap<dim, spacedim>::update(
+    const std::vector<unsigned int>         &vertices,
+    const std::vector<active_cell_iterator> &new_cells)
+  {
+    Assert(triangulation != nullptr, ExcNotInitialized());
+    const Triangulation<dim, spacedim> &tria = *triangulation;
+
+    const unsigned int        n_new_vertices = tria.n_vertices();
+    std::vector<unsigned int> new_row_of_vertex(n_new_vertices,
+                                                numbers::invalid_unsigned_int);
+    for (unsigned int i = 0; i < vertices.size(); ++i)
+      {
+        AssertIndexRange(vertices[i], n_new_vertices);
+        new_row_of_vertex[vertices[i]] = i;
+      }
+
+    // every cell that is adjacent to one of the vertices is either a new
+    // cell or was previously listed for one of the vertices. the latter
+    // may not exist anymore, so check them via their level and index
+    std::vector<active_cell_iterator> candidate_cells = new_cells;
+    for (const unsigned int vertex : vertices)
+      if (vertex < n_vertices())
+        for (std::size_t i = row_starts[vertex]; i < row_starts[vertex + 1];
+             ++i)
+          {
+            const auto &[level, index] = adjacent_cells[i];
+            if (level < tria.n_levels() && index < tria.n_raw_cells(level))
               {
-                for (unsigned int i = 0; i < cell->n_lines(); ++i)
-                  if (cell->line(i)->has_children())
-                    // the only place where this vertex could have been
-                    // hiding is on the mid-edge point of the edge we
-                    // are looking at
-                    vertex_to_cell_map[cell->line(i)->child(0)->vertex_index(1)]
-                      .insert(cell);
+                const TriaRawIterator<CellAccessor<dim, spacedim>> raw_cell(
+                  &tria, level, index);
+                if (raw_cell->used() && raw_cell->is_active())
+                  candidate_cells.emplace_back(raw_cell);
               }
           }
+    std::sort(candidate_cells.begin(), candidate_cells.end());
+    candidate_cells.erase(std::unique(candidate_cells.begin(),
+                                      candidate_cells.end()),
+                          candidate_cells.end());
+
+    const bool has_hanging_nodes =
+      tria.Triangulation<dim, spacedim>::has_hanging_nodes();
+    Assert(!has_hanging_nodes || tria.all_reference_cells_are_hyper_cube(),
+           ExcNotImplemented());
+
+    std::vector<std::vector<std::pair<unsigned int, unsigned int>>> new_rows(
+      vertices.size());
+    for (const auto &cell : candidate_cells)
+      for_each_adjacent_pair(
+        cell,
+        has_hanging_nodes,
+        [&](const unsigned int          vertex,
+            const active_cell_iterator &adjacent_cell) {
+          if (new_row_of_vertex[vertex] != numbers::invalid_unsigned_int)
+            new_rows[new_row_of_vertex[vertex]].emplace_back(
+              adjacent_cell->level(), adjacent_cell->index());
+        });
+    for (auto &row : new_rows)
+      {
+        std::sort(row.begin(), row.end());
+        row.erase(std::unique(row.begin(), row.end()), row.end());
       }
 
-    return vertex_to_cell_map;
+    // now merge the new rows with the old ones of all other vertices
+    std::vector<std::size_t> new_row_starts(n_new_vertices + 1, 0);
+    for (unsigned int v = 0; v < n_new_vertices; ++v)
+      new_row_starts[v + 1] =
+        new_row_starts[v] +
+        (new_row_of_vertex[v] != numbers::invalid_unsigned_int ?
+           new_rows[new_row_of_vertex[v]].size() :
+           n_adjacent_cells(v));
+
+    std::vector<std::pair<unsigned int, unsigned int>> new_adjacent_cells(
+      new_row_starts.back());
+    for (unsigned int v = 0; v < n_new_vertices; ++v)
+      if (new_row_of_vertex[v] != numbers::invalid_unsigned_int)
+        std::copy(new_rows[new_row_of_vertex[v]].begin(),
+                  new_rows[new_row_of_vertex[v]].end(),
+                  new_adjacent_cells.begin() + new_row_starts[v]);
+      else if (v < n_vertices())
+        std::copy(adjacent_cells.begin() + row_starts[v],
+                  adjacent_cells.begin() + row_starts[v + 1],
+                  new_adjacent_cells.begin() + new_row_starts[v]);
+
+    row_starts.swap(new_row_starts);
+    adjacent_cells.swap(new_adjacent_cells);
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  VertexToCellMap<dim, spacedim>::n_vertices() const
+  {
+    return row_starts.empty() ? 0 : row_starts.size() - 1;
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  VertexToCellMap<dim, spacedim>::n_adjacent_cells(
+    const unsigned int vertex) const
+  {
+    if (vertex >= n_vertices())
+      return 0;
+    return row_starts[vertex + 1] - row_starts[vertex];
+  }
+
+
+
+  template <int dim, int spacedim>
+  typename VertexToCellMap<dim, spacedim>::active_cell_iterator
+  VertexToCellMap<dim, spacedim>::get_adjacent_cell(
+    const unsigned int vertex,
+    const unsigned int i) const
+  {
+    AssertIndexRange(i, n_adjacent_cells(vertex));
+    const auto &cell = adjacent_cells[row_starts[vertex] + i];
+    return active_cell_iterator(&*triangulation, cell.first, cell.second);
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<typename VertexToCellMap<dim, spacedim>::active_cell_iterator>
+  VertexToCellMap<dim, spacedim>::get_adjacent_cells(
+    const unsigned int vertex) const
+  {
+    std::vector<active_cell_iterator> cells;
+    cells.reserve(n_adjacent_cells(vertex));
+    for (unsigned int i = 0; i < n_adjacent_cells(vertex); ++i)
+      cells.push_back(get_adjacent_cell(vertex, i));
+    return cells;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<
+    std::set<typename VertexToCellMap<dim, spacedim>::active_cell_iterator>>
+  VertexToCellMap<dim, spacedim>::get_vector_of_sets() const
+  {
+    // the cells of each vertex are already sorted, so insert them at the end
+    std::vector<std::set<active_cell_iterator>> sets(n_vertices());
+    for (unsigned int v = 0; v < n_vertices(); ++v)
+      for (unsigned int i = 0; i < n_adjacent_cells(v); ++i)
+        sets[v].insert(sets[v].end(), get_adjacent_cell(v, i));
+    return sets;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::size_t
+  VertexToCellMap<dim, spacedim>::memory_consumption() const
+  {
+    return MemoryConsumption::memory_consumption(row_starts) +
+           MemoryConsumption::memory_consumption(adjacent_cells);
   }
 
 
@@ -30,6 +30,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include <cmath>
+#include <functional>
 #include <limits>
 #include <memory>
 
@@ -1638,6 +1639,8 @@ TransfiniteInterpolationManifold<dim,
 {
   if (clear_signal.connected())
     clear_signal.disconnect();
+  if (mesh_movement_signal.connected())
+    mesh_movement_signal.disconnect();
 }
 
 
@@ -1665,7 +1668,14 @@ TransfiniteInterpolationManifold<dim, spacedim>::initialize(
   clear_signal = triangulation.signals.clear.connect([&]() -> void {
     this->triangulation = nullptr;
     this->level_coarse  = -1;
+    pull_back_cache.clear();
   });
+  // Pull-backs computed for the old vertex positions are no longer valid
+  // once the mesh has been moved:
+  mesh_movement_signal.disconnect();
+  mesh_movement_signal = triangulation.signals.mesh_movement.connect(
+    [&]() -> void { pull_back_cache.clear(); });
+  pull_back_cache.clear();
   level_coarse = triangulation.last()->level();
   coarse_cell_is_flat.resize(triangulation.n_cells(level_coarse), false);
   quadratic_approximation.clear();
@@ -2068,6 +2078,20 @@ TransfiniteInterpolationManifold<dim, spacedim>::push_forward_gradient(
 
 
 
+template <int dim, int spacedim>
+std::size_t
+TransfiniteInterpolationManifold<dim, spacedim>::PullBackCacheHash::operator()(
+  const std::pair<unsigned int, Point<spacedim>> &key) const
+{
+  std::size_t hash = std::hash<unsigned int>()(key.first);
+  for (unsigned int d = 0; d < spacedim; ++d)
+    hash ^= std::hash<double>()(key.second[d]) + 0x9e3779b97f4a7c15ULL +
+            (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+
+
 template <int dim, int spacedim>
 Point<dim>
 TransfiniteInterpolationManifold<dim, spacedim>::pull_back(
@@ -2432,9 +2456,25 @@ TransfiniteInterpolationManifold<dim, spacedim>::compute_chart_points(
 
 
 
+  // Pull-backs computed earlier, by this call or a previous one, can be
+  // reused directly. Since the cache is only used from the current thread,
+  // we can keep a reference to it.
+  auto &cache = pull_back_cache.get();
+  if (cache.size() > 100000)
+    cache.clear();
+
   auto compute_chart_point =
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
         const unsigned int point_index) {
+      const std::pair<unsigned int, Point<spacedim>> key(
+        cell->index(), surrounding_points[point_index]);
+      const auto cached = cache.find(key);
+      if (cached != cache.end())
+        {
+          chart_points[point_index] = cached->second;
+          return;
+        }
+
       Point<dim> guess;
       // an optimization: keep track of whether or not we used the quadratic
       // approximation so that we don't call pull_back with the same
@@ -2498,6 +2538,10 @@ TransfiniteInterpolationManifold<dim, spacedim>::compute_chart_points(
           chart_points[point_index] =
             pull_back(cell, surrounding_points[point_index], guess);
         }
+
+      if (chart_points[point_index][0] !=
+          internal::invalid_pull_back_coordinate)
+        cache.emplace(key, chart_points[point_index]);
     };
 
   // check whether all points are inside the unit cell of the current chart
@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -138,6 +139,23 @@ namespace internal
   {}
 
 
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  CellAttachedDataSerializer<dim, spacedim>::~CellAttachedDataSerializer()
+  {
+    // Completing the write operations here would hide a collective operation
+    // in a destructor, and we could not report its errors. So require that
+    // this has been done explicitly.
+    AssertNothrow(pending_save == nullptr,
+                  ExcMessage(
+                    "The data of an asynchronous save operation has not "
+                    "been written completely yet. You need to call "
+                    "Triangulation::wait_for_save() before the "
+                    "triangulation is destroyed."));
+  }
+
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   void CellAttachedDataSerializer<dim, spacedim>::pack_data(
@@ -673,11 +691,33 @@ namespace internal
     const unsigned int global_first_cell,
     const unsigned int global_num_cells,
     const std::string &file_basename,
-    const MPI_Comm    &mpi_communicator) const
+    const MPI_Comm    &mpi_communicator,
+    const bool         asynchronous)
   {
     Assert(sizes_fixed_cumulative.size() > 0,
            ExcMessage("No data has been packed!"));
 
+    // A previous asynchronous save might still write into files of the same
+    // name, so let it finish first.
+    wait_for_pending_save();
+
+    // If the data is written asynchronously, move the buffers to a place
+    // where they survive a call to clear() and write from there.
+    if (asynchronous)
+      {
+        pending_save = std::make_unique<PendingSave>();
+        pending_save->sizes_fixed_cumulative = sizes_fixed_cumulative;
+        pending_save->data_fixed             = std::move(src_data_fixed);
+        pending_save->sizes_variable         = std::move(src_sizes_variable);
+        pending_save->data_variable          = std::move(src_data_variable);
+      }
+    const std::vector<char> &data_fixed =
+      (asynchronous ? pending_save->data_fixed : src_data_fixed);
+    const std::vector<int> &sizes_variable =
+      (asynchronous ? pending_save->sizes_variable : src_sizes_variable);
+    const std::vector<char> &data_variable =
+      (asynchronous ? pending_save->data_variable : src_data_variable);
+
 #ifdef DEAL_II_WITH_MPI
     // Large fractions of this function have been copied from
     // DataOutInterface::write_vtu_in_parallel.
@@ -692,6 +732,55 @@ namespace internal
       {
         const unsigned int bytes_per_cell = sizes_fixed_cumulative.back();
 
+        // Write the given bytes at the given position, or only post the
+        // write operations if the data is written asynchronously. The
+        // non-blocking MPI I/O functions only accept int counts, so large
+        // buffers are split into several requests.
+        const auto write_at = [&](MPI_File          fh,
+                                  const MPI_Offset  offset,
+                                  const char       *data,
+                                  const std::size_t n_bytes) {
+          if (asynchronous == false)
+            {
+              const int ierr =
+                Utilities::MPI::LargeCount::File_write_at_c(fh,
+                                                            offset,
+                                                            data,
+                                                            n_bytes,
+                                                            MPI_BYTE,
+                                                            MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+              return;
+            }
+
+          const std::size_t max_chunk_size = std::numeric_limits<int>::max();
+          for (std::size_t start = 0; start < n_bytes; start += max_chunk_size)
+            {
+              MPI_Request request;
+              const int   ierr = MPI_File_iwrite_at(
+                fh,
+                offset + static_cast<MPI_Offset>(start),
+                data + start,
+                static_cast<int>(std::min(max_chunk_size, n_bytes - start)),
+                MPI_BYTE,
+                &request);
+              AssertThrowMPI(ierr);
+              pending_save->requests.push_back(request);
+            }
+        };
+
+        // Close the file, or keep it open until all write operations have
+        // finished.
+        const auto finish_file = [&](MPI_File &fh) {
+          if (asynchronous)
+            pending_save->files.push_back(fh);
+          else
+            {
+              const int ierr = MPI_File_close(&fh);
+              AssertThrowMPI(ierr);
+            }
+        };
+
         //
         // ---------- Fixed size data ----------
         //
@@ -747,17 +836,12 @@ namespace internal
             size_header +
             static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
 
-          ierr =
-            Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                        my_global_file_position,
-                                                        src_data_fixed.data(),
-                                                        src_data_fixed.size(),
-                                                        MPI_BYTE,
-                                                        MPI_STATUS_IGNORE);
-          AssertThrowMPI(ierr);
+          write_at(fh,
+                   my_global_file_position,
+                   data_fixed.data(),
+                   data_fixed.size());
 
-          ierr = MPI_File_close(&fh);
-          AssertThrowMPI(ierr);
+          finish_file(fh);
         }
 
 
@@ -799,25 +883,21 @@ namespace internal
 
               // It is very unlikely that a single process has more than
               // 2 billion cells, but we might as well check.
-              AssertThrow(src_sizes_variable.size() <
+              AssertThrow(sizes_variable.size() <
                             static_cast<std::size_t>(
                               std::numeric_limits<int>::max()),
                           ExcNotImplemented());
 
-              ierr = Utilities::MPI::LargeCount::File_write_at_c(
-                fh,
-                my_global_file_position,
-                src_sizes_variable.data(),
-                src_sizes_variable.size(),
-                MPI_INT,
-                MPI_STATUS_IGNORE);
-              AssertThrowMPI(ierr);
+              write_at(fh,
+                       my_global_file_position,
+                       reinterpret_cast<const char *>(sizes_variable.data()),
+                       sizes_variable.size() * sizeof(int));
             }
 
             // Gather size of data in bytes we want to store from this
             // processor and compute the prefix sum. We do this in 64 bit
             // to avoid overflow for files larger than 4GB:
-            const std::uint64_t size_on_proc = src_data_variable.size();
+            const std::uint64_t size_on_proc = data_variable.size();
             std::uint64_t       prefix_sum   = 0;
             ierr                             = MPI_Exscan(&size_on_proc,
                               &prefix_sum,
@@ -832,18 +912,12 @@ namespace internal
               prefix_sum;
 
             // Write data consecutively into file.
-            ierr = Utilities::MPI::LargeCount::File_write_at_c(
-              fh,
-              my_global_file_position,
-              src_data_variable.data(),
-              src_data_variable.size(),
-              MPI_BYTE,
-              MPI_STATUS_IGNORE);
-            AssertThrowMPI(ierr);
-
+            write_at(fh,
+                     my_global_file_position,
+                     data_variable.data(),
+                     data_variable.size());
 
-            ierr = MPI_File_close(&fh);
-            AssertThrowMPI(ierr);
+            finish_file(fh);
           }
       } // if (mpisize > 1)
     else
@@ -853,51 +927,101 @@ namespace internal
         (void)global_num_cells;
         (void)mpi_communicator;
 
-        //
-        // ---------- Fixed size data ----------
-        //
-        {
-          const std::string fname_fixed =
-            std::string(file_basename) + "_fixed.data";
-
-          std::ofstream file(fname_fixed, std::ios::binary | std::ios::out);
-          AssertThrow(file.fail() == false, ExcIO());
-
-          // Write header data.
-          file.write(reinterpret_cast<const char *>(
-                       sizes_fixed_cumulative.data()),
-                     sizes_fixed_cumulative.size() * sizeof(unsigned int));
-
-          // Write packed data.
-          file.write(reinterpret_cast<const char *>(src_data_fixed.data()),
-                     src_data_fixed.size() * sizeof(char));
-        }
-
-        //
-        // ---------- Variable size data ----------
-        //
-        if (variable_size_data_stored)
+        const auto write_files = [file_basename,
+                                  variable_size_data_stored =
+                                    variable_size_data_stored,
+                                  &header_fixed =
+                                    (asynchronous ?
+                                       pending_save->sizes_fixed_cumulative :
+                                       sizes_fixed_cumulative),
+                                  &data_fixed,
+                                  &sizes_variable,
+                                  &data_variable]() {
+          //
+          // ---------- Fixed size data ----------
+          //
           {
-            const std::string fname_variable =
-              std::string(file_basename) + "_variable.data";
+            const std::string fname_fixed =
+              std::string(file_basename) + "_fixed.data";
 
-            std::ofstream file(fname_variable,
-                               std::ios::binary | std::ios::out);
+            std::ofstream file(fname_fixed, std::ios::binary | std::ios::out);
             AssertThrow(file.fail() == false, ExcIO());
 
             // Write header data.
-            file.write(reinterpret_cast<const char *>(
-                         src_sizes_variable.data()),
-                       src_sizes_variable.size() * sizeof(int));
+            file.write(reinterpret_cast<const char *>(header_fixed.data()),
+                       header_fixed.size() * sizeof(unsigned int));
 
             // Write packed data.
-            file.write(reinterpret_cast<const char *>(src_data_variable.data()),
-                       src_data_variable.size() * sizeof(char));
+            file.write(reinterpret_cast<const char *>(data_fixed.data()),
+                       data_fixed.size() * sizeof(char));
           }
+
+          //
+          // ---------- Variable size data ----------
+          //
+          if (variable_size_data_stored)
+            {
+              const std::string fname_variable =
+                std::string(file_basename) + "_variable.data";
+
+              std::ofstream file(fname_variable,
+                                 std::ios::binary | std::ios::out);
+              AssertThrow(file.fail() == false, ExcIO());
+
+              // Write header data.
+              file.write(reinterpret_cast<const char *>(sizes_variable.data()),
+                         sizes_variable.size() * sizeof(int));
+
+              // Write packed data.
+              file.write(reinterpret_cast<const char *>(data_variable.data()),
+                         data_variable.size() * sizeof(char));
+            }
+        };
+
+        // Without MPI I/O, asynchronous output is done by a separate task
+        // that works on the buffers stored in pending_save.
+        if (asynchronous)
+          pending_save->task = Threads::new_task(write_files);
+        else
+          write_files();
+      }
+  }
+
+
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void CellAttachedDataSerializer<dim, spacedim>::wait_for_pending_save()
+  {
+    if (pending_save == nullptr)
+      return;
+
+    // Release the pending state in any case, even if one of the operations
+    // below throws.
+    const std::unique_ptr<PendingSave> pending = std::move(pending_save);
+
+    if (pending->task.joinable())
+      pending->task.join();
+
+#ifdef DEAL_II_WITH_MPI
+    if (pending->requests.size() > 0)
+      {
+        const int ierr = MPI_Waitall(pending->requests.size(),
+                                     pending->requests.data(),
+                                     MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+
+    for (MPI_File &fh : pending->files)
+      {
+        const int ierr = MPI_File_close(&fh);
+        AssertThrowMPI(ierr);
       }
+#endif
   }
 
 
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   void CellAttachedDataSerializer<dim, spacedim>::load(
@@ -1641,6 +1765,46 @@ namespace
   }
 
 
+
+  /**
+   * Return the locations of the vertices that refinement places at the
+   * centers of all objects in the range [begin, end) for which
+   * @p needs_new_vertex returns true, in the order in which these objects
+   * appear in the range. The locations are computed by
+   * TriaAccessor::center() with the given value of @p use_interpolation.
+   *
+   * Evaluating the manifolds is typically the most expensive part of
+   * refining a mesh, and it only reads from the triangulation. We can
+   * therefore do it in parallel before the (sequential) loops that create
+   * the new objects, which then only need to copy the precomputed points.
+   */
+  template <typename IteratorType, typename Predicate>
+  std::vector<Point<IteratorType::AccessorType::space_dimension>>
+  compute_new_vertex_locations(const IteratorType &begin,
+                               const IteratorType &end,
+                               const Predicate    &needs_new_vertex,
+                               const bool          use_interpolation)
+  {
+    std::vector<IteratorType> objects;
+    for (IteratorType object = begin; object != end; ++object)
+      if (needs_new_vertex(object))
+        objects.push_back(object);
+
+    std::vector<Point<IteratorType::AccessorType::space_dimension>> locations(
+      objects.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(objects.size()),
+      [&](const unsigned int range_begin, const unsigned int range_end) {
+        for (unsigned int i = range_begin; i < range_end; ++i)
+          locations[i] = objects[i]->center(true, use_interpolation);
+      },
+      128);
+
+    return locations;
+  }
+
+
   template <int dim, int spacedim>
   void
   update_periodic_face_map_recursively(
@@ -5061,6 +5225,14 @@ namespace internal
           typename Triangulation<dim, spacedim>::raw_line_iterator
             next_unused_line = triangulation.begin_raw_line();
 
+          const std::vector<Point<spacedim>> new_vertex_locations =
+            compute_new_vertex_locations(
+              line,
+              endl,
+              [](const auto &line) { return line->user_flag_set(); },
+              false);
+          unsigned int n_used_vertex_locations = 0;
+
           for (; line != endl; ++line)
             if (line->user_flag_set())
               {
@@ -5076,7 +5248,8 @@ namespace internal
                          "enough."));
                 triangulation.vertices_used[next_unused_vertex] = true;
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+                triangulation.vertices[next_unused_vertex] =
+                  new_vertex_locations[n_used_vertex_locations++];
 
                 [[maybe_unused]] bool pair_found = false;
                 for (; next_unused_line != endl; ++next_unused_line)
@@ -5126,11 +5299,25 @@ namespace internal
         typename Triangulation<dim, spacedim>::raw_line_iterator
           next_unused_line = triangulation.begin_raw_line();
 
-        const auto create_children = [](auto         &triangulation,
-                                        unsigned int &next_unused_vertex,
-                                        auto         &next_unused_line,
-                                        auto         &next_unused_cell,
-                                        const auto   &cell) {
+        // only quadrilaterals get a new vertex in their center
+        const std::vector<Point<spacedim>> new_vertex_locations =
+          compute_new_vertex_locations(
+            triangulation.begin_active(),
+            triangulation.end_active(triangulation.levels.size() - 1),
+            [](const auto &cell) {
+              return cell->refine_flag_set() &&
+                     cell->reference_cell() == ReferenceCells::Quadrilateral;
+            },
+            true);
+        unsigned int n_used_vertex_locations = 0;
+
+        const auto create_children = [&new_vertex_locations,
+                                      &n_used_vertex_locations](
+                                       auto         &triangulation,
+                                       unsigned int &next_unused_vertex,
+                                       auto         &next_unused_line,
+                                       auto         &next_unused_cell,
+                                       const auto   &cell) {
           const auto ref_case = cell->refine_flag_set();
           cell->clear_refine_flag();
 
@@ -5168,7 +5355,7 @@ namespace internal
               new_vertices[8] = next_unused_vertex;
 
               triangulation.vertices[next_unused_vertex] =
-                cell->center(true, true);
+                new_vertex_locations[n_used_vertex_locations++];
             }
 
           std::array<typename Triangulation<dim, spacedim>::raw_line_iterator,
@@ -5823,6 +6010,14 @@ namespace internal
           typename Triangulation<dim, spacedim>::raw_line_iterator
             next_unused_line = triangulation.begin_raw_line();
 
+          const std::vector<Point<spacedim>> new_vertex_locations =
+            compute_new_vertex_locations(
+              line,
+              endl,
+              [](const auto &line) { return line->user_flag_set(); },
+              false);
+          unsigned int n_used_vertex_locations = 0;
+
           for (; line != endl; ++line)
             if (line->user_flag_set())
               {
@@ -5838,7 +6033,8 @@ namespace internal
                     "Internal error: During refinement, the triangulation wants to access an element of the 'vertices' array but it turns out that the array is not large enough."));
                 triangulation.vertices_used[next_unused_vertex] = true;
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+                triangulation.vertices[next_unused_vertex] =
+                  new_vertex_locations[n_used_vertex_locations++];
 
                 // now that we created the right point, make up the
                 // two child lines.  To this end, find a pair of
@@ -6180,6 +6376,14 @@ namespace internal
             endl = triangulation.end_line();
           raw_line_iterator next_unused_line = triangulation.begin_raw_line();
 
+          const std::vector<Point<spacedim>> new_vertex_locations =
+            compute_new_vertex_locations(
+              line,
+              endl,
+              [](const auto &line) { return line->user_flag_set(); },
+              false);
+          unsigned int n_used_vertex_locations = 0;
+
           for (; line != endl; ++line)
             {
               if (line->user_flag_set() == false)
@@ -6205,7 +6409,8 @@ namespace internal
               current_vertex =
                 get_next_unused_vertex(current_vertex,
                                        triangulation.vertices_used);
-              triangulation.vertices[current_vertex] = line->center(true);
+              triangulation.vertices[current_vertex] =
+                new_vertex_locations[n_used_vertex_locations++];
 
               children[0]->set_bounding_object_indices(
                 {line->vertex_index(0), current_vertex});
@@ -6234,6 +6439,18 @@ namespace internal
             face = triangulation.begin_face(),
             endf = triangulation.end_face();
 
+          // only quadrilaterals get a new vertex in their center
+          const std::vector<Point<spacedim>> new_vertex_locations =
+            compute_new_vertex_locations(
+              face,
+              endf,
+              [](const auto &face) {
+                return face->user_flag_set() &&
+                       face->reference_cell() == ReferenceCells::Quadrilateral;
+              },
+              true);
+          unsigned int n_used_vertex_locations = 0;
+
           for (; face != endf; ++face)
             {
               if (face->user_flag_set() == false)
@@ -6317,7 +6534,7 @@ namespace internal
                   vertex_indices[k++] = current_vertex;
 
                   triangulation.vertices[current_vertex] =
-                    face->center(true, true);
+                    new_vertex_locations[n_used_vertex_locations++];
                 }
 
               // 4) set new lines on these faces and their properties
@@ -6500,6 +6717,19 @@ namespace internal
         typename Triangulation<3, spacedim>::DistortedCellList
           cells_with_distorted_children;
 
+        // only hexahedra get a new vertex in their center
+        const std::vector<Point<spacedim>> new_vertex_locations =
+          compute_new_vertex_locations(
+            triangulation.begin_active(),
+            triangulation.end_active(triangulation.levels.size() - 1),
+            [](const auto &cell) {
+              return cell->refine_flag_set() !=
+                       RefinementCase<dim>::no_refinement &&
+                     cell->reference_cell() == ReferenceCells::Hexahedron;
+            },
+            true);
+        unsigned int n_used_vertex_locations = 0;
+
         typename Triangulation<dim, spacedim>::active_cell_iterator cell =
           triangulation.begin_active(0);
         for (unsigned int level = 0; level != triangulation.levels.size() - 1;
@@ -6685,7 +6915,7 @@ namespace internal
                         vertex_indices[k++] = current_vertex;
 
                         triangulation.vertices[current_vertex] =
-                          cell->center(true, true);
+                          new_vertex_locations[n_used_vertex_locations++];
                       }
                   }
 
@@ -7471,6 +7701,14 @@ namespace internal
           typename Triangulation<dim, spacedim>::raw_line_iterator
             next_unused_line = triangulation.begin_raw_line();
 
+          const std::vector<Point<spacedim>> new_vertex_locations =
+            compute_new_vertex_locations(
+              line,
+              endl,
+              [](const auto &line) { return line->user_flag_set(); },
+              false);
+          unsigned int n_used_vertex_locations = 0;
+
           for (; line != endl; ++line)
             if (line->user_flag_set())
               {
@@ -7486,7 +7724,8 @@ namespace internal
                     "Internal error: During refinement, the triangulation wants to access an element of the 'vertices' array but it turns out that the array is not large enough."));
                 triangulation.vertices_used[next_unused_vertex] = true;
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+                triangulation.vertices[next_unused_vertex] =
+                  new_vertex_locations[n_used_vertex_locations++];
 
                 // now that we created the right point, make up the
                 // two child lines (++ takes care of the end of the
@@ -11754,6 +11993,40 @@ namespace internal
                           }
                       }
                   }
+
+                // a refined triangular face has three lines in its
+                // interior (the ones of its central child) that are not
+                // children of any line of the present tetrahedron, but
+                // that become lines of its children. if any of them is
+                // refined and will stay so or will be refined, then we
+                // need to refine this cell as well, since its children
+                // would otherwise later end up with lines that are
+                // refined more than once
+                if ((cell->reference_cell() == ReferenceCells::Tetrahedron) &&
+                    (cell->refine_flag_set() ==
+                     RefinementCase<dim>::no_refinement))
+                  for (const unsigned int f : cell->face_indices())
+                    if (cell->face(f)->has_children() &&
+                        (cell->face(f)->child(3)->line(0)->user_flag_set() ||
+                         cell->face(f)->child(3)->line(1)->user_flag_set() ||
+                         cell->face(f)->child(3)->line(2)->user_flag_set()))
+                      {
+                        cell->clear_coarsen_flag();
+                        cell->set_refine_flag();
+
+                        for (unsigned int k = 0; k < cell->n_lines(); ++k)
+                          {
+                            const auto line =
+                              raw_line_iterator(&triangulation,
+                                                0,
+                                                line_indices[k]);
+                            if (!line->has_children())
+                              line->set_user_flag();
+                          }
+
+                        mesh_changed = true;
+                        break;
+                      }
               }
 
 
@@ -12863,6 +13136,206 @@ void Triangulation<dim, spacedim>::flip_all_direction_flags()
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void Triangulation<dim, spacedim>::renumber_cells_along_space_filling_curve()
+{
+  const bool is_distributed =
+    dynamic_cast<const parallel::DistributedTriangulationBase<dim, spacedim> *>(
+      this) != nullptr;
+  AssertThrow(
+    is_distributed == false,
+    ExcMessage("The cells of distributed triangulations are already ordered "
+               "along a space-filling curve and can not be renumbered."));
+
+  if (levels.empty())
+    return;
+
+  // first determine the new order of the cells on all levels, given as the
+  // old index for each new index. the coarse cells are sorted along a
+  // Hilbert curve through their centers
+  std::vector<std::vector<unsigned int>> new_to_old(levels.size());
+  {
+    std::vector<Point<spacedim>> centers;
+    std::vector<unsigned int>    cell_indices;
+    for (const auto &cell : cell_iterators_on_level(0))
+      {
+        centers.push_back(cell->center());
+        cell_indices.push_back(cell->index());
+      }
+
+    const std::vector<std::array<std::uint64_t, spacedim>> hilbert_indices =
+      Utilities::inverse_Hilbert_space_filling_curve(centers);
+
+    std::vector<unsigned int> order(centers.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](const unsigned int a, const unsigned int b) {
+                       return hilbert_indices[a] < hilbert_indices[b];
+                     });
+
+    new_to_old[0].reserve(levels[0]->refine_flags.size());
+    for (const unsigned int i : order)
+      new_to_old[0].push_back(cell_indices[i]);
+  }
+
+  // on the finer levels, store the children of each cell consecutively, in
+  // the new order of their parents. since each parent has an even number of
+  // children, the pairs of children stay aligned with the entries of
+  // TriaLevel::parents
+  for (unsigned int level = 1; level < levels.size(); ++level)
+    {
+      new_to_old[level].reserve(levels[level]->refine_flags.size());
+      for (const unsigned int parent_index : new_to_old[level - 1])
+        {
+          const cell_iterator parent(this, level - 1, parent_index);
+          if (parent->has_children())
+            for (unsigned int c = 0; c < parent->n_children(); ++c)
+              new_to_old[level].push_back(parent->child_index(c));
+        }
+    }
+
+  // unused cells go to the end of each level. check whether anything
+  // changes at all while we are at it
+  std::vector<std::vector<unsigned int>> old_to_new(levels.size());
+  bool                                   is_identity = true;
+  for (unsigned int level = 0; level < levels.size(); ++level)
+    {
+      const unsigned int n_cells_on_level = levels[level]->refine_flags.size();
+      for (unsigned int i = 0; i < n_cells_on_level; ++i)
+        if (levels[level]->cells.used[i] == false)
+          new_to_old[level].push_back(i);
+      AssertDimension(new_to_old[level].size(), n_cells_on_level);
+
+      old_to_new[level].resize(n_cells_on_level);
+      for (unsigned int i = 0; i < n_cells_on_level; ++i)
+        {
+          old_to_new[level][new_to_old[level][i]] = i;
+          if (new_to_old[level][i] != i)
+            is_identity = false;
+        }
+    }
+
+  if (is_identity)
+    return;
+
+  // permute all arrays that store data per cell, possibly with several
+  // entries per cell
+  const auto permute = [](auto                            &values,
+                          const std::vector<unsigned int> &order) {
+    if (values.empty())
+      return;
+    const std::size_t n_entries = values.size() / order.size();
+    AssertDimension(values.size(), n_entries * order.size());
+    const auto old_values = values;
+    for (unsigned int i = 0; i < order.size(); ++i)
+      for (std::size_t j = 0; j < n_entries; ++j)
+        values[i * n_entries + j] = old_values[order[i] * n_entries + j];
+  };
+
+  for (unsigned int level = 0; level < levels.size(); ++level)
+    {
+      internal::TriangulationImplementation::TriaLevel &tria_level =
+        *levels[level];
+      const std::vector<unsigned int> &order = new_to_old[level];
+
+      permute(tria_level.refine_flags, order);
+      permute(tria_level.refine_choice, order);
+      permute(tria_level.coarsen_flags, order);
+      permute(tria_level.active_cell_indices, order);
+      permute(tria_level.global_active_cell_indices, order);
+      permute(tria_level.global_level_cell_indices, order);
+      permute(tria_level.neighbors, order);
+      permute(tria_level.subdomain_ids, order);
+      permute(tria_level.level_subdomain_ids, order);
+      permute(tria_level.direction_flags, order);
+      permute(tria_level.reference_cell, order);
+      permute(tria_level.cell_vertex_indices_cache, order);
+
+      if (tria_level.face_orientations.n_objects() > 0)
+        {
+          const unsigned int n_faces =
+            tria_level.face_orientations.n_objects() / order.size();
+          const auto old_orientations = tria_level.face_orientations;
+          for (unsigned int i = 0; i < order.size(); ++i)
+            for (unsigned int f = 0; f < n_faces; ++f)
+              tria_level.face_orientations.set_combined_orientation(
+                i * n_faces + f,
+                old_orientations.get_combined_orientation(order[i] * n_faces +
+                                                          f));
+        }
+
+      internal::TriangulationImplementation::TriaObjects &cells =
+        tria_level.cells;
+      permute(cells.cells, order);
+      permute(cells.children, order);
+      permute(cells.refinement_cases, order);
+      permute(cells.used, order);
+      permute(cells.user_flags, order);
+      permute(cells.boundary_or_material_id, order);
+      permute(cells.manifold_id, order);
+      permute(cells.user_data, order);
+      cells.next_free_single               = 0;
+      cells.next_free_pair                 = 0;
+      cells.reverse_order_next_free_single = false;
+
+      // then translate the indices of neighbors, children, and parents.
+      // entries of unused cells are reset
+      const unsigned int n_faces = tria_level.neighbors.size() / order.size();
+      const unsigned int n_pairs = cells.children.size() / order.size();
+      for (unsigned int i = 0; i < order.size(); ++i)
+        if (cells.used[i])
+          {
+            for (unsigned int f = 0; f < n_faces; ++f)
+              {
+                std::pair<int, int> &neighbor =
+                  tria_level.neighbors[i * n_faces + f];
+                if (neighbor.second >= 0)
+                  neighbor.second =
+                    old_to_new[neighbor.first][neighbor.second];
+              }
+            for (unsigned int c = 0; c < n_pairs; ++c)
+              if (cells.children[i * n_pairs + c] >= 0)
+                cells.children[i * n_pairs + c] =
+                  old_to_new[level + 1][cells.children[i * n_pairs + c]];
+          }
+        else
+          {
+            for (unsigned int f = 0; f < n_faces; ++f)
+              tria_level.neighbors[i * n_faces + f] = {-1, -1};
+            for (unsigned int c = 0; c < n_pairs; ++c)
+              cells.children[i * n_pairs + c] = -1;
+          }
+
+      if (level > 0)
+        {
+          const std::vector<int> old_parents = tria_level.parents;
+          for (unsigned int i = 0; i < tria_level.parents.size(); ++i)
+            tria_level.parents[i] =
+              (2 * i < order.size() && cells.used[2 * i] ?
+                 old_to_new[level - 1][old_parents[order[2 * i] / 2]] :
+                 -1);
+        }
+    }
+
+  // finally update the information that refers to cells by iterators or
+  // by their position in the ordering of cells
+  for (auto &face_pair : periodic_face_pairs_level_0)
+    for (cell_iterator &cell : face_pair.cell)
+      cell = cell_iterator(this, 0, old_to_new[0][cell->index()]);
+  if (periodic_face_pairs_level_0.empty() == false)
+    update_periodic_face_map();
+
+  reset_active_cell_indices();
+  reset_global_cell_indices();
+  update_cell_relations();
+
+  signals.create();
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::set_all_refine_flags()
@@ -13736,6 +14209,39 @@ void Triangulation<dim, spacedim>::save(const std::string &file_basename) const
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void Triangulation<dim, spacedim>::save_asynchronously(
+  const std::string &file_basename) const
+{
+  // let save() and the save() functions of derived classes pass the flag
+  // on to save_attached_data(), and reset it even if an exception is thrown
+  save_attached_data_asynchronously = true;
+  try
+    {
+      save(file_basename);
+    }
+  catch (...)
+    {
+      save_attached_data_asynchronously = false;
+      throw;
+    }
+  save_attached_data_asynchronously = false;
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void Triangulation<dim, spacedim>::wait_for_save() const
+{
+  // cast away constness
+  auto tria = const_cast<Triangulation<dim, spacedim> *>(this);
+  tria->data_serializer.wait_for_pending_save();
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::load(const std::string &file_basename)
@@ -16298,6 +16804,10 @@ void Triangulation<dim, spacedim>::save_attached_data(
 
   if (this->cell_attached_data.n_attached_data_sets > 0)
     {
+      // make sure the buffers of a previous asynchronous save are no
+      // longer in use
+      tria->data_serializer.wait_for_pending_save();
+
       // pack attached data first
       tria->data_serializer.pack_data(
         tria->local_cell_relations,
@@ -16309,9 +16819,11 @@ void Triangulation<dim, spacedim>::save_attached_data(
       tria->data_serializer.save(global_first_cell,
                                  global_num_cells,
                                  file_basename,
-                                 this->get_mpi_communicator());
+                                 this->get_mpi_communicator(),
+                                 save_attached_data_asynchronously);
 
-      // and release the memory afterwards
+      // and release the memory afterwards (the buffers of an asynchronous
+      // save have been moved out of the serializer)
       tria->data_serializer.clear();
     }
 
@@ -16335,6 +16847,9 @@ void Triangulation<dim, spacedim>::load_attached_data(
   const unsigned int n_attached_deserialize_fixed,
   const unsigned int n_attached_deserialize_variable)
 {
+  // we might read from files that are still being written to
+  this->data_serializer.wait_for_pending_save();
+
   // load saved data, if any was stored
   if (this->cell_attached_data.n_attached_deserialize > 0)
     {
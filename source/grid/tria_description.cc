@@ -15,7 +15,9 @@
 #include <deal.II/base/floating_point_comparator.h>
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/mpi_large_count.h>
 
 #include <deal.II/distributed/fully_distributed_tria.h>
 #include <deal.II/distributed/tria.h>
@@ -27,6 +29,14 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_description.h>
 
+#include <boost/serialization/utility.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -710,6 +720,165 @@ namespace TriangulationDescription
 
         return construction_data;
       }
+
+
+
+      /**
+       * Return the locations of the vertices with the given (sorted and
+       * unique) global indices, for vertices that are distributed among the
+       * processes of the communicator in contiguous chunks. The chunk of
+       * process p starts at global index vertex_offsets[p].
+       */
+      template <int spacedim>
+      std::vector<Point<spacedim>>
+      gather_distributed_vertices(
+        const std::vector<unsigned int>               &vertex_indices,
+        const std::vector<Point<spacedim>>            &local_vertices,
+        const std::vector<types::global_vertex_index> &vertex_offsets,
+        const MPI_Comm                                 comm)
+      {
+        const unsigned int my_rank =
+          dealii::Utilities::MPI::this_mpi_process(comm);
+
+        // ask the owners of the vertices for their locations
+        std::map<unsigned int, std::vector<unsigned int>> requests;
+        for (const unsigned int v : vertex_indices)
+          {
+            const unsigned int owner =
+              std::upper_bound(vertex_offsets.begin(),
+                               vertex_offsets.end(),
+                               v) -
+              vertex_offsets.begin() - 1;
+            requests[owner].push_back(v);
+          }
+
+        std::map<unsigned int, std::vector<Point<spacedim>>> answers;
+        for (const auto &[rank, indices] :
+             dealii::Utilities::MPI::some_to_some(comm, requests))
+          {
+            std::vector<Point<spacedim>> &points = answers[rank];
+            points.reserve(indices.size());
+            for (const unsigned int v : indices)
+              {
+                AssertIndexRange(v - vertex_offsets[my_rank],
+                                 local_vertices.size());
+                points.push_back(local_vertices[v - vertex_offsets[my_rank]]);
+              }
+          }
+
+        // since the vertex indices are sorted, the requests to the owners
+        // (sorted by rank) form consecutive parts of the list of vertices,
+        // and we only need to concatenate the answers
+        std::vector<Point<spacedim>> vertices;
+        vertices.reserve(vertex_indices.size());
+        for (const auto &[rank, points] :
+             dealii::Utilities::MPI::some_to_some(comm, answers))
+          {
+            (void)rank;
+            vertices.insert(vertices.end(), points.begin(), points.end());
+          }
+        AssertDimension(vertices.size(), vertex_indices.size());
+
+        return vertices;
+      }
+
+
+
+      /**
+       * Return the sorted list of the vertices of the given cells.
+       */
+      template <int dim>
+      std::vector<unsigned int>
+      collect_vertices(const std::vector<dealii::CellData<dim>> &cells)
+      {
+        std::vector<unsigned int> vertices;
+        for (const auto &cell : cells)
+          vertices.insert(vertices.end(),
+                          cell.vertices.begin(),
+                          cell.vertices.end());
+        std::sort(vertices.begin(), vertices.end());
+        vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                       vertices.end());
+        return vertices;
+      }
+
+
+
+      /**
+       * Look up the boundary and manifold ids of the lines or quads with the
+       * given (sorted and unique) keys, i.e., their sorted global vertex
+       * indices, among the lines or quads of the SubCellData objects that
+       * are distributed among the processes of the communicator. To this
+       * end, all entries are sent to the owner of their smallest vertex,
+       * which then answers the requests for them. The returned map only
+       * contains the requested objects for which an entry exists.
+       */
+      template <int structdim>
+      std::map<std::vector<unsigned int>,
+               std::pair<types::boundary_id, types::manifold_id>>
+      lookup_distributed_subcell_ids(
+        const std::vector<dealii::CellData<structdim>> &local_subcells,
+        const std::vector<std::vector<unsigned int>>   &requested_keys,
+        const std::vector<types::global_vertex_index>  &vertex_offsets,
+        const MPI_Comm                                  comm)
+      {
+        using Ids   = std::pair<types::boundary_id, types::manifold_id>;
+        using Entry = std::pair<std::vector<unsigned int>, Ids>;
+
+        const auto owner = [&](const std::vector<unsigned int> &key) {
+          return static_cast<unsigned int>(
+            std::upper_bound(vertex_offsets.begin(),
+                             vertex_offsets.end(),
+                             key.front()) -
+            vertex_offsets.begin() - 1);
+        };
+
+        // send the entries to the owners of their smallest vertex
+        std::map<unsigned int, std::vector<Entry>> entries_to_send;
+        for (const auto &subcell : local_subcells)
+          {
+            std::vector<unsigned int> key = subcell.vertices;
+            std::sort(key.begin(), key.end());
+            entries_to_send[owner(key)].emplace_back(
+              key, Ids(subcell.boundary_id, subcell.manifold_id));
+          }
+
+        std::map<std::vector<unsigned int>, Ids> directory;
+        for (auto &[rank, entries] :
+             dealii::Utilities::MPI::some_to_some(comm, entries_to_send))
+          {
+            (void)rank;
+            for (auto &[key, ids] : entries)
+              directory[std::move(key)] = ids;
+          }
+
+        // ask the owners for the ids of the requested objects
+        std::map<unsigned int, std::vector<std::vector<unsigned int>>>
+          requests;
+        for (const auto &key : requested_keys)
+          requests[owner(key)].push_back(key);
+
+        std::map<unsigned int, std::vector<Entry>> answers;
+        for (const auto &[rank, keys] :
+             dealii::Utilities::MPI::some_to_some(comm, requests))
+          for (const auto &key : keys)
+            {
+              const auto entry = directory.find(key);
+              if (entry != directory.end())
+                answers[rank].push_back(*entry);
+            }
+
+        std::map<std::vector<unsigned int>, Ids> result;
+        for (auto &[rank, entries] :
+             dealii::Utilities::MPI::some_to_some(comm, answers))
+          {
+            (void)rank;
+            for (auto &entry : entries)
+              result.insert(std::move(entry));
+          }
+
+        return result;
+      }
     } // namespace
 
 
@@ -1166,6 +1335,728 @@ namespace TriangulationDescription
                                         settings);
     }
 
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    create_description_from_distributed_cells(
+      const std::vector<Point<spacedim>>       &local_vertices,
+      const std::vector<dealii::CellData<dim>> &local_cells,
+      const SubCellData                        &local_subcell_data,
+      const MPI_Comm                            comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings                   settings,
+      const std::vector<std::pair<unsigned int, unsigned int>>
+        &local_periodic_vertex_pairs)
+    {
+      Assert(local_subcell_data.check_consistency(dim),
+             ExcMessage("The SubCellData object contains lines or quads "
+                        "that cannot be faces or lines of a cell in this "
+                        "dimension."));
+
+      const unsigned int n_ranks =
+        dealii::Utilities::MPI::n_mpi_processes(comm);
+
+      // 1) determine the global numbering of the vertices and cells from the
+      //    sizes of the chunks provided by the processes
+      std::vector<types::global_vertex_index> vertex_offsets(n_ranks + 1, 0);
+      {
+        const std::vector<types::global_vertex_index> n_vertices_per_rank =
+          dealii::Utilities::MPI::all_gather(
+            comm,
+            static_cast<types::global_vertex_index>(local_vertices.size()));
+        std::partial_sum(n_vertices_per_rank.begin(),
+                         n_vertices_per_rank.end(),
+                         vertex_offsets.begin() + 1);
+      }
+      // the cells store the global vertex indices as unsigned int
+      AssertThrow(vertex_offsets.back() <=
+                    std::numeric_limits<unsigned int>::max(),
+                  ExcMessage("The total number of vertices exceeds the range "
+                             "of the vertex indices stored in CellData."));
+
+      const auto [first_local_cell, n_global_cells] =
+        dealii::Utilities::MPI::partial_and_total_sum<types::coarse_cell_id>(
+          local_cells.size(), comm);
+
+      // 2) compute the centers of the local cells and their bounding box
+      std::vector<Point<spacedim>> centers(local_cells.size());
+      {
+        const std::vector<unsigned int> vertex_indices =
+          collect_vertices(local_cells);
+        const std::vector<Point<spacedim>> vertices =
+          gather_distributed_vertices(vertex_indices,
+                                      local_vertices,
+                                      vertex_offsets,
+                                      comm);
+
+        for (unsigned int c = 0; c < local_cells.size(); ++c)
+          {
+            for (const unsigned int v : local_cells[c].vertices)
+              centers[c] += vertices[std::lower_bound(vertex_indices.begin(),
+                                                      vertex_indices.end(),
+                                                      v) -
+                                     vertex_indices.begin()];
+            centers[c] /= local_cells[c].vertices.size();
+          }
+      }
+
+      std::vector<double> local_lower_left(spacedim,
+                                           std::numeric_limits<double>::max());
+      std::vector<double> local_upper_right(
+        spacedim, std::numeric_limits<double>::lowest());
+      for (const Point<spacedim> &center : centers)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          {
+            local_lower_left[d]  = std::min(local_lower_left[d], center[d]);
+            local_upper_right[d] = std::max(local_upper_right[d], center[d]);
+          }
+      std::vector<double> lower_left(spacedim), upper_right(spacedim);
+      dealii::Utilities::MPI::min(local_lower_left, comm, lower_left);
+      dealii::Utilities::MPI::max(local_upper_right, comm, upper_right);
+
+      // 3) compute the position of the cell centers along a Hilbert curve
+      //    through the global bounding box
+      const int           bits_per_dim = 63 / spacedim;
+      const std::uint64_t max_int = (std::uint64_t(1) << bits_per_dim) - 1;
+
+      std::vector<std::array<std::uint64_t, spacedim>> integer_centers(
+        centers.size());
+      for (unsigned int c = 0; c < centers.size(); ++c)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          {
+            const long double extent = static_cast<long double>(
+                                         upper_right[d]) -
+                                       static_cast<long double>(lower_left[d]);
+            integer_centers[c][d] =
+              (extent > 0. ?
+                 static_cast<std::uint64_t>(
+                   std::min<long double>((centers[c][d] - lower_left[d]) /
+                                           extent,
+                                         1.) *
+                   max_int) :
+                 0);
+          }
+
+      const std::vector<std::array<std::uint64_t, spacedim>> hilbert_indices =
+        dealii::Utilities::inverse_Hilbert_space_filling_curve<spacedim>(
+          integer_centers, bits_per_dim);
+
+      std::vector<std::pair<std::uint64_t, unsigned int>> keys(
+        local_cells.size());
+      for (unsigned int c = 0; c < local_cells.size(); ++c)
+        keys[c] = {dealii::Utilities::pack_integers<spacedim>(
+                     hilbert_indices[c], bits_per_dim),
+                   c};
+      std::sort(keys.begin(), keys.end());
+
+      // 4) determine the positions along the curve that split the cells
+      //    into parts of (approximately) equal size, by simultaneous
+      //    bisection for all splitters. process p will own the cells whose
+      //    keys lie in [splitters[p-1], splitters[p]).
+      std::vector<std::uint64_t> splitters(n_ranks - 1, 0);
+      {
+        std::vector<std::uint64_t> upper(n_ranks - 1,
+                                         std::uint64_t(1)
+                                           << (bits_per_dim * spacedim));
+        std::vector<std::uint64_t> middle(n_ranks - 1);
+        std::vector<std::uint64_t> local_counts(n_ranks - 1);
+        std::vector<std::uint64_t> global_counts(n_ranks - 1);
+
+        // all processes see the same global counts, so they all leave the
+        // loop at the same time
+        while (splitters != upper)
+          {
+            for (unsigned int p = 0; p < n_ranks - 1; ++p)
+              {
+                middle[p] = splitters[p] + (upper[p] - splitters[p]) / 2;
+                local_counts[p] =
+                  std::lower_bound(keys.begin(),
+                                   keys.end(),
+                                   std::make_pair(middle[p], 0u)) -
+                  keys.begin();
+              }
+            dealii::Utilities::MPI::sum(local_counts, comm, global_counts);
+
+            for (unsigned int p = 0; p < n_ranks - 1; ++p)
+              if (splitters[p] < upper[p])
+                {
+                  if (global_counts[p] >= n_global_cells * (p + 1) / n_ranks)
+                    upper[p] = middle[p];
+                  else
+                    splitters[p] = middle[p] + 1;
+                }
+          }
+      }
+
+      // 5) send the cells to their owners, along with their coarse-cell ids
+      using CellWithId =
+        std::pair<types::coarse_cell_id, dealii::CellData<dim>>;
+
+      std::vector<types::coarse_cell_id> owned_cell_ids;
+      std::vector<dealii::CellData<dim>> owned_cells;
+      {
+        std::map<unsigned int, std::vector<CellWithId>> cells_to_send;
+        for (const auto &[key, c] : keys)
+          cells_to_send[std::upper_bound(splitters.begin(),
+                                         splitters.end(),
+                                         key) -
+                        splitters.begin()]
+            .emplace_back(first_local_cell + c, local_cells[c]);
+
+        for (auto &[rank, cells] :
+             dealii::Utilities::MPI::some_to_some(comm, cells_to_send))
+          {
+            (void)rank;
+            for (auto &[id, cell] : cells)
+              {
+                owned_cell_ids.push_back(id);
+                owned_cells.push_back(std::move(cell));
+              }
+          }
+      }
+
+      // 6) find the ghost cells, i.e., the cells that share a vertex with a
+      //    locally owned cell, where vertices that are identified because
+      //    of periodicity count as the same vertex. to this end, each
+      //    process reports the vertices of its locally owned cells (or the
+      //    smallest vertex of their periodic group) to the owners of these
+      //    vertices, which then tell all processes that share a vertex
+      //    about each other.
+      //
+      //    the pairs of periodic vertices only live on the periodic
+      //    boundaries, so we simply collect all of them on every process
+      //    and merge them into groups
+      std::map<unsigned int, unsigned int> vertex_to_periodic_group;
+      {
+        const auto find_group = [&](unsigned int v) {
+          for (auto it = vertex_to_periodic_group.find(v);
+               it != vertex_to_periodic_group.end() && it->second != v;
+               it = vertex_to_periodic_group.find(v))
+            v = it->second;
+          return v;
+        };
+
+        for (const auto &pairs :
+             dealii::Utilities::MPI::all_gather(comm,
+                                                local_periodic_vertex_pairs))
+          for (const auto &[v0, v1] : pairs)
+            {
+              const unsigned int group_0 = find_group(v0);
+              const unsigned int group_1 = find_group(v1);
+              vertex_to_periodic_group.emplace(group_0, group_0);
+              vertex_to_periodic_group.emplace(group_1, group_1);
+              vertex_to_periodic_group[std::max(group_0, group_1)] =
+                std::min(group_0, group_1);
+            }
+
+        // each group is represented by its smallest vertex
+        for (auto &[v, group] : vertex_to_periodic_group)
+          group = find_group(group);
+      }
+      const auto periodic_group = [&](const unsigned int v) {
+        const auto group = vertex_to_periodic_group.find(v);
+        return (group == vertex_to_periodic_group.end() ? v : group->second);
+      };
+
+      std::vector<std::pair<unsigned int, unsigned int>> shared_vertices;
+      {
+        std::vector<unsigned int> owned_vertices;
+        for (const unsigned int v : collect_vertices(owned_cells))
+          owned_vertices.push_back(periodic_group(v));
+        std::sort(owned_vertices.begin(), owned_vertices.end());
+        owned_vertices.erase(std::unique(owned_vertices.begin(),
+                                         owned_vertices.end()),
+                             owned_vertices.end());
+
+        std::map<unsigned int, std::vector<unsigned int>> vertex_reports;
+        for (const unsigned int v : owned_vertices)
+          vertex_reports[std::upper_bound(vertex_offsets.begin(),
+                                          vertex_offsets.end(),
+                                          v) -
+                         vertex_offsets.begin() - 1]
+            .push_back(v);
+
+        std::vector<std::pair<unsigned int, unsigned int>> vertex_and_rank;
+        for (const auto &[rank, vertices] :
+             dealii::Utilities::MPI::some_to_some(comm, vertex_reports))
+          for (const unsigned int v : vertices)
+            vertex_and_rank.emplace_back(v, rank);
+        std::sort(vertex_and_rank.begin(), vertex_and_rank.end());
+
+        std::map<unsigned int,
+                 std::vector<std::pair<unsigned int, unsigned int>>>
+          sharing_ranks;
+        for (auto begin = vertex_and_rank.begin();
+             begin != vertex_and_rank.end();)
+          {
+            const auto end =
+              std::find_if(begin, vertex_and_rank.end(), [&](const auto &a) {
+                return a.first != begin->first;
+              });
+            for (auto a = begin; a != end; ++a)
+              for (auto b = begin; b != end; ++b)
+                if (a != b)
+                  sharing_ranks[a->second].emplace_back(a->first, b->second);
+            begin = end;
+          }
+
+        for (const auto &[rank, vertices] :
+             dealii::Utilities::MPI::some_to_some(comm, sharing_ranks))
+          {
+            (void)rank;
+            shared_vertices.insert(shared_vertices.end(),
+                                   vertices.begin(),
+                                   vertices.end());
+          }
+        std::sort(shared_vertices.begin(), shared_vertices.end());
+      }
+
+      std::map<unsigned int, std::vector<CellWithId>> ghost_cells_to_send;
+      {
+        std::vector<unsigned int> ranks;
+        for (unsigned int c = 0; c < owned_cells.size(); ++c)
+          {
+            ranks.clear();
+            for (const unsigned int v : owned_cells[c].vertices)
+              {
+                const unsigned int group = periodic_group(v);
+                for (auto it = std::lower_bound(shared_vertices.begin(),
+                                                shared_vertices.end(),
+                                                std::make_pair(group, 0u));
+                     it != shared_vertices.end() && it->first == group;
+                     ++it)
+                  ranks.push_back(it->second);
+              }
+            std::sort(ranks.begin(), ranks.end());
+            ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+            for (const unsigned int rank : ranks)
+              ghost_cells_to_send[rank].emplace_back(owned_cell_ids[c],
+                                                     owned_cells[c]);
+          }
+      }
+
+      // 7) collect the locally relevant cells, i.e., the locally owned cells
+      //    followed by the ghost cells, and sort them by their coarse-cell
+      //    id (along with their owners and their position in the list)
+      const unsigned int my_rank =
+        dealii::Utilities::MPI::this_mpi_process(comm);
+
+      std::vector<dealii::CellData<dim>> cells = std::move(owned_cells);
+      std::vector<std::tuple<types::coarse_cell_id, unsigned int, unsigned int>>
+        relevant_cells;
+      for (unsigned int c = 0; c < cells.size(); ++c)
+        relevant_cells.emplace_back(owned_cell_ids[c], my_rank, c);
+
+      for (auto &[rank, ghost_cells] :
+           dealii::Utilities::MPI::some_to_some(comm, ghost_cells_to_send))
+        for (auto &[id, cell] : ghost_cells)
+          {
+            relevant_cells.emplace_back(id, rank, cells.size());
+            cells.push_back(std::move(cell));
+          }
+      std::sort(relevant_cells.begin(), relevant_cells.end());
+
+      // 8) look up the boundary and manifold ids of the faces and, in 3d,
+      //    the lines of the locally relevant cells among the entries of the
+      //    SubCellData objects of all processes. the objects are identified
+      //    by their sorted global vertex indices
+      const auto sorted_vertices =
+        [&](const dealii::CellData<dim> &cell,
+            const auto                  &local_vertex_indices) {
+          std::vector<unsigned int> key;
+          for (const unsigned int v : local_vertex_indices)
+            key.push_back(cell.vertices[v]);
+          std::sort(key.begin(), key.end());
+          return key;
+        };
+      const auto face_vertices = [&](const dealii::CellData<dim> &cell,
+                                     const unsigned int           f) {
+        const ReferenceCell reference_cell =
+          ReferenceCell::n_vertices_to_type(dim, cell.vertices.size());
+        std::vector<unsigned int> local_vertex_indices;
+        for (const unsigned int v :
+             reference_cell.face_reference_cell(f).vertex_indices())
+          local_vertex_indices.push_back(reference_cell.face_to_cell_vertices(
+            f, v, numbers::default_geometric_orientation));
+        return sorted_vertices(cell, local_vertex_indices);
+      };
+      const auto line_vertices = [&](const dealii::CellData<dim> &cell,
+                                     const unsigned int           l) {
+        const ReferenceCell reference_cell =
+          ReferenceCell::n_vertices_to_type(dim, cell.vertices.size());
+        return sorted_vertices(
+          cell,
+          std::array<unsigned int, 2>{
+            {reference_cell.line_to_cell_vertices(l, 0),
+             reference_cell.line_to_cell_vertices(l, 1)}});
+      };
+
+      std::map<std::vector<unsigned int>,
+               std::pair<types::boundary_id, types::manifold_id>>
+        face_ids, line_ids;
+      if (dim > 1 &&
+          dealii::Utilities::MPI::max(
+            static_cast<unsigned int>(local_subcell_data.boundary_lines.size() +
+                                      local_subcell_data.boundary_quads.size()),
+            comm) > 0)
+        {
+          std::vector<std::vector<unsigned int>> face_keys, line_keys;
+          for (const auto &cell : cells)
+            {
+              const ReferenceCell reference_cell =
+                ReferenceCell::n_vertices_to_type(dim, cell.vertices.size());
+              for (const unsigned int f : reference_cell.face_indices())
+                face_keys.push_back(face_vertices(cell, f));
+              if (dim == 3)
+                for (const unsigned int l : reference_cell.line_indices())
+                  line_keys.push_back(line_vertices(cell, l));
+            }
+          for (auto *keys : {&face_keys, &line_keys})
+            {
+              std::sort(keys->begin(), keys->end());
+              keys->erase(std::unique(keys->begin(), keys->end()),
+                          keys->end());
+            }
+
+          if constexpr (dim == 2)
+            face_ids =
+              lookup_distributed_subcell_ids(local_subcell_data.boundary_lines,
+                                             face_keys,
+                                             vertex_offsets,
+                                             comm);
+          else if constexpr (dim == 3)
+            {
+              face_ids = lookup_distributed_subcell_ids(
+                local_subcell_data.boundary_quads,
+                face_keys,
+                vertex_offsets,
+                comm);
+              line_ids = lookup_distributed_subcell_ids(
+                local_subcell_data.boundary_lines,
+                line_keys,
+                vertex_offsets,
+                comm);
+            }
+        }
+
+      // 9) fill the description, with vertex indices relative to the list
+      //    of locally relevant vertices
+      Description<dim, spacedim> description;
+      description.comm      = comm;
+      description.settings  = settings;
+      description.smoothing = smoothing;
+      if (settings &
+          TriangulationDescription::Settings::construct_multigrid_hierarchy)
+        description.smoothing =
+          static_cast<typename Triangulation<dim, spacedim>::MeshSmoothing>(
+            smoothing |
+            Triangulation<dim, spacedim>::limit_level_difference_at_vertices);
+
+      const std::vector<unsigned int> vertex_indices = collect_vertices(cells);
+      description.coarse_cell_vertices = gather_distributed_vertices(
+        vertex_indices, local_vertices, vertex_offsets, comm);
+
+      description.cell_infos.resize(1);
+      description.coarse_cells.reserve(relevant_cells.size());
+      description.coarse_cell_index_to_coarse_cell_id.reserve(
+        relevant_cells.size());
+      description.cell_infos[0].reserve(relevant_cells.size());
+      for (const auto &[id, owner, c] : relevant_cells)
+        {
+          const CellId  cell_id(id, {});
+          CellData<dim> cell_info;
+          cell_info.id                 = cell_id.to_binary<dim>();
+          cell_info.subdomain_id       = owner;
+          cell_info.level_subdomain_id = owner;
+          cell_info.manifold_id        = cells[c].manifold_id;
+
+          if (face_ids.empty() == false || line_ids.empty() == false)
+            {
+              const ReferenceCell reference_cell =
+                ReferenceCell::n_vertices_to_type(dim,
+                                                  cells[c].vertices.size());
+              for (const unsigned int f : reference_cell.face_indices())
+                {
+                  const auto ids = face_ids.find(face_vertices(cells[c], f));
+                  if (ids == face_ids.end())
+                    continue;
+
+                  // the triangulation only applies the boundary ids of
+                  // faces that are at the boundary
+                  if (ids->second.first != numbers::internal_face_boundary_id)
+                    cell_info.boundary_ids.emplace_back(f, ids->second.first);
+                  if (dim == 2)
+                    cell_info.manifold_line_ids[f] = ids->second.second;
+                  else if (dim == 3)
+                    cell_info.manifold_quad_ids[f] = ids->second.second;
+                }
+              if (dim == 3)
+                for (const unsigned int l : reference_cell.line_indices())
+                  {
+                    const auto ids =
+                      line_ids.find(line_vertices(cells[c], l));
+                    if (ids != line_ids.end())
+                      cell_info.manifold_line_ids[l] = ids->second.second;
+                  }
+            }
+
+          description.cell_infos[0].push_back(cell_info);
+
+          for (unsigned int &v : cells[c].vertices)
+            v = std::lower_bound(vertex_indices.begin(),
+                                 vertex_indices.end(),
+                                 v) -
+                vertex_indices.begin();
+          description.coarse_cells.push_back(std::move(cells[c]));
+          description.coarse_cell_index_to_coarse_cell_id.push_back(id);
+        }
+
+      return description;
+    }
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    create_description_from_binary_mesh_file(
+      const std::string &filename,
+      const MPI_Comm     comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings                   settings)
+    {
+      const unsigned int n_ranks =
+        dealii::Utilities::MPI::n_mpi_processes(comm);
+      const unsigned int my_rank =
+        dealii::Utilities::MPI::this_mpi_process(comm);
+
+      // every process reads its parts of the arrays of the file (see
+      // GridOut::write_binary() for the layout) at the given positions
+#ifdef DEAL_II_WITH_MPI
+      MPI_File fh;
+      int      ierr = MPI_File_open(
+        comm, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+      AssertThrowMPI(ierr);
+
+      MPI_Offset file_size;
+      ierr = MPI_File_get_size(fh, &file_size);
+      AssertThrowMPI(ierr);
+#else
+      std::ifstream in(filename, std::ios::binary);
+      AssertThrow(in.fail() == false, ExcFileNotOpen(filename));
+
+      in.seekg(0, std::ios::end);
+      const std::uint64_t file_size = in.tellg();
+#endif
+
+      const auto read_block = [&](auto               &data,
+                                  const std::uint64_t position,
+                                  const std::uint64_t size) {
+        data.resize(size);
+#ifdef DEAL_II_WITH_MPI
+        const int ierr = dealii::Utilities::MPI::LargeCount::File_read_at_c(
+          fh,
+          position,
+          data.data(),
+          size * sizeof(data[0]),
+          MPI_BYTE,
+          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+#else
+        in.seekg(position);
+        in.read(reinterpret_cast<char *>(data.data()), size * sizeof(data[0]));
+        AssertThrow(in.fail() == false, ExcIO());
+#endif
+      };
+
+      // all processes read the header, and therefore agree on whether the
+      // file can be read
+      std::vector<std::uint64_t> header;
+      AssertThrow(static_cast<std::uint64_t>(file_size) >=
+                    10 * sizeof(std::uint64_t),
+                  ExcMessage("The binary mesh file ended unexpectedly."));
+      read_block(header, 0, 10);
+      AssertThrow(header[0] ==
+                    GridTools::internal::binary_mesh_format_magic_number,
+                  ExcMessage("The file is not a binary mesh file written by "
+                             "GridOut::write_binary(), or it was written on "
+                             "a machine with a different byte order."));
+      AssertThrow(header[1] == GridTools::internal::binary_mesh_format_version,
+                  ExcMessage("The binary mesh file was written with an "
+                             "incompatible version of the file format."));
+      AssertThrow(header[2] == dim && header[3] == spacedim,
+                  ExcMessage("The binary mesh file was written for a "
+                             "triangulation of a different dimension."));
+      AssertThrow(header[4] == 1,
+                  ExcMessage("Only binary mesh files that contain a coarse "
+                             "mesh without any refinement can be read in "
+                             "parallel."));
+
+      const std::uint64_t n_vertices     = header[5];
+      const std::uint64_t n_cells        = header[6];
+      const std::uint64_t vertices_start = 11 * sizeof(std::uint64_t);
+      const std::uint64_t cell_vertices_start =
+        vertices_start + n_vertices * spacedim * sizeof(double);
+      const std::uint64_t cell_ids_start =
+        cell_vertices_start + header[7] * sizeof(std::uint32_t);
+      const std::uint64_t face_ids_start =
+        cell_ids_start + 2 * n_cells * sizeof(std::uint32_t);
+      const std::uint64_t line_ids_start =
+        face_ids_start + header[8] * sizeof(std::uint32_t);
+      const std::uint64_t cell_n_vertices_start =
+        line_ids_start + header[9] * sizeof(std::uint32_t);
+      AssertThrow(static_cast<std::uint64_t>(file_size) ==
+                    cell_n_vertices_start + n_cells * sizeof(std::uint8_t),
+                  ExcMessage("The size of the binary mesh file does not "
+                             "match the sizes given in its header."));
+
+      // read an evenly sized chunk of the vertices
+      std::vector<Point<spacedim>> local_vertices;
+      {
+        const std::uint64_t first_vertex = n_vertices * my_rank / n_ranks;
+        const std::uint64_t end_vertex = n_vertices * (my_rank + 1) / n_ranks;
+
+        std::vector<double> coordinates;
+        read_block(coordinates,
+                   vertices_start + first_vertex * spacedim * sizeof(double),
+                   (end_vertex - first_vertex) * spacedim);
+        local_vertices.resize(end_vertex - first_vertex);
+        for (unsigned int v = 0; v < local_vertices.size(); ++v)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            local_vertices[v][d] = coordinates[v * spacedim + d];
+      }
+
+      // read an evenly sized chunk of the cells. the positions of their
+      // vertex indices and of the ids of their faces and lines in the file
+      // follow from the numbers of vertices, faces, and lines of the cells
+      // on the processes with lower rank
+      const std::uint64_t first_cell = n_cells * my_rank / n_ranks;
+      const std::uint64_t end_cell   = n_cells * (my_rank + 1) / n_ranks;
+
+      std::vector<std::uint8_t> cell_n_vertices;
+      read_block(cell_n_vertices,
+                 cell_n_vertices_start + first_cell,
+                 end_cell - first_cell);
+
+      std::vector<ReferenceCell> reference_cells;
+      std::uint64_t              n_local_vertex_indices = 0;
+      std::uint64_t              n_local_faces = 0, n_local_lines = 0;
+      for (const unsigned int n : cell_n_vertices)
+        {
+          reference_cells.push_back(ReferenceCell::n_vertices_to_type(dim, n));
+          n_local_vertex_indices += n;
+          n_local_faces += reference_cells.back().n_faces();
+          n_local_lines += (dim == 3 ? reference_cells.back().n_lines() : 0);
+        }
+      const std::uint64_t first_vertex_index =
+        dealii::Utilities::MPI::partial_and_total_sum(n_local_vertex_indices,
+                                                      comm)
+          .first;
+      const std::uint64_t first_face =
+        dealii::Utilities::MPI::partial_and_total_sum(n_local_faces, comm)
+          .first;
+      const std::uint64_t first_line =
+        dealii::Utilities::MPI::partial_and_total_sum(n_local_lines, comm)
+          .first;
+
+      std::vector<std::uint32_t> cell_vertices, cell_ids, face_ids, line_ids;
+      read_block(cell_vertices,
+                 cell_vertices_start +
+                   first_vertex_index * sizeof(std::uint32_t),
+                 n_local_vertex_indices);
+      read_block(cell_ids,
+                 cell_ids_start + 2 * first_cell * sizeof(std::uint32_t),
+                 2 * (end_cell - first_cell));
+      read_block(face_ids,
+                 face_ids_start + 2 * first_face * sizeof(std::uint32_t),
+                 2 * n_local_faces);
+      read_block(line_ids,
+                 line_ids_start + 2 * first_line * sizeof(std::uint32_t),
+                 2 * n_local_lines);
+
+#ifdef DEAL_II_WITH_MPI
+      ierr = MPI_File_close(&fh);
+      AssertThrowMPI(ierr);
+#endif
+
+      // set up the cells as well as the faces and lines that have
+      // non-default ids
+      std::vector<dealii::CellData<dim>> local_cells(end_cell - first_cell);
+      SubCellData                        local_subcell_data;
+      for (unsigned int c = 0, vertex_index = 0, face = 0, line = 0;
+           c < local_cells.size();
+           ++c)
+        {
+          const ReferenceCell reference_cell = reference_cells[c];
+
+          local_cells[c].vertices.assign(cell_vertices.begin() + vertex_index,
+                                         cell_vertices.begin() + vertex_index +
+                                           cell_n_vertices[c]);
+          local_cells[c].material_id = cell_ids[2 * c];
+          local_cells[c].manifold_id = cell_ids[2 * c + 1];
+          vertex_index += cell_n_vertices[c];
+
+          const std::vector<unsigned int> &vertices = local_cells[c].vertices;
+
+          for (const unsigned int f : reference_cell.face_indices())
+            {
+              const types::manifold_id manifold_id = face_ids[2 * face];
+              const types::boundary_id boundary_id = face_ids[2 * face + 1];
+              ++face;
+
+              if constexpr (dim > 1)
+                if ((boundary_id != numbers::internal_face_boundary_id &&
+                     boundary_id != 0) ||
+                    manifold_id != numbers::flat_manifold_id)
+                  {
+                    dealii::CellData<dim - 1> face_data(
+                      reference_cell.face_reference_cell(f).n_vertices());
+                    for (unsigned int v = 0; v < face_data.vertices.size();
+                         ++v)
+                      face_data.vertices[v] =
+                        vertices[reference_cell.face_to_cell_vertices(
+                          f, v, numbers::default_geometric_orientation)];
+                    face_data.boundary_id = boundary_id;
+                    face_data.manifold_id = manifold_id;
+
+                    if constexpr (dim == 2)
+                      local_subcell_data.boundary_lines.push_back(face_data);
+                    else
+                      local_subcell_data.boundary_quads.push_back(face_data);
+                  }
+            }
+
+          if constexpr (dim == 3)
+            for (const unsigned int l : reference_cell.line_indices())
+              {
+                const types::manifold_id manifold_id = line_ids[2 * line];
+                const types::boundary_id boundary_id = line_ids[2 * line + 1];
+                ++line;
+
+                if (manifold_id != numbers::flat_manifold_id)
+                  {
+                    dealii::CellData<1> line_data(2);
+                    for (unsigned int v = 0; v < 2; ++v)
+                      line_data.vertices[v] =
+                        vertices[reference_cell.line_to_cell_vertices(l, v)];
+                    line_data.boundary_id = boundary_id;
+                    line_data.manifold_id = manifold_id;
+                    local_subcell_data.boundary_lines.push_back(line_data);
+                  }
+              }
+        }
+
+      return create_description_from_distributed_cells<dim, spacedim>(
+        local_vertices,
+        local_cells,
+        local_subcell_data,
+        comm,
+        smoothing,
+        settings);
+    }
+
   } // namespace Utilities
 } // namespace TriangulationDescription
 
@@ -74,6 +74,111 @@ namespace hp
                       "same number of vector components!"));
 
     Collection<FiniteElement<dim, spacedim>>::push_back(new_fe.clone());
+
+    // the interpolation matrices cached so far may be shared with copies of
+    // this collection that do not contain the new element, so start over
+    interpolation_matrix_cache =
+      std::make_shared<InterpolationMatrixCache>(this->size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  FECollection<dim, spacedim>::InterpolationMatrixCache::
+    InterpolationMatrixCache(const unsigned int n_fes)
+    : face_matrices(n_fes, n_fes)
+    , subface_matrices(n_fes, n_fes, GeometryInfo<dim>::max_children_per_face)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  const FullMatrix<double> &
+  FECollection<dim, spacedim>::get_face_interpolation_matrix(
+    const unsigned int fe_index,
+    const unsigned int source_fe_index) const
+  {
+    AssertIndexRange(fe_index, this->size());
+    AssertIndexRange(source_fe_index, this->size());
+    Assert(interpolation_matrix_cache != nullptr, ExcInternalError());
+
+    std::unique_ptr<const FullMatrix<double>> &matrix =
+      interpolation_matrix_cache->face_matrices[fe_index][source_fe_index];
+    {
+      std::lock_guard<std::mutex> lock(interpolation_matrix_cache->mutex);
+      if (matrix != nullptr)
+        return *matrix;
+    }
+
+    // compute the matrix without holding the lock, so that other threads can
+    // in the meantime access matrices that have already been computed. if
+    // another thread computed the same matrix at the same time, keep the one
+    // that was stored first
+    const FiniteElement<dim, spacedim> &fe        = (*this)[fe_index];
+    const FiniteElement<dim, spacedim> &source_fe = (*this)[source_fe_index];
+
+    // TODO: the implementation makes the assumption that all faces have the
+    // same number of dofs
+    AssertDimension(fe.n_unique_faces(), 1);
+    AssertDimension(source_fe.n_unique_faces(), 1);
+    const unsigned int face_no = 0;
+
+    auto new_matrix =
+      std::make_unique<FullMatrix<double>>(source_fe.n_dofs_per_face(face_no),
+                                           fe.n_dofs_per_face(face_no));
+    fe.get_face_interpolation_matrix(source_fe, *new_matrix, face_no);
+
+    std::lock_guard<std::mutex> lock(interpolation_matrix_cache->mutex);
+    if (matrix == nullptr)
+      matrix = std::move(new_matrix);
+    return *matrix;
+  }
+
+
+
+  template <int dim, int spacedim>
+  const FullMatrix<double> &
+  FECollection<dim, spacedim>::get_subface_interpolation_matrix(
+    const unsigned int fe_index,
+    const unsigned int source_fe_index,
+    const unsigned int subface) const
+  {
+    AssertIndexRange(fe_index, this->size());
+    AssertIndexRange(source_fe_index, this->size());
+    AssertIndexRange(subface, GeometryInfo<dim>::max_children_per_face);
+    Assert(interpolation_matrix_cache != nullptr, ExcInternalError());
+
+    std::unique_ptr<const FullMatrix<double>> &matrix =
+      interpolation_matrix_cache
+        ->subface_matrices[fe_index][source_fe_index][subface];
+    {
+      std::lock_guard<std::mutex> lock(interpolation_matrix_cache->mutex);
+      if (matrix != nullptr)
+        return *matrix;
+    }
+
+    // as above, compute the matrix without holding the lock
+    const FiniteElement<dim, spacedim> &fe        = (*this)[fe_index];
+    const FiniteElement<dim, spacedim> &source_fe = (*this)[source_fe_index];
+
+    // TODO: the implementation makes the assumption that all faces have the
+    // same number of dofs
+    AssertDimension(fe.n_unique_faces(), 1);
+    AssertDimension(source_fe.n_unique_faces(), 1);
+    const unsigned int face_no = 0;
+
+    auto new_matrix =
+      std::make_unique<FullMatrix<double>>(source_fe.n_dofs_per_face(face_no),
+                                           fe.n_dofs_per_face(face_no));
+    fe.get_subface_interpolation_matrix(source_fe,
+                                        subface,
+                                        *new_matrix,
+                                        face_no);
+
+    std::lock_guard<std::mutex> lock(interpolation_matrix_cache->mutex);
+    if (matrix == nullptr)
+      matrix = std::move(new_matrix);
+    return *matrix;
   }
 
 
@@ -1313,9 +1313,8 @@ namespace Particles
 
     {
       // Create a map from vertices to adjacent cells using grid cache
-      const std::vector<
-        std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
-        &vertex_to_cells = triangulation_cache->get_vertex_to_cell_map();
+      const GridTools::VertexToCellMap<dim, spacedim> &vertex_to_cells =
+        triangulation_cache->get_compressed_vertex_to_cell_map();
 
       // Create a corresponding map of vectors from vertex to cell center
       // using grid cache
@@ -1351,8 +1350,8 @@ namespace Particles
           const unsigned int closest_vertex_index =
             current_cell->vertex_index(closest_vertex);
 
-          const auto &candidate_cells = vertex_to_cells[closest_vertex_index];
-          const unsigned int n_candidate_cells = candidate_cells.size();
+          const unsigned int n_candidate_cells =
+            vertex_to_cells.n_adjacent_cells(closest_vertex_index);
 
           // The order of searching through the candidate cells matters for
           // performance reasons. Start with a simple order.
@@ -1391,21 +1390,17 @@ namespace Particles
           // order. Most likely we will find the particle in them.
           for (unsigned int i = 0; i < n_candidate_cells; ++i)
             {
-              typename std::set<
-                typename Triangulation<dim, spacedim>::active_cell_iterator>::
-                const_iterator candidate_cell = candidate_cells.begin();
-
-              std::advance(candidate_cell, search_order[i]);
-              mapping->transform_points_real_to_unit_cell(*candidate_cell,
+              const auto candidate_cell =
+                vertex_to_cells.get_adjacent_cell(closest_vertex_index,
+                                                  search_order[i]);
+              mapping->transform_points_real_to_unit_cell(candidate_cell,
                                                           real_locations,
                                                           reference_locations);
 
-              if ((*candidate_cell)
-                    ->reference_cell()
-                    .contains_point(reference_locations[0],
-                                    tolerance_inside_cell))
+              if (candidate_cell->reference_cell().contains_point(
+                    reference_locations[0], tolerance_inside_cell))
                 {
-                  current_cell = *candidate_cell;
+                  current_cell = candidate_cell;
                   found_cell   = true;
                   break;
                 }
@@ -1445,9 +1440,13 @@ namespace Particles
 
               // Search all of the cells adjacent to the closest vertex of the
               // domain. Most likely we will find the particle in them.
-              for (const auto &cell :
-                   vertex_to_cells[closest_vertex_index_in_domain])
+              for (unsigned int c = 0;
+                   c < vertex_to_cells.n_adjacent_cells(
+                         closest_vertex_index_in_domain);
+                   ++c)
                 {
+                  const auto cell = vertex_to_cells.get_adjacent_cell(
+                    closest_vertex_index_in_domain, c);
                   mapping->transform_points_real_to_unit_cell(
                     cell, real_locations, reference_locations);
 
@@ -0,0 +1,92 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the batched evaluation in FunctionParser::value_list(),
+// vector_value(), vector_value_list() and TensorFunctionParser::value_list()
+// gives the same results as evaluating the expressions point by point. Use a
+// number of points that is not a multiple of the internal batch size.
+
+#include <deal.II/base/function_parser.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor_function_parser.h>
+
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+int
+main()
+{
+  initlog();
+
+  std::map<std::string, double> constants;
+  constants["pi"] = numbers::PI;
+
+  const std::string expressions =
+    "cos(2*pi*x)*y^2+t; sin(2*pi*x)*exp(y)-t; if(x>y, x*y, x+y*t)";
+
+  FunctionParser<2> function(3);
+  function.initialize("x,y,t", expressions, constants, true);
+  function.set_time(0.25);
+
+  TensorFunctionParser<1, 2> tensor_function;
+  tensor_function.initialize("x,y,t",
+                             "cos(2*pi*x)*y^2+t; sin(2*pi*x)*exp(y)-t",
+                             constants,
+                             true);
+  tensor_function.set_time(0.25);
+
+  std::vector<Point<2>> points;
+  for (unsigned int i = 0; i < 77; ++i)
+    points.emplace_back(0.013 * i, 1. - 0.007 * i);
+
+  std::vector<double> values(points.size());
+  for (unsigned int c = 0; c < 3; ++c)
+    {
+      function.value_list(points, values, c);
+      for (unsigned int q = 0; q < points.size(); ++q)
+        AssertThrow(values[q] == function.value(points[q], c),
+                    ExcInternalError());
+    }
+  deallog << "value_list OK" << std::endl;
+
+  std::vector<Vector<double>> vector_values(points.size(), Vector<double>(3));
+  function.vector_value_list(points, vector_values);
+  Vector<double> point_values(3);
+  for (unsigned int q = 0; q < points.size(); ++q)
+    {
+      function.vector_value(points[q], point_values);
+      for (unsigned int c = 0; c < 3; ++c)
+        {
+          AssertThrow(vector_values[q][c] == function.value(points[q], c),
+                      ExcInternalError());
+          AssertThrow(point_values[c] == function.value(points[q], c),
+                      ExcInternalError());
+        }
+    }
+  deallog << "vector_value_list OK" << std::endl;
+
+  std::vector<Tensor<1, 2>> tensor_values(points.size());
+  tensor_function.value_list(points, tensor_values);
+  for (unsigned int q = 0; q < points.size(); ++q)
+    AssertThrow(tensor_values[q] == tensor_function.value(points[q]),
+                ExcInternalError());
+  deallog << "TensorFunctionParser::value_list OK" << std::endl;
+
+  deallog << "Value at " << points.back() << ": " << vector_values.back()[0]
+          << ' ' << vector_values.back()[1] << ' ' << vector_values.back()[2]
+          << std::endl;
+}
@@ -0,0 +1,96 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test IndexSet::is_element(), IndexSet::index_within_set(), and
+// IndexSet::nth_index_in_set() for index sets with many small ranges of
+// varying density, for which IndexSet::enable_range_lookup() lets the set use
+// lookup tables instead of a binary search over all ranges. compare against
+// a brute-force search
+
+#include <deal.II/base/index_set.h>
+
+#include <random>
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+check(const IndexSet &is)
+{
+  std::vector<types::global_dof_index> elements;
+  for (const auto i : is)
+    elements.push_back(i);
+  AssertThrow(elements.size() == is.n_elements(), ExcInternalError());
+
+  types::global_dof_index position = 0;
+  for (types::global_dof_index i = 0; i < is.size(); ++i)
+    {
+      const bool is_element = (position < elements.size() &&
+                               elements[position] == i);
+      AssertThrow(is.is_element(i) == is_element, ExcInternalError());
+      if (is_element)
+        {
+          AssertThrow(is.index_within_set(i) == position, ExcInternalError());
+          AssertThrow(is.nth_index_in_set(position) == i, ExcInternalError());
+          ++position;
+        }
+      else
+        AssertThrow(is.index_within_set(i) == numbers::invalid_dof_index,
+                    ExcInternalError());
+    }
+
+  deallog << "n_elements: " << is.n_elements()
+          << ", n_intervals: " << is.n_intervals() << " OK" << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  std::mt19937 random_generator(42);
+
+  // sets with scattered indices of different density, including the case
+  // of a large locally owned range plus scattered ghost indices
+  for (const unsigned int stride : {2u, 3u, 17u, 1000u})
+    {
+      IndexSet is(20000);
+      is.enable_range_lookup();
+      std::uniform_int_distribution<unsigned int> distribution(0,
+                                                               2 * stride - 1);
+      for (unsigned int i = distribution(random_generator); i < is.size();
+           i += 1 + distribution(random_generator))
+        is.add_index(i);
+      check(is);
+
+      is.add_range(5000, 8000);
+      check(is);
+
+      // after subtracting a set and copying, the lookup must be consistent
+      IndexSet other(20000);
+      other.add_range(6000, 15000);
+      is.subtract_set(other);
+      const IndexSet copy = is;
+      check(copy);
+
+      // remove elements from the back
+      IndexSet shrunk = is;
+      for (unsigned int i = 0; i < 10; ++i)
+        shrunk.pop_back();
+      check(shrunk);
+    }
+}
@@ -0,0 +1,69 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test IndexSet::is_element() and IndexSet::index_within_set() for the
+// popped index and its neighbor after IndexSet::pop_back() on a compressed
+// set with enough ranges to use lookup tables, both when the last range only
+// shrinks and when it becomes empty
+
+#include <deal.II/base/index_set.h>
+
+#include "../tests.h"
+
+
+void
+print(const IndexSet &is, const types::global_dof_index index)
+{
+  deallog << index << ": is_element=" << is.is_element(index)
+          << ", index_within_set=";
+  if (is.index_within_set(index) == numbers::invalid_dof_index)
+    deallog << "invalid";
+  else
+    deallog << is.index_within_set(index);
+  deallog << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  // 50 ranges [10k, 10k+2)
+  IndexSet is(1000);
+  for (unsigned int k = 0; k < 50; ++k)
+    is.add_range(10 * k, 10 * k + 2);
+  is.compress();
+  deallog << "n_elements: " << is.n_elements()
+          << ", n_intervals: " << is.n_intervals() << std::endl;
+
+  // the last range [490, 492) shrinks
+  types::global_dof_index index = is.pop_back();
+  deallog << "popped " << index << std::endl;
+  print(is, index);
+  print(is, index - 1);
+
+  // the last range becomes empty
+  index = is.pop_back();
+  deallog << "popped " << index << std::endl;
+  print(is, index);
+  print(is, index - 9);
+
+  is.compress();
+  deallog << "n_elements: " << is.n_elements()
+          << ", n_intervals: " << is.n_intervals() << std::endl;
+  print(is, 490);
+  print(is, 481);
+}
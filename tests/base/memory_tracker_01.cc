@@ -0,0 +1,86 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test MemoryTracker: recording of memory consumption, high water marks,
+// and the output of MemoryTracker::print_summary()
+
+#include <deal.II/base/memory_tracker.h>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  std::stringstream ss;
+  MemoryTracker     tracker(ss);
+
+  tracker.record("Triangulation", 1000);
+  tracker.record("Triangulation", 500);
+  deallog << "Triangulation: " << tracker.get_current_memory("Triangulation")
+          << ' ' << tracker.get_peak_memory("Triangulation") << std::endl;
+
+  std::vector<double> v(1000);
+  tracker.record_memory_consumption("Vector", v);
+  deallog << "Vector: "
+          << (tracker.get_current_memory("Vector") ==
+              MemoryConsumption::memory_consumption(v))
+          << ' '
+          << (tracker.get_peak_memory("Vector") ==
+              MemoryConsumption::memory_consumption(v))
+          << std::endl;
+
+  deallog << "Unknown: " << tracker.get_current_memory("Unknown") << ' '
+          << tracker.get_peak_memory("Unknown") << std::endl;
+
+  {
+    // touch a large amount of memory within a section. the peak memory
+    // of the section must not be smaller than its current memory
+    MemoryTracker::Scope scope(tracker, "Scratch");
+    std::vector<char>    scratch(50 * 1024 * 1024, 1);
+    AssertThrow(scratch[1234] == 1, ExcInternalError());
+  }
+  AssertThrow(tracker.get_peak_memory("Scratch") >=
+                tracker.get_current_memory("Scratch"),
+              ExcInternalError());
+
+  tracker.print_summary(MPI_COMM_WORLD);
+
+  std::string s = ss.str();
+  std::replace_if(s.begin(), s.end(), ::isdigit, ' ');
+  std::replace_if(
+    s.begin(), s.end(), [](char x) { return x == '.'; }, ' ');
+
+  deallog << s << std::endl;
+
+  tracker.reset();
+  deallog << "After reset: " << tracker.get_peak_memory("Triangulation")
+          << std::endl;
+}
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv);
+
+  mpi_initlog();
+
+  test();
+}
@@ -0,0 +1,60 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test MemoryTracker::print_summary() for subsystems that have only been
+// recorded on some of the processes
+
+#include <deal.II/base/memory_tracker.h>
+
+#include <sstream>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  std::stringstream ss;
+  MemoryTracker     tracker(ss);
+
+  tracker.record("Common", 3 * 1024 * 1024);
+  if (my_rank == 0)
+    tracker.record("Rank 0 only", 2 * 1024 * 1024);
+  else
+    tracker.record("Rank 1 only", 4 * 1024 * 1024);
+
+  tracker.print_summary(MPI_COMM_WORLD);
+
+  // print the rows of the subsystems, which do not depend on the memory
+  // consumption of the process
+  std::string line;
+  while (std::getline(ss, line))
+    if (line.find("Common") != std::string::npos ||
+        line.find("only") != std::string::npos)
+      deallog << line << std::endl;
+}
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv);
+
+  mpi_initlog();
+
+  test();
+}
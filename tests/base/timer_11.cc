@@ -0,0 +1,107 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test TimerOutput::print_nested_summary() and TimerOutput::write_trace()
+
+#include <deal.II/base/timer.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "../tests.h"
+
+// burn computer time
+double s = 0.;
+void
+burn(unsigned int n)
+{
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      for (unsigned int j = 1; j < 100000; ++j)
+        {
+          s += 1. / j * i;
+        }
+    }
+}
+
+void
+test()
+{
+  std::stringstream ss;
+
+  TimerOutput t(ss, TimerOutput::never, TimerOutput::wall_times);
+  t.enable_trace_recording();
+
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      TimerOutput::Scope outer(t, "outer");
+      burn(20);
+      {
+        TimerOutput::Scope inner(t, "inner");
+        burn(20);
+        {
+          TimerOutput::Scope innermost(t, "innermost");
+          burn(20);
+        }
+      }
+      {
+        TimerOutput::Scope inner(t, "second inner");
+        burn(20);
+      }
+    }
+  {
+    // the same section on the top level is reported separately
+    TimerOutput::Scope inner(t, "inner");
+    burn(20);
+  }
+
+  t.print_nested_summary();
+
+  std::string s = ss.str();
+  std::replace_if(s.begin(), s.end(), ::isdigit, ' ');
+  std::replace_if(
+    s.begin(), s.end(), [](char x) { return x == '.'; }, ' ');
+
+  deallog << s << std::endl << std::endl;
+
+  std::ostringstream trace;
+  t.write_trace(trace, MPI_COMM_WORLD);
+
+  const std::string trace_string = trace.str();
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      std::size_t n_events = 0;
+      for (std::size_t pos = trace_string.find("\"ph\":\"X\"");
+           pos != std::string::npos;
+           pos = trace_string.find("\"ph\":\"X\"", pos + 1))
+        ++n_events;
+      deallog << "Number of trace events: " << n_events << std::endl;
+      deallog << "Trace contains rank 1: "
+              << (trace_string.find("\"MPI rank 1\"") != std::string::npos)
+              << std::endl;
+    }
+  else
+    AssertThrow(trace_string.empty(), ExcInternalError());
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv);
+
+  mpi_initlog();
+
+  test();
+}
@@ -0,0 +1,72 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// test that TimerOutput::write_trace() only contains sections that were
+// entered while trace recording was enabled
+
+#include <deal.II/base/timer.h>
+
+#include <sstream>
+
+#include "../tests.h"
+
+void
+test()
+{
+  std::stringstream ss;
+
+  TimerOutput t(ss, TimerOutput::never, TimerOutput::wall_times);
+
+  // enter sections once without and once with recording
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      t.enter_subsection("outer");
+      t.enable_trace_recording();
+      t.enter_subsection("inner");
+      t.leave_subsection("inner");
+      t.leave_subsection("outer");
+    }
+
+  // entered while recording, but left after recording was disabled
+  t.enter_subsection("disabled");
+  t.enable_trace_recording(false);
+  t.leave_subsection("disabled");
+
+  std::ostringstream trace;
+  t.write_trace(trace, MPI_COMM_SELF);
+
+  const std::string trace_string = trace.str();
+  for (const std::string name : {"outer", "inner", "disabled"})
+    {
+      std::size_t n_events = 0;
+      for (std::size_t pos = trace_string.find("\"name\":\"" + name + "\"");
+           pos != std::string::npos;
+           pos = trace_string.find("\"name\":\"" + name + "\"", pos + 1))
+        ++n_events;
+      deallog << "Trace events for " << name << ": " << n_events
+              << std::endl;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  initlog();
+
+  test();
+}
@@ -0,0 +1,96 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test TimerOutput::print_nested_summary() with sections entered on another
+// thread, which must not be nested in the sections of the main thread, and
+// with a communicator whose processes encountered different sections
+
+#include <deal.II/base/timer.h>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#include "../tests.h"
+
+// burn computer time
+double s = 0.;
+void
+burn(unsigned int n)
+{
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      for (unsigned int j = 1; j < 100000; ++j)
+        {
+          s += 1. / j * i;
+        }
+    }
+}
+
+void
+test()
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  std::stringstream ss;
+
+  TimerOutput t(ss, TimerOutput::never, TimerOutput::wall_times);
+
+  {
+    TimerOutput::Scope outer(t, "outer");
+    burn(20);
+    {
+      TimerOutput::Scope inner(t, "inner");
+      burn(20);
+    }
+
+    std::thread worker([&t]() {
+      TimerOutput::Scope scope(t, "worker");
+      burn(20);
+      TimerOutput::Scope inner(t, "worker inner");
+      burn(20);
+    });
+    worker.join();
+
+    if (my_rank == 1)
+      {
+        TimerOutput::Scope scope(t, "rank 1 only");
+        burn(20);
+      }
+  }
+  // spend some time outside of all sections, so that the fraction of the
+  // top-level sections is well below 100%
+  burn(40);
+
+  t.print_nested_summary();
+  t.print_nested_summary(MPI_COMM_WORLD);
+
+  std::string s = ss.str();
+  std::replace_if(s.begin(), s.end(), ::isdigit, ' ');
+  std::replace_if(
+    s.begin(), s.end(), [](char x) { return x == '.'; }, ' ');
+
+  deallog << s << std::endl << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv);
+
+  mpi_initlog();
+
+  test();
+}
@@ -0,0 +1,168 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the bit-by-bit packing of Utilities::pack/unpack without
+// compression for large trivially copyable objects and objects of type
+// Vector, and the in-place access of packed vectors with
+// Utilities::unpack_to_array_view(). Buffers in the format of earlier
+// versions of the library, which serialized these objects with
+// boost::serialization, must still be unpacked correctly.
+
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include "../tests.h"
+
+
+
+// Create a buffer the way Utilities::pack() did before objects of these
+// types were copied bit by bit
+template <typename T>
+std::vector<char>
+pack_with_archive(const T &object)
+{
+  std::vector<char> buffer;
+  {
+    boost::iostreams::filtering_ostreambuf fosb;
+    fosb.push(boost::iostreams::back_inserter(buffer));
+
+    boost::archive::binary_oarchive boa(fosb);
+    boa << object;
+  }
+  return buffer;
+}
+
+
+
+void
+test_tensor()
+{
+  SymmetricTensor<4, 3> t;
+  for (unsigned int i = 0; i < t.n_independent_components; ++i)
+    t.access_raw_entry(i) = random_value<double>();
+
+  const std::vector<char> buffer = Utilities::pack(t, false);
+  deallog << "SymmetricTensor<4,3>: size " << sizeof(t) << ", packed size "
+          << buffer.size() << std::endl;
+
+  const auto t2 = Utilities::unpack<SymmetricTensor<4, 3>>(buffer, false);
+  deallog << "SymmetricTensor<4,3>: " << (t2 == t ? "OK" : "Failed")
+          << std::endl;
+
+  const auto t3 =
+    Utilities::unpack<SymmetricTensor<4, 3>>(pack_with_archive(t), false);
+  deallog << "SymmetricTensor<4,3> from archive: "
+          << (t3 == t ? "OK" : "Failed") << std::endl;
+}
+
+
+
+void
+test_vector()
+{
+  Vector<double> v(1000);
+  for (auto &entry : v)
+    entry = random_value<double>();
+
+  // pack the vector behind some other data, as done when sending several
+  // objects in one message
+  std::vector<char> buffer;
+  Utilities::pack(Point<3>(1, 2, 3), buffer, false);
+  const std::size_t offset = buffer.size();
+  Utilities::pack(v, buffer, false);
+  deallog << "Vector<double>: packed size " << buffer.size() - offset
+          << std::endl;
+
+  const auto v2 =
+    Utilities::unpack<Vector<double>>(buffer.cbegin() + offset,
+                                      buffer.cend(),
+                                      false);
+  deallog << "Vector<double>: " << (v2 == v ? "OK" : "Failed") << std::endl;
+
+  // the packed vector can also be accessed in place, behind the tag and
+  // the size of the vector
+  const ArrayView<const double> view =
+    Utilities::unpack_to_array_view<double>(buffer.cbegin() + offset,
+                                            buffer.cend());
+  deallog << "Points into buffer: "
+          << (static_cast<const void *>(view.data()) ==
+              static_cast<const void *>(buffer.data() + offset +
+                                        sizeof(std::uint64_t) +
+                                        sizeof(std::size_t)))
+          << std::endl;
+  bool equal = (view.size() == v.size());
+  for (unsigned int i = 0; equal && i < v.size(); ++i)
+    equal = (view[i] == v[i]);
+  deallog << "ArrayView<double>: " << (equal ? "OK" : "Failed") << std::endl;
+
+  const auto v3 =
+    Utilities::unpack<Vector<double>>(pack_with_archive(v), false);
+  deallog << "Vector<double> from archive: " << (v3 == v ? "OK" : "Failed")
+          << std::endl;
+
+  // check empty vectors
+  const std::vector<char> empty_buffer =
+    Utilities::pack(Vector<float>(), false);
+  deallog << "Empty vector: packed size " << empty_buffer.size()
+          << ", unpacked size "
+          << Utilities::unpack<Vector<float>>(empty_buffer, false).size()
+          << ", view size "
+          << Utilities::unpack_to_array_view<float>(empty_buffer.cbegin(),
+                                                    empty_buffer.cend())
+               .size()
+          << std::endl;
+}
+
+
+
+void
+test_vector_of_points()
+{
+  std::vector<Point<3>> points(100);
+  for (auto &p : points)
+    p = random_point<3>();
+
+  const std::vector<char> buffer = Utilities::pack(points, false);
+
+  const ArrayView<const Point<3>> view =
+    Utilities::unpack_to_array_view<Point<3>>(buffer.cbegin(), buffer.cend());
+  bool equal = (view.size() == points.size());
+  for (unsigned int i = 0; equal && i < points.size(); ++i)
+    equal = (view[i] == points[i]);
+  deallog << "ArrayView<Point<3>>: " << (equal ? "OK" : "Failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test_tensor();
+  test_vector();
+  test_vector_of_points();
+}
@@ -0,0 +1,128 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// DoFHandler::distribute_dofs() numbers the DoFs of large meshes with
+// several threads. Check that the numbering is the same as the one obtained
+// with a single thread, and that renumbering gives the same result as well.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_simplex_p.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<types::global_dof_index>
+get_dof_indices(const Triangulation<dim> &tria,
+                const FiniteElement<dim> &fe,
+                const unsigned int        n_threads,
+                types::global_dof_index  &n_dofs)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  n_dofs = dof_handler.n_dofs();
+
+  std::vector<types::global_dof_index> indices, local_dof_indices;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+      cell->get_dof_indices(local_dof_indices);
+      indices.insert(indices.end(),
+                     local_dof_indices.begin(),
+                     local_dof_indices.end());
+    }
+
+  // also renumber and append the new indices
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+      cell->get_dof_indices(local_dof_indices);
+      indices.insert(indices.end(),
+                     local_dof_indices.begin(),
+                     local_dof_indices.end());
+    }
+
+  return indices;
+}
+
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria, const FiniteElement<dim> &fe)
+{
+  types::global_dof_index n_dofs_serial = 0, n_dofs_threads = 0;
+
+  const auto serial  = get_dof_indices(tria, fe, 1, n_dofs_serial);
+  const auto threads = get_dof_indices(tria, fe, 4, n_dofs_threads);
+
+  deallog << "dim=" << dim << ", " << fe.get_name()
+          << ", same number of DoFs: " << (n_dofs_serial == n_dofs_threads)
+          << ", same numbering: " << (serial == threads) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<2> tria;
+    GridGenerator::hyper_ball(tria);
+    tria.refine_global(3);
+    for (unsigned int cycle = 0; cycle < 2; ++cycle)
+      {
+        for (const auto &cell : tria.active_cell_iterators())
+          if (random_value<double>() < 0.3)
+            cell->set_refine_flag();
+        tria.execute_coarsening_and_refinement();
+      }
+    check(tria, FE_Q<2>(1));
+    check(tria, FESystem<2>(FE_Q<2>(3), 2));
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::hyper_ball(tria);
+    tria.refine_global(2);
+    for (const auto &cell : tria.active_cell_iterators())
+      if (random_value<double>() < 0.5)
+        cell->set_refine_flag();
+    tria.execute_coarsening_and_refinement();
+    check(tria, FE_Q<3>(2));
+    check(tria, FESystem<3>(FE_Q<3>(3), 2));
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::subdivided_hyper_cube_with_simplices(tria, 5);
+    check(tria, FE_SimplexP<3>(3));
+  }
+}
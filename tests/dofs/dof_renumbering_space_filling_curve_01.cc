@@ -0,0 +1,134 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test DoFRenumbering::space_filling_curve(): the result must be a
+// permutation, components at the same support point must stay consecutive,
+// and couplings must be more local than with a random numbering.
+
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_nedelec.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+
+// average distance of the indices of coupling DoFs
+template <int dim>
+double
+average_coupling_distance(const DoFHandler<dim> &dof_handler)
+{
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+
+  double sum = 0;
+  for (types::global_dof_index row = 0; row < dsp.n_rows(); ++row)
+    for (auto entry = dsp.begin(row); entry != dsp.end(row); ++entry)
+      sum += std::abs(static_cast<double>(row) - entry->column());
+  return sum / dsp.n_nonzero_elements();
+}
+
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria, const FiniteElement<dim> &fe)
+{
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  std::vector<types::global_dof_index> renumbering(dof_handler.n_dofs());
+  DoFRenumbering::compute_space_filling_curve(renumbering, dof_handler);
+  std::vector<types::global_dof_index> sorted(renumbering);
+  std::sort(sorted.begin(), sorted.end());
+  bool is_permutation = true;
+  for (types::global_dof_index i = 0; i < sorted.size(); ++i)
+    is_permutation = is_permutation && (sorted[i] == i);
+
+  DoFRenumbering::space_filling_curve(dof_handler);
+  const double distance = average_coupling_distance(dof_handler);
+
+  // all components of a support point are numbered consecutively
+  bool consecutive = true;
+  if (fe.n_components() > 1 && fe.is_primitive())
+    {
+      std::vector<types::global_dof_index> local_dof_indices(
+        fe.n_dofs_per_cell());
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        {
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            if (fe.system_to_component_index(i).first > 0)
+              {
+                const unsigned int previous = fe.component_to_system_index(
+                  fe.system_to_component_index(i).first - 1,
+                  fe.system_to_component_index(i).second);
+                consecutive =
+                  consecutive &&
+                  (local_dof_indices[i] == local_dof_indices[previous] + 1);
+              }
+        }
+    }
+
+  DoFRenumbering::random(dof_handler);
+  const double distance_random = average_coupling_distance(dof_handler);
+
+  deallog << "dim=" << dim << ", " << fe.get_name()
+          << ", permutation: " << is_permutation
+          << ", components consecutive: " << consecutive
+          << ", closer than random: " << (distance < distance_random)
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<2> tria;
+    GridGenerator::hyper_ball(tria);
+    tria.refine_global(3);
+    for (unsigned int cycle = 0; cycle < 2; ++cycle)
+      {
+        for (const auto &cell : tria.active_cell_iterators())
+          if (random_value<double>() < 0.3)
+            cell->set_refine_flag();
+        tria.execute_coarsening_and_refinement();
+      }
+    check(tria, FE_Q<2>(2));
+    check(tria, FESystem<2>(FE_Q<2>(1), 2));
+    check(tria, FE_Nedelec<2>(0));
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::hyper_shell(tria, Point<3>(), 0.5, 1.);
+    tria.refine_global(2);
+    check(tria, FESystem<3>(FE_Q<3>(1), 3));
+  }
+}
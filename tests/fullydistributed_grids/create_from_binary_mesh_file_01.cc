@@ -0,0 +1,144 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Create a parallel::fullydistributed::Triangulation from a coarse mesh
+// written by GridOut::write_binary(), with each process only reading a part
+// of the file in create_description_from_binary_mesh_file().
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_out.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  const std::string filename = "mesh_" + std::to_string(dim) + "d.bin";
+
+  // write the coarse mesh, with material ids and the boundary and manifold
+  // ids of the faces set
+  if (Utilities::MPI::this_mpi_process(comm) == 0)
+    {
+      Triangulation<dim> tria_serial;
+      GridGenerator::subdivided_hyper_cube(
+        tria_serial, dim == 2 ? 8 : 4, 0, 1, true);
+      for (const auto &cell : tria_serial.active_cell_iterators())
+        {
+          cell->set_material_id(cell->active_cell_index() % 3);
+          for (const auto &face : cell->face_iterators())
+            if (face->at_boundary())
+              face->set_manifold_id(10 + face->boundary_id());
+        }
+
+      std::ofstream out(filename, std::ios::binary);
+      GridOut().write_binary(tria_serial, out);
+    }
+  MPI_Barrier(comm);
+
+  const auto description = TriangulationDescription::Utilities::
+    create_description_from_binary_mesh_file<dim, dim>(filename, comm);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(description);
+
+  // the cells are partitioned evenly among the processes
+  const auto n_owned_cells =
+    Utilities::MPI::min_max_avg(tria.n_locally_owned_active_cells(), comm);
+  deallog << "n_global_active_cells:     " << tria.n_global_active_cells()
+          << std::endl;
+  deallog << "partition balanced:        "
+          << (n_owned_cells.max - n_owned_cells.min <= 1) << std::endl;
+
+  double       local_volume = 0;
+  unsigned int material_sum = 0;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        local_volume += cell->measure();
+        material_sum += cell->material_id();
+      }
+  deallog << "volume:                    "
+          << Utilities::MPI::sum(local_volume, comm) << std::endl;
+  deallog << "sum of material ids:       "
+          << Utilities::MPI::sum(material_sum, comm) << std::endl;
+
+  // the boundary and manifold ids of the faces are the ones of the
+  // colorized serial mesh
+  unsigned int boundary_id_sum = 0;
+  bool         ids_correct     = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      for (const auto &face : cell->face_iterators())
+        if (face->at_boundary())
+          {
+            types::boundary_id expected_id = numbers::invalid_boundary_id;
+            for (unsigned int d = 0; d < dim; ++d)
+              if (std::abs(face->center()[d]) < 1e-10)
+                expected_id = 2 * d;
+              else if (std::abs(face->center()[d] - 1.) < 1e-10)
+                expected_id = 2 * d + 1;
+            ids_correct = ids_correct && face->boundary_id() == expected_id &&
+                          face->manifold_id() == 10 + expected_id;
+            boundary_id_sum += face->boundary_id();
+          }
+  deallog << "boundary ids correct:      "
+          << (Utilities::MPI::min(ids_correct ? 1U : 0U, comm) == 1)
+          << std::endl;
+  deallog << "sum of boundary ids:       "
+          << Utilities::MPI::sum(boundary_id_sum, comm) << std::endl;
+
+  // the ghost layer needs to be complete for the enumeration of the degrees
+  // of freedom to succeed
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  deallog << "n_dofs:                    " << dof_handler.n_dofs()
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  {
+    deallog.push("2d");
+    test<2>(comm);
+    deallog.pop();
+  }
+  {
+    deallog.push("3d");
+    test<3>(comm);
+    deallog.pop();
+  }
+}
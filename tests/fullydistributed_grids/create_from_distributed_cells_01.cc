@@ -0,0 +1,180 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Create a parallel::fullydistributed::Triangulation with
+// create_description_from_distributed_cells(), where each process only
+// provides a chunk of the vertices, of the cells, and of the boundary faces
+// of the coarse mesh.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+  // create the coarse mesh (in a real application, this would be read in
+  // chunks from a file) and extract this process' part of it
+  Triangulation<dim> tria_serial;
+  GridGenerator::subdivided_hyper_cube(
+    tria_serial, dim == 2 ? 8 : 4, 0, 1, true);
+  for (const auto &cell : tria_serial.active_cell_iterators())
+    cell->set_material_id(cell->active_cell_index() % 3);
+
+  const IndexSet local_vertex_range =
+    Utilities::create_evenly_distributed_partitioning(my_rank,
+                                                      n_ranks,
+                                                      tria_serial.n_vertices());
+  std::vector<Point<dim>> local_vertices;
+  for (const auto v : local_vertex_range)
+    local_vertices.push_back(tria_serial.get_vertices()[v]);
+
+  // provide the cells in reverse order to make sure that the global
+  // numbering is not simply the one of the serial mesh
+  const IndexSet local_cell_range =
+    Utilities::create_evenly_distributed_partitioning(
+      n_ranks - 1 - my_rank, n_ranks, tria_serial.n_active_cells());
+  std::vector<CellData<dim>> local_cells;
+  for (const auto c : local_cell_range)
+    {
+      const auto    cell = std::next(tria_serial.begin_active(), c);
+      CellData<dim> cell_data(cell->n_vertices());
+      for (const unsigned int v : cell->vertex_indices())
+        cell_data.vertices[v] = cell->vertex_index(v);
+      cell_data.material_id = cell->material_id();
+      local_cells.push_back(cell_data);
+    }
+
+  // distribute the boundary faces, with their boundary ids and a manifold id
+  // derived from them, round-robin among the processes
+  SubCellData  local_boundary;
+  unsigned int face_index = 0;
+  for (const auto &cell : tria_serial.active_cell_iterators())
+    for (const auto &face : cell->face_iterators())
+      if (face->at_boundary() && (face_index++) % n_ranks == my_rank)
+        {
+          CellData<dim - 1> face_data(face->n_vertices());
+          for (const unsigned int v : face->vertex_indices())
+            face_data.vertices[v] = face->vertex_index(v);
+          face_data.boundary_id = face->boundary_id();
+          face_data.manifold_id = 10 + face->boundary_id();
+          if constexpr (dim == 2)
+            local_boundary.boundary_lines.push_back(face_data);
+          else
+            local_boundary.boundary_quads.push_back(face_data);
+        }
+
+  const auto description = TriangulationDescription::Utilities::
+    create_description_from_distributed_cells<dim, dim>(local_vertices,
+                                                        local_cells,
+                                                        local_boundary,
+                                                        comm);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(description);
+
+  // the cells are partitioned evenly among the processes
+  const auto n_owned_cells =
+    Utilities::MPI::min_max_avg(tria.n_locally_owned_active_cells(), comm);
+  deallog << "n_global_active_cells:     " << tria.n_global_active_cells()
+          << std::endl;
+  deallog << "partition balanced:        "
+          << (n_owned_cells.max - n_owned_cells.min <= 1) << std::endl;
+
+  double       local_volume = 0;
+  unsigned int material_sum = 0;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        local_volume += cell->measure();
+        material_sum += cell->material_id();
+      }
+  deallog << "volume:                    "
+          << Utilities::MPI::sum(local_volume, comm) << std::endl;
+  deallog << "sum of material ids:       "
+          << Utilities::MPI::sum(material_sum, comm) << std::endl;
+
+  // the boundary and manifold ids of the faces are the ones of the
+  // colorized serial mesh
+  unsigned int boundary_id_sum = 0;
+  bool         ids_correct     = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      for (const auto &face : cell->face_iterators())
+        if (face->at_boundary())
+          {
+            types::boundary_id expected_id = numbers::invalid_boundary_id;
+            for (unsigned int d = 0; d < dim; ++d)
+              if (std::abs(face->center()[d]) < 1e-10)
+                expected_id = 2 * d;
+              else if (std::abs(face->center()[d] - 1.) < 1e-10)
+                expected_id = 2 * d + 1;
+            ids_correct = ids_correct && face->boundary_id() == expected_id &&
+                          face->manifold_id() == 10 + expected_id;
+            boundary_id_sum += face->boundary_id();
+          }
+  deallog << "boundary ids correct:      "
+          << (Utilities::MPI::min(ids_correct ? 1U : 0U, comm) == 1)
+          << std::endl;
+  deallog << "sum of boundary ids:       "
+          << Utilities::MPI::sum(boundary_id_sum, comm) << std::endl;
+
+  // the ghost layer needs to be complete for the enumeration of the degrees
+  // of freedom to succeed
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  deallog << "n_dofs:                    " << dof_handler.n_dofs()
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  {
+    deallog.push("2d");
+    test<2>(comm);
+    deallog.pop();
+  }
+  {
+    deallog.push("3d");
+    test<3>(comm);
+    deallog.pop();
+  }
+}
@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Like create_from_distributed_cells_01, but for a mesh that is periodic in
+// all directions: the pairs of periodic vertices are distributed among the
+// processes, and the cells across the periodic boundaries need to become
+// ghost cells for the periodicity constraints to be complete.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+  Triangulation<dim> tria_serial;
+  GridGenerator::subdivided_hyper_cube(
+    tria_serial, dim == 2 ? 8 : 4, 0, 1, true);
+
+  const IndexSet local_vertex_range =
+    Utilities::create_evenly_distributed_partitioning(my_rank,
+                                                      n_ranks,
+                                                      tria_serial.n_vertices());
+  std::vector<Point<dim>> local_vertices;
+  for (const auto v : local_vertex_range)
+    local_vertices.push_back(tria_serial.get_vertices()[v]);
+
+  const IndexSet local_cell_range =
+    Utilities::create_evenly_distributed_partitioning(
+      n_ranks - 1 - my_rank, n_ranks, tria_serial.n_active_cells());
+  std::vector<CellData<dim>> local_cells;
+  for (const auto c : local_cell_range)
+    {
+      const auto    cell = std::next(tria_serial.begin_active(), c);
+      CellData<dim> cell_data(cell->n_vertices());
+      for (const unsigned int v : cell->vertex_indices())
+        cell_data.vertices[v] = cell->vertex_index(v);
+      local_cells.push_back(cell_data);
+    }
+
+  SubCellData  local_boundary;
+  unsigned int face_index = 0;
+  for (const auto &cell : tria_serial.active_cell_iterators())
+    for (const auto &face : cell->face_iterators())
+      if (face->at_boundary() && (face_index++) % n_ranks == my_rank)
+        {
+          CellData<dim - 1> face_data(face->n_vertices());
+          for (const unsigned int v : face->vertex_indices())
+            face_data.vertices[v] = face->vertex_index(v);
+          face_data.boundary_id = face->boundary_id();
+          if constexpr (dim == 2)
+            local_boundary.boundary_lines.push_back(face_data);
+          else
+            local_boundary.boundary_quads.push_back(face_data);
+        }
+
+  // identify the vertices on opposite sides of the cube, and distribute the
+  // pairs round-robin among the processes
+  const std::vector<Point<dim>> &vertices = tria_serial.get_vertices();
+
+  std::vector<std::pair<unsigned int, unsigned int>> local_periodic_pairs;
+  unsigned int                                       pair_index = 0;
+  for (unsigned int d = 0; d < dim; ++d)
+    for (unsigned int v0 = 0; v0 < vertices.size(); ++v0)
+      if (std::abs(vertices[v0][d]) < 1e-10)
+        for (unsigned int v1 = 0; v1 < vertices.size(); ++v1)
+          {
+            Point<dim> shifted = vertices[v0];
+            shifted[d] += 1.;
+            if (vertices[v1].distance(shifted) < 1e-10 &&
+                (pair_index++) % n_ranks == my_rank)
+              local_periodic_pairs.emplace_back(v0, v1);
+          }
+
+  const auto description = TriangulationDescription::Utilities::
+    create_description_from_distributed_cells<dim, dim>(
+      local_vertices,
+      local_cells,
+      local_boundary,
+      comm,
+      Triangulation<dim>::none,
+      TriangulationDescription::Settings::default_setting,
+      local_periodic_pairs);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(description);
+
+  std::vector<
+    GridTools::PeriodicFacePair<typename Triangulation<dim>::cell_iterator>>
+    periodic_faces;
+  for (unsigned int d = 0; d < dim; ++d)
+    GridTools::collect_periodic_faces(
+      tria, 2 * d, 2 * d + 1, d, periodic_faces);
+  tria.add_periodicity(periodic_faces);
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints(
+    dof_handler.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler));
+  for (unsigned int d = 0; d < dim; ++d)
+    DoFTools::make_periodicity_constraints(
+      dof_handler, 2 * d, 2 * d + 1, d, constraints);
+  constraints.close();
+
+  // each process constrains the locally owned degrees of freedom on the
+  // upper periodic boundaries, which requires all cells across these
+  // boundaries to be ghost cells
+  unsigned int n_constrained_dofs = 0;
+  for (const auto i : dof_handler.locally_owned_dofs())
+    if (constraints.is_constrained(i))
+      ++n_constrained_dofs;
+
+  deallog << "n_global_active_cells:     " << tria.n_global_active_cells()
+          << std::endl;
+  deallog << "n_dofs:                    " << dof_handler.n_dofs()
+          << std::endl;
+  deallog << "n_constrained_dofs:        "
+          << Utilities::MPI::sum(n_constrained_dofs, comm) << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  {
+    deallog.push("2d");
+    test<2>(comm);
+    deallog.pop();
+  }
+  {
+    deallog.push("3d");
+    test<3>(comm);
+    deallog.pop();
+  }
+}
@@ -0,0 +1,104 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test RepartitioningPolicyTools::NodeAwarePolicy: emulate a machine with
+// two nodes on which the processes are placed in blocks of consecutive
+// ranks. The balanced boundary between the nodes lies in the middle of a
+// coarse cell of a strip of 17 coarse cells. Allowing some imbalance between
+// the nodes moves the boundary to the nearest face between coarse cells,
+// which reduces the number of ghost cells owned by processes on the other
+// node.
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::pair<unsigned int, unsigned int>
+repartition(const MPI_Comm comm,
+            const double   max_node_imbalance,
+            const bool     print_cells)
+{
+  const unsigned int n_processes = Utilities::MPI::n_mpi_processes(comm);
+
+  std::vector<unsigned int> repetitions(dim, 1);
+  repetitions[0] = 17;
+  Point<dim> upper_right;
+  for (unsigned int d = 0; d < dim; ++d)
+    upper_right[d] = repetitions[d];
+
+  Triangulation<dim> serial_tria;
+  GridGenerator::subdivided_hyper_rectangle(serial_tria,
+                                            repetitions,
+                                            Point<dim>(),
+                                            upper_right);
+  serial_tria.refine_global(dim == 2 ? 2 : 1);
+  GridTools::partition_triangulation_zorder(n_processes, serial_tria);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      serial_tria, comm));
+
+  std::vector<unsigned int> node_of_process(n_processes);
+  for (unsigned int p = 0; p < n_processes; ++p)
+    node_of_process[p] = 2 * p / n_processes;
+  const RepartitioningPolicyTools::NodeAwarePolicy<dim> policy(
+    node_of_process, max_node_imbalance);
+
+  tria.set_partitioner(policy, TriangulationDescription::Settings());
+  tria.repartition();
+
+  if (print_cells)
+    deallog << "dim=" << dim
+            << ", locally owned cells: " << tria.n_locally_owned_active_cells()
+            << std::endl;
+
+  return policy.count_ghost_cells(tria);
+}
+
+
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  const auto ghost_cells_balanced = repartition<dim>(comm, 0., false);
+  const auto ghost_cells          = repartition<dim>(comm, 0.1, true);
+
+  deallog << "dim=" << dim << ", fewer inter-node ghost cells: "
+          << (ghost_cells.second < ghost_cells_balanced.second) << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  test<2>(comm);
+  test<3>(comm);
+}
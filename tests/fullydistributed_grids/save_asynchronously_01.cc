@@ -0,0 +1,150 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test Triangulation::save_asynchronously() with fullydistributed
+// triangulations: the vector may be modified right after the call, and the
+// data loaded after wait_for_save() must be the one at the time of the call.
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/solution_transfer.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../grid/tests.h"
+
+
+template <int dim>
+void
+test(parallel::fullydistributed::Triangulation<dim> &triangulation)
+{
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(FE_Q<dim>(2));
+
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler);
+
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  std::shared_ptr<Utilities::MPI::Partitioner> partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(
+      dof_handler.locally_owned_dofs(), locally_relevant_dofs, MPI_COMM_WORLD);
+
+  VectorType vector(partitioner);
+  VectorTools::interpolate(dof_handler,
+                           Functions::SquareFunction<dim>(),
+                           vector);
+  vector.update_ghost_values();
+  const VectorType vector_saved(vector);
+
+  const std::string filename =
+    "save_asynchronously_" + std::to_string(dim) + "d_out";
+
+  // save twice to check that a pending save is completed before the next
+  // one starts
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      SolutionTransfer<dim, VectorType> solution_transfer(dof_handler);
+      solution_transfer.prepare_for_serialization(vector);
+
+      triangulation.save_asynchronously(filename);
+    }
+
+  // the data has been packed already, so we can overwrite the vector
+  vector = 0.;
+
+  triangulation.wait_for_save();
+  triangulation.clear();
+
+  VectorType vector_loaded;
+  {
+    triangulation.load(filename);
+    dof_handler.distribute_dofs(FE_Q<dim>(2));
+
+    vector_loaded.reinit(partitioner);
+
+    SolutionTransfer<dim, VectorType> solution_transfer(dof_handler);
+    solution_transfer.deserialize(vector_loaded);
+  }
+
+  VectorType error(vector_saved);
+  error.add(-1, vector_loaded);
+
+  deallog << (error.linfty_norm() < 1e-16 ? "PASSED" : "FAILED") << std::endl;
+}
+
+
+int
+main(int argc, char **argv)
+{
+  initlog();
+
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  deallog.push("2d");
+  {
+    constexpr int dim = 2;
+
+    Triangulation<dim> basetria;
+    GridGenerator::hyper_cube(basetria);
+    basetria.refine_global(3);
+    GridTools::partition_triangulation_zorder(
+      Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), basetria);
+
+    const auto description = TriangulationDescription::Utilities::
+      create_description_from_triangulation(basetria, MPI_COMM_WORLD);
+
+    parallel::fullydistributed::Triangulation<dim> triangulation(
+      MPI_COMM_WORLD);
+    triangulation.create_triangulation(description);
+
+    test<dim>(triangulation);
+  }
+  deallog.pop();
+
+  deallog.push("3d");
+  {
+    constexpr int dim = 3;
+
+    Triangulation<dim> basetria;
+    GridGenerator::hyper_cube(basetria);
+    basetria.refine_global(2);
+    GridTools::partition_triangulation_zorder(
+      Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), basetria);
+
+    const auto description = TriangulationDescription::Utilities::
+      create_description_from_triangulation(basetria, MPI_COMM_WORLD);
+
+    parallel::fullydistributed::Triangulation<dim> triangulation(
+      MPI_COMM_WORLD);
+    triangulation.create_triangulation(description);
+
+    test<dim>(triangulation);
+  }
+  deallog.pop();
+}
@@ -0,0 +1,125 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test GridTools::compute_point_locations on an adaptively refined mesh
+// with a curved high-order mapping, with points in the interior of cells,
+// on vertices and faces of cells, and outside the domain. The points are
+// located in batches that are processed in parallel, so check that the
+// result does not depend on the number of threads.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include <set>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const MappingQ<dim> mapping(3);
+
+  // random points, some of which lie outside the ball, plus all vertices
+  // and face centers
+  std::vector<Point<dim>> points;
+  for (unsigned int i = 0; i < 500; ++i)
+    points.push_back(random_point<dim>(-1.1, 1.1));
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      for (const unsigned int v : cell->vertex_indices())
+        points.push_back(cell->vertex(v));
+      for (const unsigned int f : cell->face_indices())
+        points.push_back(cell->face(f)->center());
+    }
+
+  std::vector<std::tuple<
+    std::vector<typename Triangulation<dim>::active_cell_iterator>,
+    std::vector<std::vector<Point<dim>>>,
+    std::vector<std::vector<unsigned int>>,
+    std::vector<unsigned int>>>
+    results;
+  for (const unsigned int n_threads : {1, 4})
+    {
+      MultithreadInfo::set_thread_limit(n_threads);
+      GridTools::Cache<dim> cache(tria, mapping);
+      results.push_back(
+        GridTools::compute_point_locations_try_all(cache, points));
+    }
+  MultithreadInfo::set_thread_limit();
+
+  const auto &[cells, qpoints, maps, missing] = results[0];
+
+  // every cell must appear only once, every point must be found at most
+  // once, and the reference points must map back to the real points
+  bool                   ok = true;
+  std::set<unsigned int> found_points(missing.begin(), missing.end());
+  ok = ok && (std::set<typename Triangulation<dim>::active_cell_iterator>(
+                cells.begin(), cells.end())
+                .size() == cells.size());
+  for (unsigned int c = 0; c < cells.size(); ++c)
+    for (unsigned int q = 0; q < qpoints[c].size(); ++q)
+      {
+        ok = ok && found_points.insert(maps[c][q]).second;
+        const Point<dim> &p_unit = qpoints[c][q];
+        ok = ok && GeometryInfo<dim>::is_inside_unit_cell(p_unit, 1e-10);
+        ok = ok && (mapping.transform_unit_to_real_cell(cells[c], p_unit)
+                      .distance(points[maps[c][q]]) < 1e-10);
+      }
+  ok = ok && (found_points.size() == points.size());
+
+  // only points outside the ball (up to the approximation of the boundary
+  // by the mapping) may be missing
+  for (const unsigned int i : missing)
+    ok = ok && (points[i].norm() > 0.99);
+
+  deallog << "dim=" << dim << std::endl;
+  deallog << "Consistent: " << ok << std::endl;
+  deallog << "Independent of the number of threads: "
+          << (std::get<0>(results[1]) == cells &&
+              std::get<1>(results[1]) == qpoints &&
+              std::get<2>(results[1]) == maps &&
+              std::get<3>(results[1]) == missing)
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
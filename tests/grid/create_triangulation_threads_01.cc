@@ -0,0 +1,103 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// The faces of the coarse cells are matched in parallel during
+// Triangulation::create_triangulation(). Check that the enumeration and the
+// orientation of the lines and quads do not depend on the number of
+// threads, for meshes that are large enough to be split into several parts.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<unsigned int>
+face_data(const std::function<void(Triangulation<dim> &)> &create_mesh)
+{
+  Triangulation<dim> tria;
+  create_mesh(tria);
+
+  std::vector<unsigned int> data;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      for (const unsigned int f : cell->face_indices())
+        {
+          data.push_back(cell->face_index(f));
+          data.push_back(cell->combined_face_orientation(f));
+        }
+      if (dim == 3)
+        for (const unsigned int l : cell->line_indices())
+          {
+            data.push_back(cell->line(l)->index());
+            data.push_back(cell->line_orientation(l));
+          }
+      data.push_back(cell->neighbor_index(0));
+    }
+  return data;
+}
+
+
+
+template <int dim>
+void
+check(const std::function<void(Triangulation<dim> &)> &create_mesh,
+      const std::string                               &name)
+{
+  MultithreadInfo::set_thread_limit(1);
+  const std::vector<unsigned int> data_serial = face_data<dim>(create_mesh);
+
+  // the number of threads determines how the faces are split up for
+  // matching, so also use several threads on machines with only a few cores
+  MultithreadInfo::set_thread_limit(4);
+  const std::vector<unsigned int> data_parallel = face_data<dim>(create_mesh);
+
+  deallog << "dim=" << dim << ", " << name << ": "
+          << (data_serial == data_parallel ? "OK" : "Failed") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  check<2>(
+    [](Triangulation<2> &tria) {
+      GridGenerator::subdivided_hyper_cube(tria, 80);
+    },
+    "hypercube mesh");
+  check<2>(
+    [](Triangulation<2> &tria) {
+      GridGenerator::subdivided_hyper_cube_with_simplices(tria, 60);
+    },
+    "simplex mesh");
+  check<3>(
+    [](Triangulation<3> &tria) {
+      GridGenerator::subdivided_hyper_cube(tria, 15);
+    },
+    "hypercube mesh");
+  check<3>(
+    [](Triangulation<3> &tria) {
+      GridGenerator::subdivided_hyper_cube_with_simplices(tria, 8);
+    },
+    "simplex mesh");
+}
@@ -0,0 +1,178 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Write adaptively refined meshes in the binary format of
+// GridOut::write_binary(), read them back in with GridIn::read_binary(), and
+// check that the refinement hierarchy, the vertex locations, and all ids
+// are the same.
+
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_in.h>
+#include <deal.II/grid/grid_out.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <sstream>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+bool
+compare(const Triangulation<dim> &tria1, const Triangulation<dim> &tria2)
+{
+  bool equal = (tria1.n_levels() == tria2.n_levels()) &&
+               (tria1.n_used_vertices() == tria2.n_used_vertices());
+  for (unsigned int l = 0; equal && l < tria1.n_levels(); ++l)
+    equal = equal && (tria1.n_cells(l) == tria2.n_cells(l));
+  if (!equal)
+    return false;
+
+  const auto cells1 = GridTools::internal::cells_in_hierarchical_order(tria1);
+  const auto cells2 = GridTools::internal::cells_in_hierarchical_order(tria2);
+  for (unsigned int l = 0; l < cells1.size(); ++l)
+    for (unsigned int c = 0; c < cells1[l].size(); ++c)
+      {
+        const auto &cell1 = cells1[l][c];
+        const auto &cell2 = cells2[l][c];
+        equal = equal &&
+                (cell1->reference_cell() == cell2->reference_cell()) &&
+                (cell1->refinement_case() == cell2->refinement_case()) &&
+                (cell1->material_id() == cell2->material_id()) &&
+                (cell1->manifold_id() == cell2->manifold_id());
+        for (const unsigned int v : cell1->vertex_indices())
+          equal = equal && (cell1->vertex(v) == cell2->vertex(v));
+        for (const unsigned int f : cell1->face_indices())
+          equal = equal &&
+                  (cell1->face(f)->manifold_id() ==
+                   cell2->face(f)->manifold_id()) &&
+                  (cell1->face(f)->boundary_id() ==
+                   cell2->face(f)->boundary_id());
+        if (dim == 3)
+          for (const unsigned int i : cell1->line_indices())
+            equal =
+              equal &&
+              (cell1->line(i)->manifold_id() ==
+               cell2->line(i)->manifold_id()) &&
+              (cell1->line(i)->boundary_id() == cell2->line(i)->boundary_id());
+      }
+  return equal;
+}
+
+
+
+template <int dim>
+void
+test(Triangulation<dim> &tria)
+{
+  // refine and coarsen randomly, and set some ids
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (random_value<double>() < 0.3)
+          {
+            if (dim > 1 && tria.all_reference_cells_are_hyper_cube() &&
+                random_value<double>() < 0.3)
+              cell->set_refine_flag(RefinementCase<dim>::cut_axis(0));
+            else
+              cell->set_refine_flag();
+          }
+        else if (tria.all_reference_cells_are_hyper_cube() &&
+                 random_value<double>() < 0.2)
+          cell->set_coarsen_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+  for (const auto &cell : tria.active_cell_iterators())
+    if (random_value<double>() < 0.2)
+      {
+        cell->set_material_id(3);
+        cell->set_manifold_id(4);
+        if (dim > 1)
+          cell->face(0)->set_manifold_id(5);
+        if (cell->face(0)->at_boundary())
+          cell->face(0)->set_boundary_id(6);
+      }
+  // GridTools::distort_random() does not support anisotropically refined
+  // faces in 3d
+  if (dim == 2)
+    GridTools::distort_random(0.1, tria, false);
+
+  // round trip through a stream
+  std::stringstream stream;
+  GridOut().write_binary(tria, stream);
+  {
+    Triangulation<dim> tria2;
+    GridIn<dim>        grid_in(tria2);
+    grid_in.read_binary(stream);
+    deallog << "dim=" << dim << ", stream: " << compare(tria, tria2)
+            << std::endl;
+  }
+
+  // round trip through a file with the format deduced from the suffix
+  {
+    std::ofstream out("mesh.dealii", std::ios::binary);
+    GridOut       grid_out;
+    grid_out.write(tria, out, GridOut::binary);
+  }
+  {
+    Triangulation<dim> tria2;
+    GridIn<dim>        grid_in(tria2);
+    grid_in.read("mesh.dealii");
+    deallog << "dim=" << dim << ", file: " << compare(tria, tria2)
+            << std::endl;
+  }
+
+  // a stream with a wrong header must be rejected
+  std::string data = stream.str();
+  data[0]          = ~data[0];
+  std::istringstream corrupted(data);
+  Triangulation<dim> tria3;
+  GridIn<dim>        grid_in(tria3);
+  try
+    {
+      grid_in.read_binary(corrupted);
+    }
+  catch (const ExceptionBase &e)
+    {
+      deallog << "Exception: " << e.get_exc_name() << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<2> tria;
+    GridGenerator::hyper_ball(tria);
+    test(tria);
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::hyper_cube(tria, 0, 1, true);
+    tria.refine_global(1);
+    test(tria);
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::subdivided_hyper_cube_with_simplices(tria, 2);
+    test(tria);
+  }
+}
@@ -0,0 +1,138 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// GridTools::Cache updates its data structures incrementally after local
+// refinement and coarsening of a serial triangulation. Check that the
+// results agree with the ones computed from scratch.
+
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+bool
+compare(const GridTools::Cache<dim> &cache)
+{
+  using active_cell_iterator =
+    typename Triangulation<dim>::active_cell_iterator;
+  const Triangulation<dim> &tria    = cache.get_triangulation();
+  const Mapping<dim>       &mapping = cache.get_mapping();
+  bool                      equal   = true;
+
+  // vertex-to-cell map and directions to the cell centers
+  const auto vertex_to_cells = GridTools::vertex_to_cell_map(tria);
+  equal = equal && (cache.get_vertex_to_cell_map() == vertex_to_cells);
+
+  const auto centers =
+    GridTools::vertex_to_cell_centers_directions(tria, vertex_to_cells);
+  const auto &cached_centers = cache.get_vertex_to_cell_centers_directions();
+  equal = equal && (cached_centers.size() == centers.size());
+  for (unsigned int v = 0; equal && v < centers.size(); ++v)
+    {
+      equal = equal && (cached_centers[v].size() == centers[v].size());
+      for (unsigned int i = 0; equal && i < centers[v].size(); ++i)
+        equal =
+          equal && ((cached_centers[v][i] - centers[v][i]).norm() < 1e-12);
+    }
+
+  // used vertices and their RTree
+  const auto used_vertices = GridTools::extract_used_vertices(tria, mapping);
+  equal = equal && (cache.get_used_vertices() == used_vertices);
+
+  std::map<unsigned int, Point<dim>> vertices_in_rtree;
+  for (const auto &entry : cache.get_used_vertices_rtree())
+    vertices_in_rtree[entry.second] = entry.first;
+  equal = equal && (vertices_in_rtree == used_vertices);
+
+  // cell bounding boxes
+  for (const auto *rtree :
+       {&cache.get_cell_bounding_boxes_rtree(),
+        &cache.get_locally_owned_cell_bounding_boxes_rtree()})
+    {
+      std::set<active_cell_iterator> cells_in_rtree;
+      for (const auto &entry : *rtree)
+        {
+          const BoundingBox<dim> box = mapping.get_bounding_box(entry.second);
+          equal = equal && entry.second->is_active() &&
+                  (box.get_boundary_points() ==
+                   entry.first.get_boundary_points());
+          cells_in_rtree.insert(entry.second);
+        }
+      equal = equal && (cells_in_rtree.size() == tria.n_active_cells());
+    }
+
+  return equal;
+}
+
+
+
+template <int dim>
+void
+test(Triangulation<dim> &tria)
+{
+  GridTools::Cache<dim> cache(tria);
+  deallog << "dim=" << dim << ", initial mesh: " << compare(cache)
+          << std::endl;
+
+  for (unsigned int cycle = 0; cycle < 4; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (random_value<double>() < 0.1)
+          cell->set_refine_flag();
+        else if (random_value<double>() < 0.2)
+          cell->set_coarsen_flag();
+      tria.execute_coarsening_and_refinement();
+
+      // also check that data structures that are rebuilt from scratch and
+      // incrementally updated ones can be mixed
+      if (cycle == 2)
+        cache.mark_for_update(GridTools::update_used_vertices);
+
+      deallog << "cycle " << cycle << ": " << compare(cache) << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<1> tria;
+    GridGenerator::hyper_cube(tria);
+    tria.refine_global(4);
+    test(tria);
+  }
+  {
+    Triangulation<2> tria;
+    GridGenerator::hyper_ball(tria);
+    tria.refine_global(2);
+    test(tria);
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::hyper_cube(tria);
+    tria.refine_global(2);
+    test(tria);
+  }
+}
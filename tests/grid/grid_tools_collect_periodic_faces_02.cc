@@ -0,0 +1,131 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// GridTools::collect_periodic_faces() finds matching faces through a search
+// tree. Check on larger distorted meshes, with and without a rotation
+// matrix, that the result is the same as with a search over all pairs of
+// faces.
+
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria,
+      const types::boundary_id  b_id1,
+      const types::boundary_id  b_id2,
+      const unsigned int        direction,
+      const Tensor<1, dim>     &offset,
+      const FullMatrix<double> &matrix,
+      const double              tolerance)
+{
+  using cell_iterator = typename Triangulation<dim>::cell_iterator;
+  std::vector<GridTools::PeriodicFacePair<cell_iterator>> matched_pairs;
+  GridTools::collect_periodic_faces(
+    tria, b_id1, b_id2, direction, matched_pairs, offset, matrix, tolerance);
+
+  std::set<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>>
+    found;
+  for (const auto &pair : matched_pairs)
+    found.emplace(pair.cell[0]->index(),
+                  pair.face_idx[0],
+                  pair.cell[1]->index(),
+                  pair.face_idx[1]);
+
+  // compare with all pairs of faces
+  std::vector<std::pair<cell_iterator, unsigned int>> faces1, faces2;
+  for (const auto &cell : tria.cell_iterators_on_level(0))
+    for (const unsigned int f : cell->face_indices())
+      if (cell->face(f)->at_boundary())
+        {
+          if (cell->face(f)->boundary_id() == b_id1)
+            faces1.emplace_back(cell, f);
+          if (cell->face(f)->boundary_id() == b_id2)
+            faces2.emplace_back(cell, f);
+        }
+
+  std::set<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>>
+    expected;
+  for (const auto &[cell1, f1] : faces1)
+    for (const auto &[cell2, f2] : faces2)
+      if (GridTools::orthogonal_equality(cell1->face(f1),
+                                         cell2->face(f2),
+                                         direction,
+                                         offset,
+                                         matrix,
+                                         tolerance))
+        expected.emplace(cell1->index(), f1, cell2->index(), f2);
+
+  deallog << "dim=" << dim << ", direction=" << direction
+          << ", matched pairs: " << matched_pairs.size()
+          << ", same as brute force: " << (found == expected) << std::endl;
+}
+
+
+
+template <int dim>
+void
+test(const unsigned int n_subdivisions)
+{
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube(tria, n_subdivisions, 0., 1., true);
+
+  // distort the interior vertices and move the boundary vertices by less
+  // than the tolerance
+  const double tolerance = 1e-7;
+  GridTools::distort_random(0.2, tria, /* keep_boundary = */ true);
+  GridTools::distort_random(tolerance / 10, tria, /* keep_boundary = */ false);
+
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      Tensor<1, dim> offset;
+      offset[d] = 1.;
+      check(tria, 2 * d, 2 * d + 1, d, offset, FullMatrix<double>(), tolerance);
+    }
+
+  // in 2d, also match the left boundary with the bottom one after rotating
+  // by 90 degrees
+  if (dim == 2)
+    {
+      FullMatrix<double> rotation(dim, dim);
+      rotation(0, 1) = -1.;
+      rotation(1, 0) = 1.;
+      Tensor<1, dim> offset;
+      offset[0] = 1.;
+      check(tria, 0, 2, 1, offset, rotation, tolerance);
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(100);
+  test<3>(12);
+}
@@ -0,0 +1,142 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test GridTools::laplace_transform on a fully distributed triangulation:
+// on a globally refined mesh, the vertices must end up at the same places
+// as with a serial triangulation, and on a locally refined mesh, the
+// hanging vertices must stay in the middle of the lines of the neighbors.
+
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+Point<dim>
+deform(const Point<dim> &p)
+{
+  Point<dim> result = p;
+  result[0] += 0.1 * std::sin(numbers::PI * p[1]);
+  return result;
+}
+
+
+
+template <int dim>
+std::map<unsigned int, Point<dim>>
+boundary_points(const Triangulation<dim> &tria)
+{
+  std::map<unsigned int, Point<dim>> new_points;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_artificial() == false)
+      for (const auto &face : cell->face_iterators())
+        if (face->at_boundary())
+          for (const unsigned int v : face->vertex_indices())
+            new_points[face->vertex_index(v)] = deform(face->vertex(v));
+  return new_points;
+}
+
+
+
+template <int dim>
+void
+test(const bool local_refinement)
+{
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  Triangulation<dim> serial_tria(
+    Triangulation<dim>::limit_level_difference_at_vertices);
+  GridGenerator::hyper_cube(serial_tria, -1, 1);
+  serial_tria.refine_global(dim == 2 ? 3 : 2);
+  if (local_refinement)
+    {
+      for (const auto &cell : serial_tria.active_cell_iterators())
+        if (cell->center()[0] < 0)
+          cell->set_refine_flag();
+      serial_tria.execute_coarsening_and_refinement();
+    }
+
+  GridTools::partition_triangulation_zorder(
+    Utilities::MPI::n_mpi_processes(comm), serial_tria);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      serial_tria, comm));
+
+  const std::map<unsigned int, Point<dim>> new_points = boundary_points(tria);
+  GridTools::laplace_transform(new_points, tria);
+
+  if (local_refinement == false)
+    {
+      GridTools::laplace_transform(boundary_points(serial_tria), serial_tria);
+
+      bool same = true;
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->is_artificial() == false)
+          {
+            const auto serial_cell =
+              serial_tria.create_cell_iterator(cell->id());
+            for (const unsigned int v : cell->vertex_indices())
+              same = same &&
+                     (cell->vertex(v).distance(serial_cell->vertex(v)) < 1e-8);
+          }
+      deallog << "dim=" << dim << ", same as serial: " << same << std::endl;
+    }
+  else
+    {
+      bool conforming = true;
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->is_locally_owned())
+          for (const auto &face : cell->face_iterators())
+            if (face->has_children())
+              conforming =
+                conforming &&
+                (face->child(0)->vertex(1).distance(
+                   0.5 * (face->vertex(0) + face->vertex(1))) < 1e-12);
+
+      bool boundary_moved = true;
+      for (const auto &[vertex_index, point] : new_points)
+        boundary_moved =
+          boundary_moved &&
+          (tria.get_vertices()[vertex_index].distance(point) < 1e-12);
+
+      deallog << "dim=" << dim
+              << ", hanging vertices conforming: " << conforming
+              << ", boundary moved: " << boundary_moved << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2>(false);
+  test<3>(false);
+  test<2>(true);
+}
@@ -0,0 +1,156 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test GridTools::laplace_transform on a fully distributed triangulation
+// whose refinement differs strongly between the processes, so that some
+// vertices of ghost cells hang on faces of cells that are artificial on the
+// process that stores the ghost cell. All processes must agree on the
+// positions of the vertices of the ghost cells, both when solving for the
+// displacements and for the absolute positions.
+
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+Point<dim>
+deform(const Point<dim> &p)
+{
+  // an affine map, which is exactly represented by the hanging vertices
+  // on the boundary in 3d
+  Point<dim> result = p;
+  result[0] += 0.2 * p[1];
+  return result;
+}
+
+
+
+template <int dim>
+void
+test(const bool solve_for_absolute_positions)
+{
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  // refine every third cell, which gives hanging vertices all over the
+  // mesh and on all process boundaries
+  Triangulation<dim> serial_tria(
+    Triangulation<dim>::limit_level_difference_at_vertices);
+  GridGenerator::hyper_cube(serial_tria, -1, 1);
+  serial_tria.refine_global(dim == 2 ? 3 : 2);
+  for (const auto &cell : serial_tria.active_cell_iterators())
+    if (cell->active_cell_index() % 3 == 0)
+      cell->set_refine_flag();
+  serial_tria.execute_coarsening_and_refinement();
+
+  GridTools::partition_triangulation_zorder(
+    Utilities::MPI::n_mpi_processes(comm), serial_tria);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      serial_tria, comm));
+
+  std::map<unsigned int, Point<dim>> new_points;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_artificial() == false)
+      for (const auto &face : cell->face_iterators())
+        if (face->at_boundary())
+          for (const unsigned int v : face->vertex_indices())
+            new_points[face->vertex_index(v)] = deform(face->vertex(v));
+
+  GridTools::laplace_transform(new_points,
+                               tria,
+                               static_cast<const Function<dim> *>(nullptr),
+                               solve_for_absolute_positions);
+
+  // send the vertices of the ghost cells to the owners of these cells,
+  // which compare them with the vertices of their locally owned cells
+  std::map<unsigned int,
+           std::vector<std::pair<std::string, std::vector<Point<dim>>>>>
+    ghost_vertices;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_ghost())
+      {
+        std::vector<Point<dim>> vertices;
+        for (const unsigned int v : cell->vertex_indices())
+          vertices.push_back(cell->vertex(v));
+        ghost_vertices[cell->subdomain_id()].emplace_back(
+          cell->id().to_string(), vertices);
+      }
+
+  bool consistent = true;
+  for (const auto &[rank, cells] :
+       Utilities::MPI::some_to_some(comm, ghost_vertices))
+    {
+      (void)rank;
+      for (const auto &[id, vertices] : cells)
+        {
+          const auto cell = tria.create_cell_iterator(CellId(id));
+          for (const unsigned int v : cell->vertex_indices())
+            consistent =
+              consistent && (cell->vertex(v).distance(vertices[v]) < 1e-12);
+        }
+    }
+
+  bool conforming = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      for (const auto &face : cell->face_iterators())
+        if (face->has_children())
+          conforming = conforming &&
+                       (face->child(0)->vertex(dim == 2 ? 1 : 3).distance(
+                          face->center()) < 1e-12);
+
+  bool boundary_moved = true;
+  for (const auto &[vertex_index, point] : new_points)
+    boundary_moved =
+      boundary_moved &&
+      (tria.get_vertices()[vertex_index].distance(point) < 1e-12);
+
+  deallog << "dim=" << dim
+          << ", absolute positions: " << solve_for_absolute_positions
+          << ", ghost vertices consistent: "
+          << (Utilities::MPI::min(consistent ? 1U : 0U, comm) == 1)
+          << ", hanging vertices conforming: "
+          << (Utilities::MPI::min(conforming ? 1U : 0U, comm) == 1)
+          << ", boundary moved: "
+          << (Utilities::MPI::min(boundary_moved ? 1U : 0U, comm) == 1)
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2>(false);
+  test<2>(true);
+  test<3>(false);
+  test<3>(true);
+}
@@ -0,0 +1,93 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// The locations of the new vertices created during refinement are computed
+// in parallel. Check that the resulting meshes do not depend on the number
+// of threads, for curved meshes consisting of hypercube cells and for meshes
+// consisting of simplices.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+refine(Triangulation<dim> &tria)
+{
+  tria.refine_global(2);
+
+  // for hypercube meshes, also refine a part of the mesh adaptively, which
+  // creates hanging nodes
+  if (tria.all_reference_cells_are_hyper_cube() == false)
+    return;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0.25)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+}
+
+
+
+template <int dim>
+void
+check(const std::function<void(Triangulation<dim> &)> &create_mesh)
+{
+  Triangulation<dim> tria_serial, tria_parallel;
+  create_mesh(tria_serial);
+  create_mesh(tria_parallel);
+
+  const unsigned int n_threads = MultithreadInfo::n_threads();
+
+  MultithreadInfo::set_thread_limit(1);
+  refine(tria_serial);
+
+  MultithreadInfo::set_thread_limit(n_threads);
+  refine(tria_parallel);
+
+  AssertDimension(tria_serial.n_active_cells(), tria_parallel.n_active_cells());
+  AssertDimension(tria_serial.n_vertices(), tria_parallel.n_vertices());
+  for (unsigned int v = 0; v < tria_serial.n_vertices(); ++v)
+    AssertThrow(tria_serial.get_vertices()[v] ==
+                  tria_parallel.get_vertices()[v],
+                ExcInternalError());
+
+  deallog << "dim=" << dim << ", "
+          << (tria_parallel.all_reference_cells_are_hyper_cube() ? "hypercube" :
+                                                                   "simplex")
+          << " mesh: OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  check<2>([](Triangulation<2> &tria) { GridGenerator::hyper_ball(tria); });
+  check<2>([](Triangulation<2> &tria) {
+    GridGenerator::subdivided_hyper_cube_with_simplices(tria, 2);
+  });
+  check<3>([](Triangulation<3> &tria) { GridGenerator::hyper_ball(tria); });
+  check<3>([](Triangulation<3> &tria) {
+    GridGenerator::subdivided_hyper_cube_with_simplices(tria, 2);
+  });
+}
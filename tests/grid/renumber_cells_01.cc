@@ -0,0 +1,181 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test Triangulation::renumber_cells_along_space_filling_curve() on
+// adaptively refined and coarsened meshes: the renumbered mesh must
+// consist of the same cells with the same properties, the neighbor and
+// parent-child relations must be consistent, and neighboring cells must be
+// closer to each other in the ordering than before.
+
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_simplex_p.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <map>
+
+#include "../tests.h"
+
+
+
+// return the average distance of the active cell indices of neighboring
+// cells
+template <int dim>
+double
+average_neighbor_distance(const Triangulation<dim> &tria)
+{
+  double       sum = 0;
+  unsigned int n   = 0;
+  for (const auto &cell : tria.active_cell_iterators())
+    for (const unsigned int f : cell->face_indices())
+      if (cell->at_boundary(f) == false && cell->neighbor(f)->is_active())
+        {
+          sum += std::abs(static_cast<double>(cell->active_cell_index()) -
+                          cell->neighbor(f)->active_cell_index());
+          ++n;
+        }
+  return sum / n;
+}
+
+
+
+template <int dim>
+void
+check(Triangulation<dim> &tria, const FiniteElement<dim> &fe)
+{
+  // refine and coarsen the mesh a couple of times so that the cells are
+  // stored in a rather random order
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (random_value<double>() < 0.3)
+          cell->set_refine_flag();
+        else if (tria.all_reference_cells_are_hyper_cube() &&
+                 random_value<double>() < 0.3)
+          cell->set_coarsen_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  std::map<std::pair<unsigned int, Point<dim>>,
+           std::pair<types::material_id, unsigned int>,
+           std::function<bool(const std::pair<unsigned int, Point<dim>> &,
+                              const std::pair<unsigned int, Point<dim>> &)>>
+    cells([](const auto &a, const auto &b) {
+      if (a.first != b.first)
+        return a.first < b.first;
+      for (unsigned int d = 0; d < dim; ++d)
+        if (std::abs(a.second[d] - b.second[d]) > 1e-10)
+          return a.second[d] < b.second[d];
+      return false;
+    });
+  unsigned int counter = 0;
+  for (const auto &cell : tria.cell_iterators())
+    {
+      cell->set_material_id(counter % 7);
+      cell->set_user_index(counter);
+      cells[{cell->level(), cell->center()}] = {cell->material_id(), counter};
+      ++counter;
+    }
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  const types::global_dof_index n_dofs = dof_handler.n_dofs();
+
+  const double distance_before = average_neighbor_distance(tria);
+  tria.renumber_cells_along_space_filling_curve();
+  const double distance_after = average_neighbor_distance(tria);
+
+  // the same cells must be present, with the same data attached
+  bool same_cells = (tria.n_cells() == cells.size());
+  for (const auto &cell : tria.cell_iterators())
+    {
+      const auto entry = cells.find({cell->level(), cell->center()});
+      same_cells = same_cells && entry != cells.end() &&
+                   entry->second.first == cell->material_id() &&
+                   entry->second.second == cell->user_index();
+    }
+  deallog << "Same cells: " << same_cells << std::endl;
+
+  // check that neighbor, parent and child relations are consistent
+  bool relations_ok = true;
+  for (const auto &cell : tria.cell_iterators())
+    {
+      for (const unsigned int f : cell->face_indices())
+        if (cell->at_boundary(f) == false &&
+            cell->neighbor(f)->level() == cell->level())
+          relations_ok = relations_ok &&
+                         cell->neighbor(f)->neighbor(
+                           cell->neighbor_of_neighbor(f)) == cell;
+      if (cell->has_children())
+        for (unsigned int c = 0; c < cell->n_children(); ++c)
+          relations_ok = relations_ok && cell->child(c)->parent() == cell;
+    }
+  deallog << "Consistent relations: " << relations_ok << std::endl;
+
+  deallog << "Neighbors closer than before: "
+          << (distance_after < distance_before) << std::endl;
+
+  // renumbering again must not change anything
+  std::vector<Point<dim>> centers;
+  for (const auto &cell : tria.active_cell_iterators())
+    centers.push_back(cell->center());
+  tria.renumber_cells_along_space_filling_curve();
+  bool unchanged = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    unchanged =
+      unchanged && (cell->center() == centers[cell->active_cell_index()]);
+  deallog << "Idempotent: " << unchanged << std::endl;
+
+  // the mesh can still be used as before
+  dof_handler.distribute_dofs(fe);
+  deallog << "Same number of DoFs: " << (dof_handler.n_dofs() == n_dofs)
+          << std::endl;
+
+  const unsigned int n_active_cells = tria.n_active_cells();
+  tria.refine_global(1);
+  deallog << "Refinement: "
+          << (tria.n_active_cells() ==
+              n_active_cells * GeometryInfo<dim>::max_children_per_cell)
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<2> tria(Triangulation<2>::limit_level_difference_at_vertices);
+    GridGenerator::subdivided_hyper_cube(tria, 8);
+    check(tria, FE_Q<2>(2));
+  }
+  {
+    Triangulation<3> tria(Triangulation<3>::limit_level_difference_at_vertices);
+    GridGenerator::hyper_ball(tria);
+    check(tria, FE_Q<3>(1));
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::subdivided_hyper_cube_with_simplices(tria, 3);
+    tria.refine_global(1);
+    check(tria, FE_SimplexP<3>(1));
+  }
+}
@@ -0,0 +1,137 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that GridTools::VertexToCellMap lists the same cells as a
+// straightforward computation of the cells adjacent to each vertex, both when
+// built from scratch and when updated incrementally by GridTools::Cache
+// after local refinement and coarsening.
+
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<std::set<typename Triangulation<dim>::active_cell_iterator>>
+reference_vertex_to_cell_map(const Triangulation<dim> &tria)
+{
+  std::vector<std::set<typename Triangulation<dim>::active_cell_iterator>>
+    vertex_to_cells(tria.n_vertices());
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      for (const unsigned int v : cell->vertex_indices())
+        vertex_to_cells[cell->vertex_index(v)].insert(cell);
+
+      // hanging nodes on faces and, in 3d, on edges
+      for (const unsigned int f : cell->face_indices())
+        if (!cell->at_boundary(f) && cell->neighbor(f)->is_active())
+          for (const unsigned int v : cell->face(f)->vertex_indices())
+            vertex_to_cells[cell->face(f)->vertex_index(v)].insert(
+              cell->neighbor(f));
+      if (dim == 3)
+        for (const unsigned int l : cell->line_indices())
+          if (cell->line(l)->has_children())
+            vertex_to_cells[cell->line(l)->child(0)->vertex_index(1)].insert(
+              cell);
+    }
+  return vertex_to_cells;
+}
+
+
+
+template <int dim>
+bool
+compare(const GridTools::VertexToCellMap<dim> &vertex_to_cells,
+        const Triangulation<dim>              &tria)
+{
+  const auto reference = reference_vertex_to_cell_map(tria);
+  if ((vertex_to_cells.n_vertices() != tria.n_vertices()) ||
+      (vertex_to_cells.get_vector_of_sets() != reference))
+    return false;
+
+  for (unsigned int v = 0; v < reference.size(); ++v)
+    {
+      const auto cells = vertex_to_cells.get_adjacent_cells(v);
+      if (!std::equal(cells.begin(),
+                      cells.end(),
+                      reference[v].begin(),
+                      reference[v].end()))
+        return false;
+      for (unsigned int i = 0; i < cells.size(); ++i)
+        if (vertex_to_cells.get_adjacent_cell(v, i) != cells[i])
+          return false;
+    }
+  return true;
+}
+
+
+
+template <int dim>
+void
+test(Triangulation<dim> &tria)
+{
+  GridTools::Cache<dim> cache(tria);
+  deallog << "dim=" << dim << ", initial mesh: "
+          << compare(cache.get_compressed_vertex_to_cell_map(), tria)
+          << std::endl;
+
+  for (unsigned int cycle = 0; cycle < 4; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (random_value<double>() < 0.1)
+          cell->set_refine_flag();
+        else if (random_value<double>() < 0.2)
+          cell->set_coarsen_flag();
+      tria.execute_coarsening_and_refinement();
+
+      deallog << "cycle " << cycle << ", from scratch: "
+              << compare(GridTools::VertexToCellMap<dim>(tria), tria)
+              << ", incremental: "
+              << compare(cache.get_compressed_vertex_to_cell_map(), tria)
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<1> tria;
+    GridGenerator::hyper_cube(tria);
+    tria.refine_global(4);
+    test(tria);
+  }
+  {
+    Triangulation<2> tria;
+    GridGenerator::hyper_ball(tria);
+    tria.refine_global(2);
+    test(tria);
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::hyper_cube(tria);
+    tria.refine_global(2);
+    test(tria);
+  }
+}
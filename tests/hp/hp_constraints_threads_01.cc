@@ -0,0 +1,136 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// DoFTools::make_hanging_node_constraints() computes the constraints of hp
+// meshes with several threads. Check that the result is the same as with a
+// single thread, and that the interpolation matrices cached in the
+// FECollection are the ones the elements compute.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include <sstream>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::string
+get_constraints(const DoFHandler<dim> &dof_handler,
+                const unsigned int     n_threads)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  std::ostringstream out;
+  constraints.print(out);
+  return out.str();
+}
+
+
+
+template <int dim>
+void
+test(const unsigned int max_degree, const unsigned int n_refinements)
+{
+  hp::FECollection<dim> fe_collection;
+  for (unsigned int degree = 1; degree <= max_degree; ++degree)
+    fe_collection.push_back(FE_Q<dim>(degree));
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(n_refinements);
+  for (unsigned int cycle = 0; cycle < 2; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (random_value<double>() < 0.3)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  DoFHandler<dim> dof_handler(tria);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(Testing::rand() % fe_collection.size());
+  dof_handler.distribute_dofs(fe_collection);
+
+  const std::string constraints_1 = get_constraints(dof_handler, 1);
+  const std::string constraints_4 = get_constraints(dof_handler, 4);
+  deallog << "dim=" << dim << ", has constraints: " << !constraints_1.empty()
+          << ", same constraints: " << (constraints_1 == constraints_4)
+          << std::endl;
+
+  // the cached matrices must be the ones computed by the elements. FE_Q
+  // only interpolates from elements with at least as many dofs per face
+  bool same_matrices = true;
+  for (unsigned int i = 0; i < fe_collection.size(); ++i)
+    for (unsigned int j = 0; j < fe_collection.size(); ++j)
+      {
+        if (fe_collection[i].n_dofs_per_face() >
+            fe_collection[j].n_dofs_per_face())
+          continue;
+
+        FullMatrix<double> face_matrix(fe_collection[j].n_dofs_per_face(),
+                                       fe_collection[i].n_dofs_per_face());
+        fe_collection[i].get_face_interpolation_matrix(fe_collection[j],
+                                                       face_matrix);
+        same_matrices = same_matrices &&
+                        (dof_handler.get_fe_collection()
+                           .get_face_interpolation_matrix(i, j) == face_matrix);
+
+        for (unsigned int c = 0; c < GeometryInfo<dim>::max_children_per_face;
+             ++c)
+          {
+            FullMatrix<double> subface_matrix(
+              fe_collection[j].n_dofs_per_face(),
+              fe_collection[i].n_dofs_per_face());
+            fe_collection[i].get_subface_interpolation_matrix(fe_collection[j],
+                                                              c,
+                                                              subface_matrix);
+            same_matrices =
+              same_matrices &&
+              (dof_handler.get_fe_collection()
+                 .get_subface_interpolation_matrix(i, j, c) == subface_matrix);
+          }
+      }
+  deallog << "Same interpolation matrices: " << same_matrices << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(6, 4);
+  test<3>(4, 2);
+}
@@ -0,0 +1,130 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// AffineConstraints::close() resolves chains of constraints with several
+// threads. Set up long chains of random constraints, and check that the
+// result is independent of the number of threads and that distribute()
+// gives the same values as evaluating the original constraints one after
+// the other. Also check that cycles are detected.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <set>
+#include <sstream>
+
+#include "../tests.h"
+
+
+
+struct Line
+{
+  types::global_dof_index                                      index;
+  std::vector<std::pair<types::global_dof_index, double>> entries;
+  double                                                       inhomogeneity;
+};
+
+
+
+std::string
+close_and_print(const std::vector<Line> &lines, const unsigned int n_threads)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  AffineConstraints<double> constraints;
+  for (const Line &line : lines)
+    constraints.add_constraint(line.index, line.entries, line.inhomogeneity);
+  constraints.close();
+
+  std::ostringstream out;
+  constraints.print(out);
+  return out.str();
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  // constrain every third dof against up to four dofs with smaller
+  // indices, which themselves may be constrained
+  const unsigned int n_dofs = 30000;
+  std::vector<Line>  lines;
+  for (types::global_dof_index i = 10; i < n_dofs; ++i)
+    if (Testing::rand() % 3 == 0)
+      {
+        Line line;
+        line.index = i;
+        std::set<types::global_dof_index> columns;
+        const unsigned int                n_entries = Testing::rand() % 5;
+        for (unsigned int e = 0; e < n_entries; ++e)
+          columns.insert(i - 1 - Testing::rand() % 10);
+        for (const types::global_dof_index column : columns)
+          line.entries.emplace_back(column, random_value<double>());
+        line.inhomogeneity = random_value<double>();
+        lines.push_back(line);
+      }
+
+  deallog << "Same constraints: "
+          << (close_and_print(lines, 1) == close_and_print(lines, 4))
+          << std::endl;
+
+  // compute the values of the constrained dofs by evaluating the original
+  // constraints in order, and compare with what distribute() computes
+  MultithreadInfo::set_thread_limit(4);
+  AffineConstraints<double> constraints;
+  for (const Line &line : lines)
+    constraints.add_constraint(line.index, line.entries, line.inhomogeneity);
+  constraints.close();
+
+  Vector<double> reference(n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    reference[i] = random_value<double>();
+  for (const Line &line : lines)
+    {
+      reference[line.index] = line.inhomogeneity;
+      for (const auto &entry : line.entries)
+        reference[line.index] += entry.second * reference[entry.first];
+    }
+
+  Vector<double> vector(n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    if (constraints.is_constrained(i) == false)
+      vector[i] = reference[i];
+  constraints.distribute(vector);
+  vector -= reference;
+  deallog << "Same values: " << (vector.linfty_norm() < 1e-10 * n_dofs)
+          << std::endl;
+
+  // finally check that a cycle of constraints is detected
+  try
+    {
+      AffineConstraints<double> cycle;
+      cycle.add_constraint(0, {{1, 1.}}, 0.);
+      cycle.add_constraint(1, {{2, 0.5}, {3, 0.5}}, 0.);
+      cycle.add_constraint(2, {{0, 1.}}, 0.);
+      cycle.close();
+    }
+  catch (const ExceptionBase &e)
+    {
+      deallog << "Exception: " << e.get_exc_name() << std::endl;
+    }
+}
@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// TransfiniteInterpolationManifold caches the pull-backs of points. Check
+// that new points computed with a filled cache, from several threads, and
+// after moving the mesh agree with the ones computed by a manifold with an
+// empty cache.
+
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/table.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/manifold_lib.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<Point<dim>>
+compute_new_points(const Triangulation<dim> &tria,
+                   const Manifold<dim>      &manifold,
+                   const Table<2, double>   &weights,
+                   const bool                use_threads)
+{
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+  for (const auto &cell : tria.active_cell_iterators())
+    cells.push_back(cell);
+
+  std::vector<Point<dim>> new_points(cells.size() * weights.size(0));
+  const unsigned int       n_rows = weights.size(0);
+
+  const auto work = [&](const unsigned int begin, const unsigned int end) {
+    for (unsigned int c = begin; c < end; ++c)
+      {
+        std::vector<Point<dim>> vertices;
+        for (const unsigned int v : cells[c]->vertex_indices())
+          vertices.push_back(cells[c]->vertex(v));
+        manifold.get_new_points(
+          make_array_view(vertices),
+          weights,
+          make_array_view(new_points.begin() + c * n_rows,
+                          new_points.begin() + (c + 1) * n_rows));
+      }
+  };
+  if (use_threads)
+    parallel::apply_to_subranges(0U, cells.size(), work, 4);
+  else
+    work(0, cells.size());
+
+  return new_points;
+}
+
+
+
+template <int dim>
+double
+max_distance(const std::vector<Point<dim>> &a, const std::vector<Point<dim>> &b)
+{
+  double distance = 0;
+  for (unsigned int i = 0; i < a.size(); ++i)
+    distance = std::max(distance, a[i].distance(b[i]));
+  return distance;
+}
+
+
+
+// create a ball with a transfinite interpolation manifold in the interior,
+// possibly shifted, whose cache is still empty
+template <int dim>
+void
+create_mesh(Triangulation<dim> &tria, const Tensor<1, dim> &shift)
+{
+  GridGenerator::hyper_ball(tria);
+  tria.set_all_manifold_ids(1);
+  tria.set_all_manifold_ids_on_boundary(0);
+  tria.set_manifold(0, SphericalManifold<dim>());
+  TransfiniteInterpolationManifold<dim> manifold;
+  manifold.initialize(tria);
+  tria.set_manifold(1, manifold);
+  tria.refine_global(1);
+
+  if (shift.norm() > 0)
+    {
+      GridTools::shift(shift, tria);
+      tria.set_manifold(0, SphericalManifold<dim>(Point<dim>(shift)));
+    }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim=" << dim << std::endl;
+
+  // random weights summing up to one
+  const unsigned int n_vertices = GeometryInfo<dim>::vertices_per_cell;
+  Table<2, double>   weights(5, n_vertices);
+  for (unsigned int i = 0; i < weights.size(0); ++i)
+    {
+      double sum = 0;
+      for (unsigned int v = 0; v < n_vertices; ++v)
+        sum += (weights[i][v] = random_value<double>());
+      for (unsigned int v = 0; v < n_vertices; ++v)
+        weights[i][v] /= sum;
+    }
+
+  // the triangulation stores a copy of the manifold, and only that copy can
+  // compute points on the cells of the triangulation
+  Triangulation<dim> tria;
+  create_mesh(tria, Tensor<1, dim>());
+  const Manifold<dim> &manifold = tria.get_manifold(1);
+
+  Triangulation<dim> fresh_tria;
+  create_mesh(fresh_tria, Tensor<1, dim>());
+
+  const auto first    = compute_new_points(tria, manifold, weights, false);
+  const auto again    = compute_new_points(tria, manifold, weights, false);
+  const auto threaded = compute_new_points(tria, manifold, weights, true);
+  const auto fresh    = compute_new_points(fresh_tria,
+                                           fresh_tria.get_manifold(1),
+                                           weights,
+                                           false);
+  deallog << "Cached:   " << (max_distance(first, again) < 1e-12)
+          << std::endl;
+  deallog << "Threaded: " << (max_distance(first, threaded) < 1e-12)
+          << std::endl;
+  deallog << "Fresh:    " << (max_distance(first, fresh) < 1e-12)
+          << std::endl;
+
+  // after moving the mesh, the cache must not be used anymore
+  Tensor<1, dim> shift;
+  shift[0] = 0.3;
+  GridTools::shift(shift, tria);
+  tria.set_manifold(0, SphericalManifold<dim>(Point<dim>(shift)));
+
+  Triangulation<dim> moved_tria;
+  create_mesh(moved_tria, shift);
+
+  const auto moved = compute_new_points(tria, manifold, weights, false);
+  const auto moved_fresh = compute_new_points(moved_tria,
+                                              moved_tria.get_manifold(1),
+                                              weights,
+                                              false);
+  deallog << "Moved:    " << (max_distance(moved, moved_fresh) < 1e-12)
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
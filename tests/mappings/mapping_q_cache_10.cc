@@ -0,0 +1,161 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test MappingQCache::save() and MappingQCache::load(): the support points
+// restored from disk must be the same as the computed ones, and only the
+// support points of cells created by refinement after saving are computed
+// again. Files that do not match the vertex locations or manifold ids of
+// the triangulation must be rejected.
+
+
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <atomic>
+
+#include "../tests.h"
+
+
+template <int dim>
+bool
+same_mapping(const Triangulation<dim> &tria,
+             const Mapping<dim>       &mapping_1,
+             const Mapping<dim>       &mapping_2)
+{
+  Point<dim> p;
+  for (unsigned int d = 0; d < dim; ++d)
+    p[d] = 0.2 + d * 0.15;
+
+  bool same = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    same = same && (mapping_1.transform_unit_to_real_cell(cell, p) -
+                    mapping_2.transform_unit_to_real_cell(cell, p))
+                       .norm() < 1e-12;
+  return same;
+}
+
+
+
+template <int dim>
+void
+do_test(const unsigned int degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+
+  MappingQ<dim>      mapping(degree);
+  MappingQCache<dim> mapping_cache(degree);
+  mapping_cache.initialize(mapping, tria);
+  mapping_cache.save(tria, "checkpoint");
+
+  // restore the cache on the same mesh: nothing needs to be computed
+  {
+    std::atomic<unsigned int> n_computed_cells(0);
+    MappingQCache<dim>        loaded_cache(degree);
+    loaded_cache.load(tria,
+                      "checkpoint",
+                      [&](const typename Triangulation<dim>::cell_iterator &) {
+                        ++n_computed_cells;
+                        return std::vector<Point<dim>>(
+                          Utilities::pow(degree + 1, dim));
+                      });
+    deallog << "dim=" << dim << ", degree=" << degree
+            << ", computed cells: " << n_computed_cells
+            << ", same mapping: " << same_mapping(tria, mapping, loaded_cache)
+            << std::endl;
+  }
+
+  // refine some cells: only the new cells need to be computed
+  const unsigned int n_cells = tria.n_cells();
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+  {
+    std::atomic<unsigned int> n_computed_cells(0);
+    MappingQCache<dim>        loaded_cache(degree);
+    loaded_cache.load(tria,
+                      "checkpoint",
+                      [&](const typename Triangulation<dim>::cell_iterator &) {
+                        ++n_computed_cells;
+                        return std::vector<Point<dim>>(
+                          Utilities::pow(degree + 1, dim));
+                      });
+    deallog << "After refinement, computed only new cells: "
+            << (n_computed_cells == tria.n_cells() - n_cells) << std::endl;
+  }
+
+  // the variant with a mapping fills in the new cells
+  {
+    MappingQCache<dim> loaded_cache(degree);
+    loaded_cache.load(mapping, tria, "checkpoint");
+    deallog << "After refinement, same mapping: "
+            << same_mapping(tria, mapping, loaded_cache) << std::endl;
+  }
+
+  // the files cannot be used with a different polynomial degree
+  try
+    {
+      MappingQCache<dim> loaded_cache(degree + 1);
+      loaded_cache.load(mapping, tria, "checkpoint");
+    }
+  catch (const ExceptionBase &e)
+    {
+      deallog << "Exception: " << e.get_exc_name() << std::endl;
+    }
+
+  // the files cannot be used once a vertex has been moved ...
+  const auto       cell   = tria.begin_active();
+  const Point<dim> vertex = cell->vertex(0);
+  cell->vertex(0) *= 0.9;
+  try
+    {
+      MappingQCache<dim> loaded_cache(degree);
+      loaded_cache.load(mapping, tria, "checkpoint");
+    }
+  catch (const ExceptionBase &e)
+    {
+      deallog << "Exception: " << e.get_exc_name() << std::endl;
+    }
+  cell->vertex(0) = vertex;
+
+  // ... or a manifold id has been changed
+  cell->set_manifold_id(42);
+  try
+    {
+      MappingQCache<dim> loaded_cache(degree);
+      loaded_cache.load(mapping, tria, "checkpoint");
+    }
+  catch (const ExceptionBase &e)
+    {
+      deallog << "Exception: " << e.get_exc_name() << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  deal_II_exceptions::disable_abort_on_exception();
+
+  initlog();
+  do_test<2>(3);
+  do_test<3>(2);
+}
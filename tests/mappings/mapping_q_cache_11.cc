@@ -0,0 +1,151 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test MappingQCache::save() and MappingQCache::load() next to the
+// checkpointing of a parallel::distributed::Triangulation: the support
+// points restored from disk must be the same as the computed ones, and
+// files that do not match the vertex locations of the triangulation or
+// that can not be read on one of the processes must be rejected on all
+// processes.
+
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <cstdio>
+
+#include "../tests.h"
+
+
+template <int dim>
+bool
+same_mapping(const Triangulation<dim> &tria,
+             const Mapping<dim>       &mapping_1,
+             const Mapping<dim>       &mapping_2)
+{
+  Point<dim> p;
+  for (unsigned int d = 0; d < dim; ++d)
+    p[d] = 0.2 + d * 0.15;
+
+  bool same = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      same = same && (mapping_1.transform_unit_to_real_cell(cell, p) -
+                      mapping_2.transform_unit_to_real_cell(cell, p))
+                         .norm() < 1e-12;
+  return Utilities::MPI::min(same ? 1U : 0U, tria.get_mpi_communicator()) ==
+         1;
+}
+
+
+
+template <int dim>
+void
+do_test(const unsigned int degree)
+{
+  MappingQ<dim> mapping(degree);
+
+  {
+    parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+    GridGenerator::hyper_ball(tria);
+    tria.refine_global(2);
+
+    MappingQCache<dim> mapping_cache(degree);
+    mapping_cache.initialize(mapping, tria);
+
+    tria.save("checkpoint");
+    mapping_cache.save(tria, "checkpoint");
+  }
+
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_ball(tria);
+  tria.load("checkpoint");
+
+  // restore the cache on the same partitioned mesh: nothing needs to be
+  // computed
+  {
+    unsigned int       n_computed_cells = 0;
+    MappingQCache<dim> loaded_cache(degree);
+    loaded_cache.load(tria,
+                      "checkpoint",
+                      [&](const typename Triangulation<dim>::cell_iterator &) {
+                        ++n_computed_cells;
+                        return std::vector<Point<dim>>(
+                          Utilities::pow(degree + 1, dim));
+                      });
+    deallog << "dim=" << dim << ", degree=" << degree << ", computed cells: "
+            << Utilities::MPI::sum(n_computed_cells, MPI_COMM_WORLD)
+            << ", same mapping: " << same_mapping(tria, mapping, loaded_cache)
+            << std::endl;
+  }
+
+  // refine and repartition the mesh: the cells not found in the files are
+  // computed by the mapping
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned() && cell->center()[0] > 0)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+  {
+    MappingQCache<dim> loaded_cache(degree);
+    loaded_cache.load(mapping, tria, "checkpoint");
+    deallog << "After refinement, same mapping: "
+            << same_mapping(tria, mapping, loaded_cache) << std::endl;
+  }
+
+  // the files cannot be used once the vertices have been moved
+  GridTools::scale(2., tria);
+  try
+    {
+      MappingQCache<dim> loaded_cache(degree);
+      loaded_cache.load(mapping, tria, "checkpoint");
+    }
+  catch (const ExceptionBase &e)
+    {
+      deallog << "Exception: " << e.get_exc_name() << std::endl;
+    }
+
+  // a file that can not be read on one process must lead to an exception
+  // on all processes rather than leave the others waiting for that process
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 1)
+    std::remove("checkpoint_mapping_q_cache_1.data");
+  try
+    {
+      MappingQCache<dim> loaded_cache(degree);
+      loaded_cache.load(mapping, tria, "checkpoint");
+    }
+  catch (const ExceptionBase &e)
+    {
+      deallog << "Exception: " << e.get_exc_name() << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  deal_II_exceptions::disable_abort_on_exception();
+
+  do_test<2>(3);
+  do_test<3>(2);
+}
@@ -0,0 +1,134 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+
+// Test parallel::MeasuredCellWeights on a parallel::distributed::Triangulation:
+// record artificial costs that are four times higher on the right half of
+// the domain, let repartition_if_imbalanced() balance the estimated costs,
+// and then refine the expensive cells. The cost of a refined cell is split
+// evenly among its children, so all cells of the refined mesh have the same
+// weight and end up evenly distributed.
+
+
+#include <deal.II/distributed/cell_weights.h>
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+double
+cost(const typename Triangulation<dim>::cell_iterator &cell)
+{
+  return cell->center()[0] < 0.5 ? 1. : 4.;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const MPI_Comm     comm    = MPI_COMM_WORLD;
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(comm);
+
+  parallel::distributed::Triangulation<dim> tria(comm);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  parallel::MeasuredCellWeights<dim> cell_weights(tria);
+
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      cell_weights.add_cost(cell, cost<dim>(cell));
+  cell_weights.finish_step();
+
+  deallog << "Imbalance: " << cell_weights.get_imbalance() << std::endl;
+  deallog << "Needs repartitioning: " << cell_weights.needs_repartitioning()
+          << std::endl;
+  deallog << "Repartitioned: " << cell_weights.repartition_if_imbalanced()
+          << std::endl;
+
+  // the estimates have moved along with the cells
+  unsigned int estimates_ok = 1;
+  double       local_cost   = 0.;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        local_cost += cell_weights.get_cost_estimate(cell);
+        if (std::abs(cell_weights.get_cost_estimate(cell) - cost<dim>(cell)) >
+            1e-12)
+          estimates_ok = 0;
+      }
+  deallog << "Estimates transferred: "
+          << Utilities::MPI::min(estimates_ok, comm) << std::endl;
+
+  const Utilities::MPI::MinMaxAvg cost_statistics =
+    Utilities::MPI::min_max_avg(local_cost, comm);
+  deallog << "Balanced: "
+          << (cost_statistics.max / cost_statistics.avg < 1.1) << std::endl;
+
+  // all future children of a refined cell get the same share of its cost,
+  // independent of whether p4est reports them with
+  // CellStatus::cell_will_be_refined (first child) or CellStatus::cell_invalid
+  // (remaining children)
+  const auto weight = cell_weights.make_weighting_callback();
+  unsigned int children_ok = 1;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      if (weight(cell, CellStatus::cell_will_be_refined) !=
+          weight(cell, CellStatus::cell_invalid))
+        children_ok = 0;
+  deallog << "Weights of children: " << Utilities::MPI::min(children_ok, comm)
+          << std::endl;
+
+  // refine the expensive cells. their children have the same cost as the
+  // cheap cells, so the new mesh is partitioned evenly by number of cells
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned() && cost<dim>(cell) > 1.)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const auto n_locally_owned_active_cells_per_processor =
+    Utilities::MPI::all_gather(comm, tria.n_locally_owned_active_cells());
+  for (unsigned int p = 0; p < numproc; ++p)
+    deallog << "processor " << p << ": "
+            << n_locally_owned_active_cells_per_processor[p]
+            << " locally owned active cells" << std::endl;
+
+  // the estimates are discarded when the mesh changes
+  unsigned int estimates_reset = 1;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned() && cell_weights.get_cost_estimate(cell) >= 0.)
+      estimates_reset = 0;
+  deallog << "Estimates reset: " << Utilities::MPI::min(estimates_reset, comm)
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2>();
+}
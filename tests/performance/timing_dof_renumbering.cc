@@ -0,0 +1,157 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A performance benchmark that compares the cost of the DoF renumberings
+// DoFRenumbering::Cuthill_McKee() and DoFRenumbering::space_filling_curve()
+// and the time of matrix-vector products with an assembled sparse matrix for
+// the resulting numberings, on an adaptively refined mesh in 3d. The
+// numbering produced by distribute_dofs() is measured as a reference.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/matrix_creator.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+dealii::ConditionalOStream debug_output(std::cout, false);
+
+
+constexpr int dim = 3;
+
+
+// Set up the matrix for the current numbering of the DoFs and return the
+// time needed for a number of matrix-vector products.
+double
+time_vmult(const DoFHandler<dim> &dof_handler)
+{
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+
+  SparseMatrix<double> matrix(sparsity_pattern);
+  MatrixCreator::create_laplace_matrix(dof_handler,
+                                       QGauss<dim>(3),
+                                       matrix,
+                                       nullptr,
+                                       constraints);
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = static_cast<double>(i % 17) / 17.;
+
+  Timer timer;
+  for (unsigned int i = 0; i < 50; ++i)
+    {
+      matrix.vmult(dst, src);
+      src.add(1e-3, dst);
+    }
+  timer.stop();
+
+  return timer.wall_time();
+}
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_ball(triangulation);
+
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(3);
+        break;
+      case TestingEnvironment::medium:
+        DEAL_II_FALLTHROUGH;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(4);
+        break;
+    }
+
+  // refine the cells close to the boundary to obtain an unstructured,
+  // adaptively refined mesh
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center().norm() > 0.8)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  debug_output << "Number of degrees of freedom: " << dof_handler.n_dofs()
+               << std::endl;
+
+  const double vmult_default = time_vmult(dof_handler);
+
+  Timer timer;
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+  timer.stop();
+  const double renumber_cuthill_mckee = timer.wall_time();
+  const double vmult_cuthill_mckee    = time_vmult(dof_handler);
+
+  timer.restart();
+  DoFRenumbering::space_filling_curve(dof_handler);
+  timer.stop();
+  const double renumber_space_filling_curve = timer.wall_time();
+  const double vmult_space_filling_curve    = time_vmult(dof_handler);
+
+  return {vmult_default,
+          renumber_cuthill_mckee,
+          vmult_cuthill_mckee,
+          renumber_space_filling_curve,
+          vmult_space_filling_curve};
+}
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"vmult_default",
+           "renumber_cuthill_mckee",
+           "vmult_cuthill_mckee",
+           "renumber_space_filling_curve",
+           "vmult_space_filling_curve"}};
+}
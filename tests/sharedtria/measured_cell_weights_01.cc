@@ -0,0 +1,144 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test parallel::MeasuredCellWeights: record artificial costs that are
+// four times higher on the right half of the domain, smooth them over two
+// steps, detect the load imbalance, and compute a new partition with
+// RepartitioningPolicyTools::CellWeightPolicy that is better balanced.
+
+
+#include <deal.II/distributed/cell_weights.h>
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+double
+cost(const typename Triangulation<dim>::cell_iterator &cell)
+{
+  return cell->center()[0] < 0.5 ? 1. : 4.;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const MPI_Comm     comm = MPI_COMM_WORLD;
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+
+  parallel::shared::Triangulation<dim> tria(
+    comm,
+    Triangulation<dim>::none,
+    false,
+    parallel::shared::Triangulation<dim>::partition_zorder);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(4);
+
+  const typename parallel::MeasuredCellWeights<dim>::AdditionalData
+                                    additional_data(0.5, 1.2);
+  parallel::MeasuredCellWeights<dim> cell_weights(tria, additional_data);
+
+  // two steps with costs that double from the first to the second step
+  for (const double factor : {1., 2.})
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->is_locally_owned())
+          cell_weights.add_cost(cell, factor * cost<dim>(cell));
+      cell_weights.finish_step();
+    }
+
+  // the estimates are the average of the two measurements
+  bool estimates_ok = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      estimates_ok =
+        estimates_ok &&
+        std::abs(cell_weights.get_cost_estimate(cell) - 1.5 * cost<dim>(cell)) <
+          1e-12;
+  deallog << "Estimates: " << estimates_ok << std::endl;
+  deallog << "Imbalance: " << cell_weights.get_imbalance() << std::endl;
+  deallog << "Needs repartitioning: " << cell_weights.needs_repartitioning()
+          << std::endl;
+
+  // compute a new partition with the measured weights and the resulting
+  // imbalance
+  const RepartitioningPolicyTools::CellWeightPolicy<dim> policy(
+    cell_weights.make_weighting_callback());
+  const LinearAlgebra::distributed::Vector<double> partition =
+    policy.partition(tria);
+
+  std::vector<double> cost_per_rank(n_ranks, 0.);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      cost_per_rank[static_cast<unsigned int>(
+        partition[cell->global_active_cell_index()])] +=
+        cell_weights.get_cost_estimate(cell);
+  Utilities::MPI::sum(cost_per_rank, comm, cost_per_rank);
+  const double max_cost =
+    *std::max_element(cost_per_rank.begin(), cost_per_rank.end());
+  const double avg_cost =
+    std::accumulate(cost_per_rank.begin(), cost_per_rank.end(), 0.) / n_ranks;
+  deallog << "Imbalance after repartitioning: " << max_cost / avg_cost
+          << std::endl;
+
+  // the estimates are discarded when the mesh changes
+  tria.refine_global(1);
+  bool estimates_reset = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      estimates_reset =
+        estimates_reset && (cell_weights.get_cost_estimate(cell) < 0.);
+  deallog << "Estimates reset: " << estimates_reset << std::endl;
+
+  // measure some actual work
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        typename parallel::MeasuredCellWeights<dim>::ScopedCellTimer timer(
+          cell_weights, cell);
+        double sum = 0;
+        for (unsigned int i = 0; i < 100; ++i)
+          sum += cell->center().norm();
+        (void)sum;
+      }
+  cell_weights.finish_step();
+  bool measured = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      measured = measured && (cell_weights.get_cost_estimate(cell) >= 0.);
+  deallog << "Measured: " << measured << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2>();
+}
@@ -0,0 +1,70 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test local refinement of a 3d simplex mesh. A tetrahedron shares the lines
+// in the interior of its refined faces with the children of its neighbor
+// that does not have a face on the refined face. Refining such a child must
+// lead to refinement of the tetrahedron, or else the children of the
+// tetrahedron end up with lines that are refined twice and the mesh can not
+// be refined any further.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+void
+test()
+{
+  constexpr int      dim = 3;
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube_with_simplices(tria, 1);
+  tria.refine_global(1);
+
+  for (unsigned int cycle = 0; cycle < 4; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (random_value<double>() < 0.3)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+
+      bool lines_refined_once = true;
+      for (const auto &cell : tria.active_cell_iterators())
+        for (unsigned int l = 0; l < cell->n_lines(); ++l)
+          if (cell->line(l)->has_children())
+            for (unsigned int c = 0; c < 2; ++c)
+              lines_refined_once =
+                lines_refined_once &&
+                (cell->line(l)->child(c)->has_children() == false);
+
+      deallog << "Cycle " << cycle << ": " << tria.n_active_cells()
+              << " cells, lines refined at most once: " << lines_refined_once
+              << std::endl;
+    }
+
+  const unsigned int n_active_cells = tria.n_active_cells();
+  tria.refine_global(1);
+  deallog << "Global refinement: "
+          << (tria.n_active_cells() == 8 * n_active_cells) << std::endl;
+}
+
+int
+main()
+{
+  initlog();
+  test();
+}